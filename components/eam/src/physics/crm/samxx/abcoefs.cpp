@@ -4,9 +4,11 @@
 // Compute the coefficients for the Adams-Bashforth scheme
 void abcoefs() {
   if (nstep >= 3) {
-    realHost1d dt3Host("dt3Host",3);
+#ifndef MMF_FUSED_STAGES
+    // With MMF_FUSED_STAGES, timeloop() sets dt3Host directly
     dt3.deep_copy_to(dt3Host);
     yakl::fence();
+#endif
     real alpha = dt3Host(nb-1) / dt3Host(na-1);
     real beta  = dt3Host(nc-1) / dt3Host(na-1);
     ct = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
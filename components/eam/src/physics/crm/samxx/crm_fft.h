@@ -0,0 +1,251 @@
+
+#pragma once
+
+#include "samxx_const.h"
+
+// Batched real <-> half-complex FFT of length N along one dimension of a real4d,
+// used by the pressure solver with -DMMF_BATCHED_FFT.
+//
+// All the rows of all the CRMs are transformed by a single parallel_for, one
+// row per thread. The rows are enumerated with the fastest varying (CRM) index
+// last, so that neighboring threads touch neighboring memory. The plan (bit
+// reversal and twiddle tables) is computed on the host on first use, and is
+// then shared by all the rows and reused by all the following calls.
+//
+// The transforms follow the definitions of fft991_crm, so both give the same
+// coefficients, in the same order:
+//   forward: a(k)+i*b(k) = (1/N)*sum(j=0,...,N-1)(x(j)*exp(-2*i*j*k*pi/N)), k=0,...,N/2
+//   inverse: x(j) = sum(k=0,...,N-1)(c(k)*exp(2*i*j*k*pi/N)), c(k)=a(k)+i*b(k), c(N-k)=conj(c(k))
+// stored as a(0),b(0),a(1),b(1),...,a(N/2),b(N/2), so N+2 entries are needed
+// along the transformed dimension.
+//
+// If N/2 is a power of two, the half-length complex transform is done with an
+// in-register radix-2 FFT. Otherwise, it falls back to a direct DFT using the
+// same twiddle tables.
+template <int N> class CRMRealFFT {
+  static_assert(N >= 2, "CRMRealFFT requires N >= 2");
+
+  static int constexpr M = N/2;
+  static bool constexpr radix2 = (N%2 == 0) && ((M & (M-1)) == 0);
+  static int constexpr nw = M/2 > 0 ? M/2 : 1;
+
+  real1d twr;     // cos(2*pi*j/N), j=0,...,N-1
+  real1d twi;     // -sin(2*pi*j/N), j=0,...,N-1
+  real1d wr;      // cos(2*pi*j/M), j=0,...,M/2-1
+  real1d wi;      // -sin(2*pi*j/M), j=0,...,M/2-1
+  int1d  bitrev;  // bit reversal permutation of 0,...,M-1
+  bool   initialized = false;
+
+public:
+
+  void init() {
+    if (initialized) { return; }
+    double constexpr pi = 3.14159265358979323846;
+
+    realHost1d twrHost("twr",N);
+    realHost1d twiHost("twi",N);
+    realHost1d wrHost ("wr" ,nw);
+    realHost1d wiHost ("wi" ,nw);
+    intHost1d  brHost ("bitrev",M);
+    for (int j=0; j<N; j++) {
+      twrHost(j) =  cos(2.*pi*j/N);
+      twiHost(j) = -sin(2.*pi*j/N);
+    }
+    for (int j=0; j<nw; j++) {
+      wrHost(j) =  cos(2.*pi*j/M);
+      wiHost(j) = -sin(2.*pi*j/M);
+    }
+    int nbits = 0;
+    while ((1 << nbits) < M) { nbits++; }
+    for (int j=0; j<M; j++) {
+      int r = 0;
+      if (radix2) {
+        for (int b=0; b<nbits; b++) { if (j & (1 << b)) { r |= 1 << (nbits-1-b); } }
+      } else {
+        r = j;
+      }
+      brHost(j) = r;
+    }
+
+    twr    = real1d("twr",N);
+    twi    = real1d("twi",N);
+    wr     = real1d("wr" ,nw);
+    wi     = real1d("wi" ,nw);
+    bitrev = int1d ("bitrev",M);
+    twrHost.deep_copy_to(twr);
+    twiHost.deep_copy_to(twi);
+    wrHost .deep_copy_to(wr);
+    wiHost .deep_copy_to(wi);
+    brHost .deep_copy_to(bitrev);
+    yakl::fence();
+    initialized = true;
+  }
+
+
+  void cleanup() {
+    twr    = real1d();
+    twi    = real1d();
+    wr     = real1d();
+    wi     = real1d();
+    bitrev = int1d();
+    initialized = false;
+  }
+
+
+  // Transform x(0),...,x(N-1) into a(0),b(0),...,a(N/2),b(N/2) along dimension dim of f
+  void forward_real(real4d &f, int dim) {
+    init();
+    int nrow_outer, nrow_inner;
+    get_rows(f, dim, nrow_outer, nrow_inner);
+    int  ntot = f.extent(dim);
+    real *fp  = f.data();
+    YAKL_SCOPE( twr    , this->twr );
+    YAKL_SCOPE( twi    , this->twi );
+    YAKL_SCOPE( wr     , this->wr );
+    YAKL_SCOPE( wi     , this->wi );
+    YAKL_SCOPE( bitrev , this->bitrev );
+
+    // for (int a=0; a<nrow_outer; a++) {
+    //   for (int b=0; b<nrow_inner; b++) {
+    parallel_for( SimpleBounds<2>(nrow_outer,nrow_inner) , YAKL_LAMBDA (int a, int b) {
+      real *x = fp + (size_t) a*ntot*nrow_inner + b;
+      int   s = nrow_inner;
+      if (radix2) {
+        SArray<real,1,M> zr, zi;
+        for (int m=0; m<M; m++) {
+          zr(bitrev(m)) = x[(2*m  )*s];
+          zi(bitrev(m)) = x[(2*m+1)*s];
+        }
+        cfft(zr, zi, wr, wi, -1.);
+        // Split the half-length transform into the transform of the real sequence
+        for (int k=0; k<=M; k++) {
+          int  kk  = k%M;
+          int  km  = (M-k)%M;
+          real er  = 0.5*(zr(kk)+zr(km));
+          real ei  = 0.5*(zi(kk)-zi(km));
+          real orr = 0.5*(zi(kk)+zi(km));
+          real oi  = -0.5*(zr(kk)-zr(km));
+          x[(2*k  )*s] = (er + twr(k)*orr - twi(k)*oi ) / N;
+          x[(2*k+1)*s] = (ei + twr(k)*oi  + twi(k)*orr) / N;
+        }
+      } else {
+        SArray<real,1,N> xloc;
+        for (int j=0; j<N; j++) { xloc(j) = x[j*s]; }
+        for (int k=0; k<=M; k++) {
+          real sr = 0.;
+          real si = 0.;
+          for (int j=0; j<N; j++) {
+            int jk = (j*k)%N;
+            sr += xloc(j)*twr(jk);
+            si += xloc(j)*twi(jk);
+          }
+          x[(2*k  )*s] = sr / N;
+          x[(2*k+1)*s] = si / N;
+        }
+      }
+      x[      s] = 0.;
+      x[(N+1)*s] = 0.;
+    });
+  }
+
+
+  // Transform a(0),b(0),...,a(N/2),b(N/2) into x(0),...,x(N-1) along dimension dim of f
+  void inverse_real(real4d &f, int dim) {
+    init();
+    int nrow_outer, nrow_inner;
+    get_rows(f, dim, nrow_outer, nrow_inner);
+    int  ntot = f.extent(dim);
+    real *fp  = f.data();
+    YAKL_SCOPE( twr    , this->twr );
+    YAKL_SCOPE( twi    , this->twi );
+    YAKL_SCOPE( wr     , this->wr );
+    YAKL_SCOPE( wi     , this->wi );
+    YAKL_SCOPE( bitrev , this->bitrev );
+
+    // for (int a=0; a<nrow_outer; a++) {
+    //   for (int b=0; b<nrow_inner; b++) {
+    parallel_for( SimpleBounds<2>(nrow_outer,nrow_inner) , YAKL_LAMBDA (int a, int b) {
+      real *x = fp + (size_t) a*ntot*nrow_inner + b;
+      int   s = nrow_inner;
+      if (radix2) {
+        SArray<real,1,M> zr, zi;
+        // Merge the coefficients into the half-length transform
+        for (int k=0; k<M; k++) {
+          real xr  = x[(2*k    )*s];
+          real xi  = k == 0 ? 0. : x[(2*k+1)*s];
+          real cr  = x[(2*(M-k))*s];
+          real ci  = k == 0 ? 0. : -x[(2*(M-k)+1)*s];
+          real er  = 0.5*(xr+cr);
+          real ei  = 0.5*(xi+ci);
+          real dr  = 0.5*(xr-cr);
+          real di  = 0.5*(xi-ci);
+          real orr = dr*twr(k) + di*twi(k);
+          real oi  = di*twr(k) - dr*twi(k);
+          zr(bitrev(k)) = er - oi;
+          zi(bitrev(k)) = ei + orr;
+        }
+        cfft(zr, zi, wr, wi, 1.);
+        for (int m=0; m<M; m++) {
+          x[(2*m  )*s] = 2.*zr(m);
+          x[(2*m+1)*s] = 2.*zi(m);
+        }
+      } else {
+        SArray<real,1,N+2> c;
+        for (int k=0; k<N+2; k++) { c(k) = x[k*s]; }
+        for (int j=0; j<N; j++) {
+          real sum = c(0);
+          for (int k=1; k<=M; k++) {
+            int  jk   = (j*k)%N;
+            real fact = 2*k == N ? 1. : 2.;
+            sum += fact*(c(2*k)*twr(jk) + c(2*k+1)*twi(jk));
+          }
+          x[j*s] = sum;
+        }
+      }
+      x[(N  )*s] = 0.;
+      x[(N+1)*s] = 0.;
+    });
+  }
+
+
+private:
+
+  // Rows along dimension dim: the dimensions before dim are flattened into
+  // nrow_outer, and the dimensions after it into nrow_inner (the stride of dim)
+  void get_rows(real4d const &f, int dim, int &nrow_outer, int &nrow_inner) const {
+    if (f.extent(dim) < N+2) {
+      std::cout << "Error: in CRMRealFFT, dimension " << dim << " has fewer than N+2 entries!";
+      exit(-1);
+    }
+    nrow_outer = 1;
+    nrow_inner = 1;
+    for (int d=0  ; d<dim; d++) { nrow_outer *= f.extent(d); }
+    for (int d=dim+1; d<4  ; d++) { nrow_inner *= f.extent(d); }
+  }
+
+
+  // In-place radix-2 complex FFT of length M, with the input in bit reversed order.
+  // sign=-1 is the forward transform, and sign=+1 the (unnormalized) inverse one.
+  YAKL_INLINE static void cfft(SArray<real,1,M> &zr, SArray<real,1,M> &zi, real1d const &wr, real1d const &wi, real sign) {
+    for (int len=2; len<=M; len*=2) {
+      int half = len/2;
+      int step = M/len;
+      for (int st=0; st<M; st+=len) {
+        for (int q=0; q<half; q++) {
+          real cr = wr(q*step);
+          real ci = -sign*wi(q*step);
+          int  i1 = st+q;
+          int  i2 = i1+half;
+          real tr = zr(i2)*cr - zi(i2)*ci;
+          real ti = zr(i2)*ci + zi(i2)*cr;
+          zr(i2) = zr(i1) - tr;
+          zi(i2) = zi(i1) - ti;
+          zr(i1) = zr(i1) + tr;
+          zi(i1) = zi(i1) + ti;
+        }
+      }
+    }
+  }
+
+};
+
@@ -0,0 +1,203 @@
+
+#include "fused_stages.h"
+
+void fused_zero_buoyancy() {
+  YAKL_SCOPE( adz    , :: adz);
+  YAKL_SCOPE( dudt   , :: dudt);
+  YAKL_SCOPE( dvdt   , :: dvdt);
+  YAKL_SCOPE( dwdt   , :: dwdt);
+  YAKL_SCOPE( misc   , :: misc);
+  YAKL_SCOPE( na     , :: na);
+  YAKL_SCOPE( bet    , :: bet);
+  YAKL_SCOPE( tabs0  , :: tabs0);
+  YAKL_SCOPE( epsv   , :: epsv);
+  YAKL_SCOPE( qv     , :: qv);
+  YAKL_SCOPE( qv0    , :: qv0);
+  YAKL_SCOPE( qcl    , :: qcl);
+  YAKL_SCOPE( qci    , :: qci);
+  YAKL_SCOPE( qn0    , :: qn0);
+  YAKL_SCOPE( qpl    , :: qpl);
+  YAKL_SCOPE( qpi    , :: qpi);
+  YAKL_SCOPE( qp0    , :: qp0);
+  YAKL_SCOPE( tabs   , :: tabs);
+  YAKL_SCOPE( ncrms  , :: ncrms);
+
+  bool do_buoyancy = !docolumn;
+
+  // Each thread zeroes the tendencies at its point, and then adds the buoyancy
+  // term to dwdt at that point, so that dwdt is only touched once
+  // for (int k=0; k<nz; k++) {
+  //   for (int j=0; j<nyp1; j++) {
+  //     for (int i=0; i<nxp1; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nz,nyp1,nxp1,ncrms) , YAKL_LAMBDA (int k, int j , int i, int icrm) {
+    if(i<nxp1 && j<ny && k<nzm){ dudt(na-1,k,j,i,icrm) = 0.0; }
+    if(i<nx && j<nyp1 && k<nzm){ dvdt(na-1,k,j,i,icrm) = 0.0; }
+    if(i<nx && j<ny && k<nz){
+      real dwdt_loc = 0.0;
+      if (do_buoyancy && k >= 1 && k <= nzm-1) {
+        int kb = k-1;
+        real betu, betd;
+        betu = adz(kb,icrm)/(adz(k,icrm)+adz(kb,icrm));
+        betd = adz(k,icrm)/(adz(k,icrm)+adz(kb,icrm));
+
+        dwdt_loc =
+              dwdt_loc +
+                 bet(k,icrm)*betu*
+                 ( tabs0(k,icrm)*(epsv*(qv(k,j,i,icrm)-qv0(k,icrm))-(qcl(k,j,i,icrm)+qci(k,j,i,icrm)-
+                                  qn0(k,icrm)+qpl(k,j,i,icrm)+qpi(k,j,i,icrm)-qp0(k,icrm)))
+                 +(tabs(k,j,i,icrm)-tabs0(k,icrm))*(1.0+epsv*qv0(k,icrm)-qn0(k,icrm)-qp0(k,icrm)) )
+                 +bet(kb,icrm)*betd*
+                 ( tabs0(kb,icrm)*(epsv*(qv(kb,j,i,icrm)-qv0(kb,icrm))-(qcl(kb,j,i,icrm)+qci(kb,j,i,icrm)-
+                                   qn0(kb,icrm)+qpl(kb,j,i,icrm)+qpi(kb,j,i,icrm)-qp0(kb,icrm)))
+                 +(tabs(kb,j,i,icrm)-tabs0(kb,icrm))*(1.0+epsv*qv0(kb,icrm)-qn0(kb,icrm)-qp0(kb,icrm)) );
+      }
+      dwdt(na-1,k,j,i,icrm) = dwdt_loc;
+      misc(k,j,i,icrm) = 0.0;
+    }
+  });
+}
+
+
+void fused_forcing_damping() {
+  YAKL_SCOPE( ncrms         , ::ncrms );
+  YAKL_SCOPE( z             , ::z );
+  YAKL_SCOPE( u             , ::u );
+  YAKL_SCOPE( v             , ::v );
+  YAKL_SCOPE( w             , ::w );
+  YAKL_SCOPE( t             , ::t );
+  YAKL_SCOPE( ttend         , ::ttend );
+  YAKL_SCOPE( dtn           , ::dtn );
+  YAKL_SCOPE( micro_field   , ::micro_field );
+  YAKL_SCOPE( qtend         , ::qtend );
+  YAKL_SCOPE( qv            , ::qv );
+  YAKL_SCOPE( qv0           , ::qv0 );
+  YAKL_SCOPE( dudt          , ::dudt );
+  YAKL_SCOPE( dvdt          , ::dvdt );
+  YAKL_SCOPE( dwdt          , ::dwdt );
+  YAKL_SCOPE( na            , ::na );
+  YAKL_SCOPE( utend         , ::utend );
+  YAKL_SCOPE( vtend         , ::vtend );
+  YAKL_SCOPE( crm_rad_qrad  , ::crm_rad_qrad );
+
+  real constexpr tau_min    = 60.0;
+  real constexpr tau_max    = 450.0;
+  real constexpr fractional_damp_depth = 0.4;
+
+  bool do_damp = dodamping;
+
+  if (do_damp && tau_min < 2.0*dt) {
+    std::cout << "Error: in damping() tau_min is too small!";
+    exit(-1);
+  }
+
+  real2d qneg ("qneg" ,nzm,ncrms);
+  real2d qpoz ("poz"  ,nzm,ncrms);
+  int2d  nneg ("nneg" ,nzm,ncrms);
+  int1d  n_damp("n_damp",ncrms);
+  real2d t0loc("t0loc",nzm,ncrms);
+  real2d u0loc("u0loc",nzm,ncrms);
+  real2d v0loc("v0loc",nzm,ncrms);
+  real2d tau  ("tau"  ,nzm,ncrms);
+
+  if (do_damp) {
+    // Count the damped levels serially over k, instead of with atomics
+    // for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      int n = 0;
+      for (int k=0; k<nzm; k++) {
+        if(z(nzm-1,icrm)-z(k,icrm) < fractional_damp_depth*z(nzm-1,icrm)) { n = n + 1; }
+      }
+      n_damp(icrm) = n;
+    });
+  }
+
+  // Zero all the column accumulators, and set up the damping time scale
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    qpoz(k,icrm) = 0.0;
+    qneg(k,icrm) = 0.0;
+    nneg(k,icrm) = 0;
+    if (do_damp) {
+      u0loc(k,icrm)=0.0;
+      v0loc(k,icrm)=0.0;
+      t0loc(k,icrm)=0.0;
+      tau(k,icrm) = 0;
+      if ( (k <= nzm-1) && (k >= nzm-1-n_damp(icrm)) ) {
+        tau(k,icrm) = tau_min * pow( (tau_max/tau_min) ,
+                                   ( ( z(nzm-1,icrm) - z(k,icrm) ) / ( z(nzm-1,icrm) - z( nzm-1-n_damp(icrm) , icrm ) ) ) );
+        tau(k,icrm) = 1. / tau(k,icrm);
+      }
+    }
+  });
+
+  // Large-scale forcing and radiative heating. The radiative heating is added
+  // after the large-scale temperature tendency, as in the unfused code.
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int i_rad = i / (nx/crm_nx_rad);
+    int j_rad = j / (ny/crm_ny_rad);
+    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn;
+    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+    micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) =
+          micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn;
+
+    if (micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) < 0.0) {
+      yakl::atomicAdd(nneg(k,icrm),1);
+      yakl::atomicAdd(qneg(k,icrm),micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
+    } else {
+      yakl::atomicAdd(qpoz(k,icrm),micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
+    }
+    dudt(na-1,k,j,i,icrm) = dudt(na-1,k,j,i,icrm) + utend(k,icrm);
+    dvdt(na-1,k,j,i,icrm) = dvdt(na-1,k,j,i,icrm) + vtend(k,icrm);
+  });
+
+  // Fix negative water vapor, and recalculate the grid-mean u0, v0, t0
+  // for the damping, as t has been updated
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    real factor;
+    if(nneg(k,icrm) > 0 && qpoz(k,icrm)+qneg(k,icrm) > 0.0) {
+      factor =  1.0 + qneg(k,icrm)/qpoz(k,icrm);
+      micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) =
+            max(0.0,micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm)*factor);
+    }
+    if (do_damp) {
+      real tmp;
+
+      tmp = u(k,offy_u+j,offx_u+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(u0loc(k,icrm),tmp);
+
+      tmp = v(k,offy_v+j,offx_v+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(v0loc(k,icrm),tmp);
+
+      tmp = t(k,offy_s+j,offx_s+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(t0loc(k,icrm),tmp);
+    }
+  });
+
+  if (do_damp) {
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny; j++) {
+    //     for (int i=0; i<nx; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int idwv = index_water_vapor;
+      if ( k <= nzm-1 && k >= nzm-1-n_damp(icrm) ) {
+        dudt       (na-1,k,       j,       i,icrm) -=     (u (k,offy_u+j,offx_u+i,icrm)-u0loc(k,icrm)) * tau(k,icrm);
+        dvdt       (na-1,k,       j,       i,icrm) -=     (v (k,offy_v+j,offx_v+i,icrm)-v0loc(k,icrm)) * tau(k,icrm);
+        dwdt       (na-1,k,       j,       i,icrm) -=      w (k,offy_w+j,offx_w+i,icrm)                * tau(k,icrm);
+        t          (     k,offy_s+j,offx_s+i,icrm) -= dtn*(t (k,offy_s+j,offx_s+i,icrm)-t0loc(k,icrm)) * tau(k,icrm);
+        micro_field(idwv,k,offy_s+j,offx_s+i,icrm) -= dtn*(qv(k,       j,       i,icrm)-qv0  (k,icrm)) * tau(k,icrm);
+      }
+    });
+  }
+}
+
@@ -0,0 +1,15 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+// Fused versions of the pointwise stages at the start of each subcycle,
+// used by timeloop() when compiled with -DMMF_FUSED_STAGES. They give the
+// same answers as calling the separate routines in the same order:
+//   fused_zero_buoyancy()    : zero() + buoyancy()
+//   fused_forcing_damping()  : forcing() + radiative heating + damping()
+void fused_zero_buoyancy();
+
+void fused_forcing_damping();
+
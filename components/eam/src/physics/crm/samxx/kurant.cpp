@@ -66,6 +66,10 @@ void kurant () {
 
   kurant_sgs(cfl);
 
+  // Note: cfl, and hence ncycle, is the max over the whole batch, so every CRM
+  // is subcycled ncycle times. Per-CRM subcycling is not supported: it would
+  // need per-CRM dtn, dtfactor and dt3 in every kernel, and a way to freeze
+  // the CRMs that completed their step.
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
 #ifdef MMF_FIXED_SUBCYCLE
@@ -47,7 +47,12 @@ void pressure() {
     f(k,j,i,icrm) = p(k,j+offy_p,i+offx_p,icrm);
   });
 
-  #ifndef USE_ORIG_FFT
+  #if defined(MMF_BATCHED_FFT)
+
+    pressure_batched_fftx.forward_real(f, 2);
+    if (RUN3D) { pressure_batched_ffty.forward_real(f, 1); }
+
+  #elif !defined(USE_ORIG_FFT)
 
     pressure_fftx.forward_real(f, 2, nx);
     if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
@@ -172,7 +177,12 @@ void pressure() {
     f(k,j,i,icrm) = ff(k,j,i,icrm);
   });
 
-  #ifndef USE_ORIG_FFT
+  #if defined(MMF_BATCHED_FFT)
+
+    if (RUN3D) { pressure_batched_ffty.inverse_real(f, 1); }
+    pressure_batched_fftx.inverse_real(f, 2);
+
+  #elif !defined(USE_ORIG_FFT)
 
     if (RUN3D) { pressure_ffty.inverse_real(f); }
     pressure_fftx.inverse_real(f);
@@ -0,0 +1,61 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+// Wall-clock timers for the stages of timeloop(), compiled in with
+// -DMMF_STAGE_TIMERS (see the stage benchmarks in test/). Every start/stop
+// fences the device, so the timers serialize the kernel launches and should
+// not be enabled in production runs.
+#ifdef MMF_STAGE_TIMERS
+  #define STAGE_TIMER_START(name) stage_timer_start(name)
+  #define STAGE_TIMER_STOP(name)  stage_timer_stop(name)
+#else
+  #define STAGE_TIMER_START(name)
+  #define STAGE_TIMER_STOP(name)
+#endif
+
+struct StageTimer {
+  std::chrono::steady_clock::time_point start;
+  double elapsed = 0.;
+  int    count   = 0;
+};
+
+inline std::map<std::string,StageTimer> & stage_timers() {
+  static std::map<std::string,StageTimer> timers;
+  return timers;
+}
+
+inline void stage_timer_start(std::string const &name) {
+  yakl::fence();
+  stage_timers()[name].start = std::chrono::steady_clock::now();
+}
+
+inline void stage_timer_stop(std::string const &name) {
+  yakl::fence();
+  StageTimer &timer = stage_timers()[name];
+  timer.elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - timer.start).count();
+  timer.count   += 1;
+}
+
+// Print the accumulated time of each stage, and reset the timers
+inline void stage_timers_print() {
+  std::ios_base::fmtflags flags = std::cout.flags();
+  std::streamsize         prec  = std::cout.precision();
+  std::cout << "\nCRM stage timers (seconds, calls):\n";
+  for (auto const &entry : stage_timers()) {
+    std::cout << "  " << std::left << std::setw(24) << entry.first << " "
+              << std::scientific << std::setprecision(6) << entry.second.elapsed << " "
+              << entry.second.count << "\n";
+  }
+  std::cout << std::endl;
+  std::cout.flags(flags);
+  std::cout.precision(prec);
+  stage_timers().clear();
+}
+
@@ -103,7 +103,7 @@ printf "3D Defs: $DEFS3D\n\n"
 ############################################################################
 ## CLEAN UP THE PREVIOUS BUILD
 ############################################################################
-rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d
+rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d bench bench2d bench3d
 
 
 ############################################################################
@@ -118,6 +118,11 @@ cd ../fortran3d; ln -s ../$2 ./input.nc
 cd ../cpp2d    ; ln -s ../$1 ./input.nc
 cd ../cpp3d    ; ln -s ../$2 ./input.nc
 cd ..
+mkdir bench2d
+mkdir bench3d
+cd bench2d     ; ln -s ../$1 ./input.nc
+cd ../bench3d  ; ln -s ../$2 ./input.nc
+cd ..
 
 ### link non-standard data file
 # rm *3d/input.nc
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+# Time the stages of the CRM time loop with the separate and with the fused
+# pointwise stages, and check that both give the same answers
+
+ntasks=1
+if [[ ! "$1" == "" ]]; then
+  ntasks=$1
+fi
+
+printf "\nRebuilding\n\n"
+
+make -j8 || exit -1
+
+################################################################################
+################################################################################
+
+for dims in 2d 3d; do
+
+  printf "\n\nRunning ${dims} FFT test\n\n"
+  ./bench/fft_test${dims} || exit -1
+
+  printf "\n\nRunning ${dims} stage benchmarks\n\n"
+  cd bench${dims}
+
+  printf "\nRunning separate stages\n\n"
+  rm -f cpp_output_000001.nc stages_output.nc
+  mpirun -n $ntasks ../bench/cpp${dims}_stages || exit -1
+  mv cpp_output_000001.nc stages_output.nc
+
+  printf "\nRunning fused stages\n\n"
+  rm -f cpp_output_000001.nc fused_output.nc
+  mpirun -n $ntasks ../bench/cpp${dims}_fused || exit -1
+  mv cpp_output_000001.nc fused_output.nc
+
+  cd ..
+
+  printf "\nComparing results\n\n"
+  python nccmp.py bench${dims}/stages_output.nc bench${dims}/fused_output.nc || exit -1
+
+done
+
+################################################################################
+################################################################################
@@ -0,0 +1,171 @@
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include "samxx_const.h"
+#include "crm_fft.h"
+
+extern "C" void fftfax_crm(int n, int *ifax, real *trigs);
+extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc, int jump, int n, int lot, int isign);
+
+// Correctness and throughput of the batched CRM FFT (crm_fft.h) against
+// fft991_crm, on arrays shaped like the one transformed in pressure(). The
+// fft991_crm loops are the same as in the USE_ORIG_FFT path of pressure().
+
+int constexpr ntimes = 10;
+
+
+double elapsed(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+// fft991_crm along x, and then along y for 3D CRMs, for all the rows of f
+void fft991_all(realHost4d &f, int isign) {
+  int nzslab = f.extent(0);
+  int ny2    = f.extent(1);
+  int nx2    = f.extent(2);
+  int ncrms  = f.extent(3);
+  realHost2d work  ("work"  ,ny2,nx2);
+  realHost1d ftmp_x("ftmp_x",nx2);
+  realHost1d ftmp_y("ftmp_y",ny2);
+  realHost1d trigxi("trigxi",3*nx_gl/2+1);
+  realHost1d trigxj("trigxj",3*ny_gl/2+1);
+  intHost1d  ifaxi ("ifaxi" ,100);
+  intHost1d  ifaxj ("ifaxj" ,100);
+
+  fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
+  if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
+
+  auto xpass = [&] () {
+    for (int k = 0 ; k < nzslab ; k++) {
+      for (int j = 0 ; j < ny_gl ; j++) {
+        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
+          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = f(k,j,i,icrm); }
+          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , isign );
+          for (int i=0 ; i < nx2 ; i++) { f(k,j,i,icrm) = ftmp_x(i); }
+        }
+      }
+    }
+  };
+  auto ypass = [&] () {
+    for (int k = 0 ; k < nzslab ; k++) {
+      for (int i = 0 ; i < nx_gl+1 ; i++) {
+        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
+          for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = f(k,j,i,icrm); }
+          fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , isign );
+          for (int j=0 ; j < ny2 ; j++) { f(k,j,i,icrm) = ftmp_y(j); }
+        }
+      }
+    }
+  };
+
+  if (isign == -1) {
+    xpass();
+    if (RUN3D) { ypass(); }
+  } else {
+    if (RUN3D) { ypass(); }
+    xpass();
+  }
+}
+
+
+// Maximum absolute difference over the entries that hold data: the grid points
+// after an inverse transform, and the coefficients after a forward transform
+real max_diff(realHost4d const &f1, realHost4d const &f2, bool spectral) {
+  int nxmax = spectral ? nx+1 : nx;
+  int nymax = spectral ? (RUN3D ? ny+1 : 1) : ny;
+  real diff = 0;
+  for (int k=0; k<f1.extent(0); k++) {
+    for (int j=0; j<nymax; j++) {
+      for (int i=0; i<nxmax; i++) {
+        for (int icrm=0; icrm<f1.extent(3); icrm++) {
+          diff = max( diff , abs(f1(k,j,i,icrm)-f2(k,j,i,icrm)) );
+        }
+      }
+    }
+  }
+  return diff;
+}
+
+
+int main() {
+  int nerr = 0;
+  yakl::init();
+  {
+    int  constexpr ncrms = NCRMS;
+    int  nx2 = nx+2;
+    int  ny2 = ny+2*YES3D;
+    real constexpr tol = 1.e-12;
+
+    CRMRealFFT<nx>              fftx;
+    CRMRealFFT<(ny>1 ? ny : 2)> ffty;
+
+    realHost4d fInit("fInit",nzm,ny2,nx2,ncrms);
+    yakl::memset(fInit,0.);
+    for (int k=0; k<nzm; k++) {
+      for (int j=0; j<ny; j++) {
+        for (int i=0; i<nx; i++) {
+          for (int icrm=0; icrm<ncrms; icrm++) {
+            fInit(k,j,i,icrm) = static_cast<real>(rand()) / static_cast<real>(RAND_MAX) - 0.5;
+          }
+        }
+      }
+    }
+
+    // Reference answers and timings from fft991_crm
+    realHost4d fRef("fRef",nzm,ny2,nx2,ncrms);
+    fInit.deep_copy_to(fRef);
+    fft991_all(fRef,-1);
+    realHost4d fSpec = fRef.createHostCopy();
+    fft991_all(fRef,+1);
+
+    realHost4d fTmp = fInit.createHostCopy();
+    auto start = std::chrono::steady_clock::now();
+    for (int n=0; n<ntimes; n++) {
+      fft991_all(fTmp,-1);
+      fft991_all(fTmp,+1);
+    }
+    double time_fft991 = elapsed(start) / ntimes;
+
+    // Batched transforms
+    real4d f = fInit.createDeviceCopy();
+    fftx.forward_real(f, 2);
+    if (RUN3D) { ffty.forward_real(f, 1); }
+    realHost4d fSpecBatched = f.createHostCopy();
+    if (RUN3D) { ffty.inverse_real(f, 1); }
+    fftx.inverse_real(f, 2);
+    realHost4d fBatched = f.createHostCopy();
+
+    yakl::fence();
+    start = std::chrono::steady_clock::now();
+    for (int n=0; n<ntimes; n++) {
+      fftx.forward_real(f, 2);
+      if (RUN3D) { ffty.forward_real(f, 1); }
+      if (RUN3D) { ffty.inverse_real(f, 1); }
+      fftx.inverse_real(f, 2);
+    }
+    yakl::fence();
+    double time_batched = elapsed(start) / ntimes;
+
+    real diff_spec  = max_diff(fSpec , fSpecBatched , true );
+    real diff_grid  = max_diff(fRef  , fBatched     , false);
+    real diff_round = max_diff(fInit , fBatched     , false);
+
+    std::cout << std::scientific;
+    std::cout << "nx, ny, nzm, ncrms: " << nx << " " << ny << " " << nzm << " " << ncrms << "\n";
+    std::cout << "Forward vs fft991_crm:   " << diff_spec  << (diff_spec  <= tol ? "  PASS" : "  FAIL") << "\n";
+    std::cout << "Inverse vs fft991_crm:   " << diff_grid  << (diff_grid  <= tol ? "  PASS" : "  FAIL") << "\n";
+    std::cout << "Round trip:              " << diff_round << (diff_round <= tol ? "  PASS" : "  FAIL") << "\n";
+    std::cout << "fft991_crm time (s):     " << time_fft991  << "\n";
+    std::cout << "Batched FFT time (s):    " << time_batched << "\n";
+    std::cout << "Speedup:                 " << time_fft991 / time_batched << "\n\n";
+    if (diff_spec > tol || diff_grid > tol || diff_round > tol) { nerr++; }
+
+    fftx.cleanup();
+    ffty.cleanup();
+  }
+  yakl::finalize();
+  if (nerr > 0) { exit(-1); }
+}
+
@@ -14,6 +14,8 @@ void timeloop() {
 
   nstep = 0;
 
+  STAGE_TIMER_START("timeloop");
+
   do {
     nstep = nstep + 1;
 
@@ -21,44 +23,83 @@ void timeloop() {
     //  Check if the dynamical time step should be decreased
     //  to handle the cases when the flow being locally linearly unstable
     //------------------------------------------------------------------
+    STAGE_TIMER_START("kurant");
     kurant();
+    STAGE_TIMER_STOP("kurant");
 
     for(int icyc=1; icyc<=ncycle; icyc++) {
       icycle = icyc;
       dtn = dt/ncycle;
+      STAGE_TIMER_START("bookkeeping");
+#ifdef MMF_FUSED_STAGES
+      // Keep the time step history on the host, where abcoefs() needs it,
+      // and only copy it to the device for adams() and press_rhs()
+      dt3Host(na-1) = dtn;
+      dt3Host.deep_copy_to(dt3);
+#else
       parallel_for( 1 , YAKL_LAMBDA ( int i ) {
         dt3(na-1) = dtn;
       });
+#endif
       dtfactor = dtn/dt;
 
+#ifndef MMF_FUSED_STAGES
       parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
         crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)+1;
       });
+#endif
 
       //---------------------------------------------
       //    the Adams-Bashforth scheme in time
       abcoefs();
+      STAGE_TIMER_STOP("bookkeeping");
 
+      STAGE_TIMER_START("pointwise_stages");
+#ifdef MMF_FUSED_STAGES
+      //---------------------------------------------
+      //    initialize stuff and buoyancy term in a single sweep:
+      STAGE_TIMER_START("fused_zero_buoyancy");
+      fused_zero_buoyancy();
+      STAGE_TIMER_STOP("fused_zero_buoyancy");
+#else
       //---------------------------------------------
       //    initialize stuff:
+      STAGE_TIMER_START("zero");
       zero();
+      STAGE_TIMER_STOP("zero");
 
       //-----------------------------------------------------------
       //       Buoyancy term:
+      STAGE_TIMER_START("buoyancy");
       buoyancy();
+      STAGE_TIMER_STOP("buoyancy");
+#endif
 
       //-----------------------------------------------------------
       // variance transport forcing
       if (use_VT) {
+        STAGE_TIMER_START("VT");
         VT_diagnose();
         VT_forcing();
+        STAGE_TIMER_STOP("VT");
       }
 
+#ifdef MMF_FUSED_STAGES
+      //------------------------------------------------------------
+      //       Large-scale and surface forcing, radiative tendency,
+      //       and damping near the upper boundary:
+      STAGE_TIMER_START("fused_forcing_damping");
+      fused_forcing_damping();
+      STAGE_TIMER_STOP("fused_forcing_damping");
+#else
       //------------------------------------------------------------
       //       Large-scale and surface forcing:
+      STAGE_TIMER_START("forcing");
       forcing();
+      STAGE_TIMER_STOP("forcing");
 
       // Apply radiative tendency
+      STAGE_TIMER_START("radiation");
       // for (int k=0; k<nzm; k++) {
       //   for (int j=0; j<ny; j++) {
       //     for (int i=0; i<nx; i++) {
@@ -68,17 +109,24 @@ void timeloop() {
         int j_rad = j / (ny/crm_ny_rad);
         t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
       });
+      STAGE_TIMER_STOP("radiation");
 
       //----------------------------------------------------------
       //    suppress turbulence near the upper boundary (spange):
       if (dodamping) { 
+        STAGE_TIMER_START("damping");
         damping();
+        STAGE_TIMER_STOP("damping");
       }
+#endif
+      STAGE_TIMER_STOP("pointwise_stages");
 
       //---------------------------------------------------------
       //   Ice fall-out
       if (docloud) { 
+        STAGE_TIMER_START("ice_fall");
         ice_fall();
+        STAGE_TIMER_STOP("ice_fall");
       }
 
       //----------------------------------------------------------
@@ -98,7 +146,9 @@ void timeloop() {
       //-----------------------------------------------------------
       //  SGS physics:
       if (dosgs) {
+        STAGE_TIMER_START("sgs");
         sgs_proc();
+        STAGE_TIMER_STOP("sgs");
       }
 
       //----------------------------------------------------------
@@ -107,7 +157,9 @@ void timeloop() {
 
       //-----------------------------------------------
       //       advection of momentum:
+      STAGE_TIMER_START("advect_mom");
       advect_mom();
+      STAGE_TIMER_STOP("advect_mom");
 
       //----------------------------------------------------------
       //  SGS effects on momentum:
@@ -129,12 +181,16 @@ void timeloop() {
 
       //---------------------------------------------------------
       //       compute rhs of the Poisson equation and solve it for pressure.
+      STAGE_TIMER_START("pressure");
       pressure();
+      STAGE_TIMER_STOP("pressure");
 
       //---------------------------------------------------------
       //       find velocity field at n+1/2 timestep needed for advection of scalars:
       //  Note that at the end of the call, the velocities are in nondimensional form.
+      STAGE_TIMER_START("adams");
       adams();
+      STAGE_TIMER_STOP("adams");
 
       //----------------------------------------------------------
       //     Update boundaries for all prognostic scalar fields for advection:
@@ -142,7 +198,9 @@ void timeloop() {
 
       //---------------------------------------------------------
       //      advection of scalars :
+      STAGE_TIMER_START("advect_scalars");
       advect_all_scalars();
+      STAGE_TIMER_STOP("advect_scalars");
 
       //-----------------------------------------------------------
       //    Convert velocity back from nondimensional form:
@@ -164,7 +222,9 @@ void timeloop() {
       //-----------------------------------------------------------
       //       Cloud condensation/evaporation and precipitation processes:
       if (docloud || dosmoke) {
+        STAGE_TIMER_START("micro");
         micro_proc();
+        STAGE_TIMER_STOP("micro");
       }
 
       //-----------------------------------------------------------
@@ -177,7 +237,9 @@ void timeloop() {
 
       //-----------------------------------------------------------
       //    Compute diagnostics fields:
+      STAGE_TIMER_START("diagnose");
       diagnose();
+      STAGE_TIMER_STOP("diagnose");
 
       //----------------------------------------------------------
       // Rotate the dynamic tendency arrays for Adams-bashforth scheme:
@@ -188,8 +250,21 @@ void timeloop() {
       nb=nn;
     } // icycle
 
+#ifdef MMF_FUSED_STAGES
+    // Count all the subcycles of this step at once
+    YAKL_SCOPE( ncycle , :: ncycle );
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)+ncycle;
+    });
+#endif
+
     post_icycle();
 
   } while (nstep < nstop);
 
+  STAGE_TIMER_STOP("timeloop");
+#ifdef MMF_STAGE_TIMERS
+  stage_timers_print();
+#endif
+
 }
@@ -9,6 +9,8 @@
 #include "buoyancy.h"
 #include "forcing.h"
 #include "damping.h"
+#include "fused_stages.h"
+#include "stage_timers.h"
 #include "ice_fall.h"
 #include "boundaries.h"
 #include "crmsurface.h"
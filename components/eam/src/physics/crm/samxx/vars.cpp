@@ -87,6 +87,7 @@ void allocate() {
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
   dt3              = real1d( "dt3             " , 3                                     ); 
+  dt3Host          = realHost1d( "dt3Host         " , 3                                 ); 
   u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
   v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
   w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
@@ -268,6 +269,7 @@ void allocate() {
   yakl::memset(adzw              ,0.);
   yakl::memset(dz                ,0.);
   yakl::memset(dt3               ,0.);
+  yakl::memset(dt3Host           ,0.);
   yakl::memset(u                 ,0.);
   yakl::memset(v                 ,0.);
   yakl::memset(w                 ,0.);
@@ -552,6 +554,7 @@ void finalize() {
   adzw             = real2d(); 
   dz               = real1d(); 
   dt3              = real1d(); 
+  dt3Host          = realHost1d(); 
   u                = real4d();
   v                = real4d();
   w                = real4d();
@@ -674,6 +677,8 @@ void finalize() {
   vt_fftx.cleanup();
   vt_ffty.cleanup();
   esmt_fftx.cleanup();
+  pressure_batched_fftx.cleanup();
+  pressure_batched_ffty.cleanup();
 }
 
 
@@ -1644,6 +1649,7 @@ real2d presi           ;
 real2d adz             ;
 real2d adzw            ;
 real1d dt3             ;
+realHost1d dt3Host     ;
 real1d dz              ;
 
 real5d sgs_field       ;
@@ -1978,6 +1984,8 @@ yakl::RealFFT1D<real> pressure_ffty;
 yakl::RealFFT1D<real> vt_fftx;
 yakl::RealFFT1D<real> vt_ffty;
 yakl::RealFFT1D<real> esmt_fftx;
+CRMRealFFT<nx>              pressure_batched_fftx;
+CRMRealFFT<(ny>1 ? ny : 2)> pressure_batched_ffty;
 
 
 
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include "crm_fft.h"
 
 
 void allocate();
@@ -354,6 +355,7 @@ extern real2d presi           ;
 extern real2d adz             ;
 extern real2d adzw            ;
 extern real1d dt3             ;
+extern realHost1d dt3Host     ;
 extern real1d dz              ;
 
 extern real2d grdf_x          ;
@@ -557,4 +559,7 @@ extern yakl::RealFFT1D<real> pressure_ffty;
 extern yakl::RealFFT1D<real> vt_fftx;
 extern yakl::RealFFT1D<real> vt_ffty;
 extern yakl::RealFFT1D<real> esmt_fftx;
+// The y transform is never used for 2D CRMs, so only its length must be valid there
+extern CRMRealFFT<nx>              pressure_batched_fftx;
+extern CRMRealFFT<(ny>1 ? ny : 2)> pressure_batched_ffty;
 
@@ -420,9 +420,12 @@ void AtmosphereDriver::create_fields()
 
   // By now, the processes should have fully built the ids of their
   // required/computed fields and groups. Let them register them in the FM
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const bool use_field_arena = driver_options_pl.get<bool>("use_field_arena",false);
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     m_field_mgrs[grid->name()] = std::make_shared<field_mgr_type>(grid);
+    m_field_mgrs[grid->name()]->set_arena_allocation(use_field_arena);
     m_field_mgrs[grid->name()]->registration_begins();
   }
 
@@ -46,8 +46,7 @@ protected:
   ekat::units::Units  m_field_units;
   std::string         m_pres_name;
 
-  view_1d<mPack>      m_p_tgt;
-  Field               m_mask_field;
+  std::vector<Real>   m_p_tgt;
   Real                m_pressure_level;
   int                 m_num_levs;
   int                 m_num_cols;
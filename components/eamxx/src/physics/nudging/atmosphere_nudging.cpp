@@ -1,5 +1,7 @@
 #include "atmosphere_nudging.hpp"
 
+#include "share/io/scream_async_io.hpp"
+
 namespace scream
 {
 
@@ -9,6 +11,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
   datafile=m_params.get<std::string>("Nudging_Filename");
+  m_prefetch=m_params.get<bool>("Nudging_Prefetch",true);
 }
 
 // =========================================================================================
@@ -36,6 +39,7 @@ void Nudging::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   //Now need to read in the file
   scorpio::register_file(datafile,scorpio::Read);
   m_num_src_levs = scorpio::get_dimlen(datafile,"lev");
+  m_num_file_times = scorpio::get_dimlen(datafile,"time");
   double time_value_1= scorpio::read_time_at_index_c2f(datafile.c_str(),1);
   double time_value_2= scorpio::read_time_at_index_c2f(datafile.c_str(),2);
     
@@ -153,6 +157,12 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   Kokkos::deep_copy(NudgingData_aft.qv,fields_ext_h["qv"]);
   NudgingData_aft.time = time_step_file;
 
+  //Start reading the following time step
+  if (m_prefetch) {
+    NudgingData_next.init(m_num_cols,m_num_src_levs,true);
+    NudgingData_next.time = -999;
+    start_prefetch(2);
+  }
 }
 
 void Nudging::time_interpolation (const int time_s) {
@@ -224,15 +234,100 @@ void Nudging::update_time_step (const int time_s)
       std::swap (NudgingData_bef,NudgingData_aft);
       NudgingData_bef.time = NudgingData_aft.time;
 
-      data_input.read_variables(time_index+1);
-      Kokkos::deep_copy(NudgingData_aft.T_mid,fields_ext_h["T_mid"]);
-      Kokkos::deep_copy(NudgingData_aft.p_mid,fields_ext_h["p_mid"]);
-      Kokkos::deep_copy(NudgingData_aft.u,fields_ext_h["u"]);
-      Kokkos::deep_copy(NudgingData_aft.v,fields_ext_h["v"]);
-      Kokkos::deep_copy(NudgingData_aft.qv,fields_ext_h["qv"]);
+      if (m_next_time_index==time_index+1) {
+        //The new after data has been prefetched: just swap buffers
+        finish_prefetch(true);
+        std::swap (NudgingData_aft,NudgingData_next);
+      } else {
+        //We skipped past the prefetched step, so read synchronously.
+        //Wait first, since the prefetch task writes into fields_ext_h.
+        scorpio::AsyncIOWorker::instance().wait();
+        data_input.read_variables(time_index+1);
+        Kokkos::deep_copy(NudgingData_aft.T_mid,fields_ext_h["T_mid"]);
+        Kokkos::deep_copy(NudgingData_aft.p_mid,fields_ext_h["p_mid"]);
+        Kokkos::deep_copy(NudgingData_aft.u,fields_ext_h["u"]);
+        Kokkos::deep_copy(NudgingData_aft.v,fields_ext_h["v"]);
+        Kokkos::deep_copy(NudgingData_aft.qv,fields_ext_h["qv"]);
+      }
       NudgingData_aft.time = time_step_file*(time_index+1);
+
+      //With a worker thread, the read overlaps with the rest of this step.
+      //Otherwise, the read runs inline: request it at the next step instead,
+      //so that it does not add to the step that crosses the file time.
+      if (m_prefetch) {
+        if (scorpio::AsyncIOWorker::instance().is_threaded()) {
+          start_prefetch(time_index+2);
+        } else {
+          m_next_time_index = -1;
+          m_pending_time_index = time_index+2;
+        }
+      }
     }
-  
+  else
+    {
+      if (m_pending_time_index>=0) {
+        start_prefetch(m_pending_time_index);
+        m_pending_time_index = -1;
+      }
+      //Move the prefetched data to device as soon as it is available,
+      //so that it is not done during the step that needs it
+      finish_prefetch(false);
+    }
+}
+
+// =========================================================================================
+void Nudging::start_prefetch (const int time_index)
+{
+  auto& worker = scorpio::AsyncIOWorker::instance();
+
+  //The previous request may still be writing into fields_ext_h
+  if (m_next_read_done and not *m_next_read_done) {
+    worker.wait();
+  }
+
+  if (time_index>=m_num_file_times) {
+    //Nothing left to read. If the run goes past the end of the file,
+    //update_time_step will fail trying to read it synchronously.
+    m_next_time_index = -1;
+    return;
+  }
+
+  m_next_time_index = time_index;
+  m_next_copied = false;
+  m_next_read_done = std::make_shared<std::atomic<bool>>(false);
+
+  //Note: data_input and fields_ext_h are members, so the task must complete
+  //      before this process is destroyed (see finalize_impl)
+  auto done = m_next_read_done;
+  worker.enqueue([this,done,time_index]() {
+    data_input.read_variables(time_index);
+    *done = true;
+  });
+}
+
+// =========================================================================================
+bool Nudging::finish_prefetch (const bool block)
+{
+  if (m_next_time_index<0) {
+    return false;
+  }
+
+  if (not m_next_copied) {
+    if (not *m_next_read_done) {
+      if (not block) {
+        return false;
+      }
+      //If the read failed, this will rethrow the exception
+      scorpio::AsyncIOWorker::instance().wait();
+    }
+    Kokkos::deep_copy(NudgingData_next.T_mid,fields_ext_h["T_mid"]);
+    Kokkos::deep_copy(NudgingData_next.p_mid,fields_ext_h["p_mid"]);
+    Kokkos::deep_copy(NudgingData_next.u,fields_ext_h["u"]);
+    Kokkos::deep_copy(NudgingData_next.v,fields_ext_h["v"]);
+    Kokkos::deep_copy(NudgingData_next.qv,fields_ext_h["qv"]);
+    m_next_copied = true;
+  }
+  return true;
 }
 
   
@@ -346,6 +441,8 @@ void Nudging::run_impl (const double dt)
 // =========================================================================================
 void Nudging::finalize_impl()
 {
+  //Make sure the background read (if any) is over before releasing the input
+  scorpio::AsyncIOWorker::instance().wait();
   data_input.finalize();
 }
 
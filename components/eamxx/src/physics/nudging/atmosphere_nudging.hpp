@@ -14,6 +14,8 @@
 #include "share/util/scream_time_stamp.hpp"
 #include "physics/nudging/nudging_functions.hpp"
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 namespace scream
@@ -63,6 +65,13 @@ public:
   //Time interpolation function
   void time_interpolation(const int time_s);
 
+  //Read a time slice from file in the background
+  void start_prefetch(const int time_index);
+
+  //Copy the prefetched slice into NudgingData_next, if the read is over
+  //(or always, if block=true). Returns true if NudgingData_next is ready.
+  bool finish_prefetch(const bool block);
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
@@ -81,6 +90,7 @@ protected:
   int m_num_cols; 
   int m_num_levs;
   int m_num_src_levs;
+  int m_num_file_times;
   int time_step_file;
   std::string datafile;
   std::map<std::string,view_1d_host<Real>> host_views;
@@ -96,6 +106,16 @@ protected:
   TimeStamp ts0;
   NudgingFunc::NudgingData NudgingData_bef;
   NudgingFunc::NudgingData NudgingData_aft;
+  // The slice following NudgingData_aft, read in the background while
+  // the current interval runs, so that crossing it only swaps buffers
+  NudgingFunc::NudgingData NudgingData_next;
+  bool m_prefetch;
+  int m_next_time_index = -1;
+  // Slice to request at the next step (-1 if none), when the read cannot
+  // run in the background
+  int m_pending_time_index = -1;
+  bool m_next_copied = false;
+  std::shared_ptr<std::atomic<bool>> m_next_read_done;
   AtmosphereInput data_input;
 }; // class Nudging
 
@@ -350,6 +350,59 @@ TEST_CASE("nudging") {
 }
 
 nudging_mid->finalize();
-  
+
+  //Prefetching the next time slice in the background must not change the
+  //results. Run long enough to cross several time slices of the file.
+  auto run_nudging = [&](const bool prefetch) {
+    ekat::ParameterList params;
+    params.set<std::string>("Nudging_Filename",nudging_f);
+    params.set<bool>("Nudging_Prefetch",prefetch);
+    auto nudging = std::make_shared<Nudging>(io_comm,params);
+    nudging->set_grids(gm);
+
+    std::map<std::string,Field> fields;
+    for (const auto& req : nudging->get_required_field_requests()) {
+      Field f(req.fid);
+      f.get_header().get_alloc_properties().request_allocation(1);
+      f.allocate_view();
+      f.deep_copy(0);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      nudging->set_required_field(f);
+      if (f.name()!="p_mid") {
+        nudging->set_computed_field(f);
+      }
+      fields.emplace(f.name(),f);
+    }
+    auto p_mid_h = fields["p_mid"].get_view<Real**,Host>();
+    for (int icol=0; icol<ncols; icol++){
+      for (int ilev=0; ilev<nlevs; ilev++){
+        p_mid_h(icol,ilev) = 2*ilev;
+      }
+    }
+    fields["p_mid"].sync_to_dev();
+
+    nudging->initialize(t0,RunType::Initial);
+
+    //24 timesteps of 100 s, with a new file time slice every 250 s
+    std::vector<std::vector<Real>> results;
+    for (int step=0; step<24; ++step) {
+      nudging->run(100);
+      for (const auto& fname : {"T_mid","qv","u","v"}) {
+        auto f = fields.at(fname);
+        f.sync_to_host();
+        auto v_h = f.get_view<const Real**,Host>();
+        results.emplace_back(v_h.data(),v_h.data()+v_h.size());
+      }
+    }
+    nudging->finalize();
+    return results;
+  };
+
+  const auto ref = run_nudging(false);
+  const auto tgt = run_nudging(true);
+  REQUIRE (ref.size()==tgt.size());
+  for (size_t i=0; i<ref.size(); ++i) {
+    REQUIRE (ref[i]==tgt[i]);
+  }
 }
 
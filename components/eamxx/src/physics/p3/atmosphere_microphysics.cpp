@@ -47,6 +47,9 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = m_params.get<bool>("do_predict_nc",true); 
   infrastructure.prescribedCCN = m_params.get<bool>("do_prescribed_ccn",true); 
+  infrastructure.compact_columns = m_params.get<bool>("compact_active_columns",false);
+  infrastructure.sed_work_scheduling = m_params.get<bool>("sed_work_scheduling",false);
+  m_report_sed_substeps = m_params.get<bool>("report_sed_substeps",false);
 
   // Define the different field layouts that will be used for this process
   using namespace ShortFieldTagsNames;
@@ -297,6 +300,14 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   diag_outputs.precip_ice_flux  = m_buffer.precip_ice_flux;
   // -- Infrastructure, what is left to assign
   infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
+  if (infrastructure.sed_work_scheduling || m_report_sed_substeps) {
+    // Must persist across steps, since p3_main uses the counts of the previous step as work estimate
+    infrastructure.sed_substeps = decltype(infrastructure.sed_substeps)("sed_substeps",m_num_cols);
+  }
+  if (infrastructure.compact_columns || infrastructure.sed_work_scheduling) {
+    infrastructure.col_ids     = decltype(infrastructure.col_ids)("col_ids",m_num_cols);
+    infrastructure.col_ids_tmp = decltype(infrastructure.col_ids_tmp)("col_ids_tmp",m_num_cols);
+  }
   // --History Only
   history_only.liq_ice_exchange = get_field_out("micro_liq_ice_exchange").get_view<Pack**>();
   history_only.vap_liq_exchange = get_field_out("micro_vap_liq_exchange").get_view<Pack**>();
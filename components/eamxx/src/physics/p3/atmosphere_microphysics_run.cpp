@@ -1,5 +1,8 @@
 #include "physics/p3/atmosphere_microphysics.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace scream {
 
 void P3Microphysics::run_impl (const double dt)
@@ -31,6 +34,27 @@ void P3Microphysics::run_impl (const double dt)
   P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
                history_only, lookup_tables, workspace_mgr, m_num_cols, m_num_levs);
 
+  if (m_report_sed_substeps) {
+    const auto sed_substeps = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),infrastructure.sed_substeps);
+    std::vector<int> counts(P3F::num_sed_work_bins,0);
+    int max_substeps = 0;
+    for (int i=0; i<m_num_cols; ++i) {
+      ++counts[P3F::sed_work_bin(sed_substeps(i))];
+      max_substeps = std::max(max_substeps,sed_substeps(i));
+    }
+    std::string msg = "[P3::run_impl] Sedimentation substeps per column (step " + std::to_string(infrastructure.it) + "):\n";
+    msg += "  - 0: " + std::to_string(counts[0]) + "\n";
+    for (int bin=1; bin<P3F::num_sed_work_bins; ++bin) {
+      const int lo = 1 << (bin-1);
+      const std::string range = bin<P3F::num_sed_work_bins-1
+                              ? "[" + std::to_string(lo) + "," + std::to_string(2*lo) + ")"
+                              : ">=" + std::to_string(lo);
+      msg += "  - " + range + ": " + std::to_string(counts[bin]) + "\n";
+    }
+    msg += "  - max: " + std::to_string(max_substeps) + "\n";
+    this->log(LogLevel::debug,msg);
+  }
+
   // Conduct the post-processing of the p3_main output.
   Kokkos::parallel_for(
     "p3_main_local_vals",
@@ -13,7 +13,7 @@ namespace p3 {
 
 template <typename S, typename D>
 KOKKOS_FUNCTION
-void Functions<S,D>
+Int Functions<S,D>
 ::cloud_sedimentation(
     const uview_1d<Spack>& qc_incld,
     const uview_1d<const Spack>& rho,
@@ -56,6 +56,7 @@ void Functions<S,D>
   constexpr Scalar bcn    = C::bcn;
   bool log_qxpresent;
   const Int k_qxtop = find_top(team, sqc, qsmall, kbot, ktop, kdir, log_qxpresent);
+  Int nsubsteps = 0;
 
   if (log_qxpresent) {
     Scalar dt_left = dt;    // time remaining for sedi over full model (mp) time step
@@ -65,6 +66,7 @@ void Functions<S,D>
     Int k_qxbot = find_bottom(team, sqc, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
 
     while (dt_left > C::dt_left_tol) {
+      ++nsubsteps;
       Scalar Co_max = 0.0;
       Int kmin, kmax;
       const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
@@ -144,6 +146,8 @@ void Functions<S,D>
 
   workspace.template release_many_contiguous<4>(
     {&V_qc, &V_nc, &flux_qx, &flux_nx});
+
+  return nsubsteps;
 }
 
 } // namespace p3
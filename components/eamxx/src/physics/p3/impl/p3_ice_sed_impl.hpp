@@ -64,7 +64,7 @@ Functions<S,D>
 
 template <typename S, typename D>
 KOKKOS_FUNCTION
-void Functions<S,D>
+Int Functions<S,D>
 ::ice_sedimentation(
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -104,6 +104,7 @@ void Functions<S,D>
   constexpr Scalar nsmall = C::NSMALL;
   bool log_qxpresent;
   const Int k_qxtop = find_top(team, sqi, qsmall, kbot, ktop, kdir, log_qxpresent);
+  Int nsubsteps = 0;
 
   if (log_qxpresent) {
     Scalar dt_left   = dt;  // time remaining for sedi over full model (mp) time step
@@ -113,6 +114,7 @@ void Functions<S,D>
     Int k_qxbot = find_bottom(team, sqi, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
 
     while (dt_left > C::dt_left_tol) {
+      ++nsubsteps;
       Scalar Co_max = 0.0;
       Int kmin, kmax;
       const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
@@ -197,6 +199,8 @@ void Functions<S,D>
 
   workspace.template release_many_contiguous<6>(
     {&V_qit, &V_nit, &flux_nit, &flux_bir, &flux_qir, &flux_qit});
+
+  return nsubsteps;
 }
 
 template <typename S, typename D>
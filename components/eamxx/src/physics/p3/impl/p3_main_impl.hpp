@@ -69,6 +69,134 @@ void Functions<S,D>
   team.team_barrier();
 }
 
+template <typename S, typename D>
+Int Functions<S,D>
+::p3_main_find_active_columns(
+  const P3PrognosticState& prognostic_state,
+  const P3DiagnosticInputs& diagnostic_inputs,
+  const view_1d<Int>& col_ids,
+  const view_1d<Int>& active,
+  Int nj,
+  Int nk)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using RangePolicy = Kokkos::RangePolicy<ExeSpace>;
+
+  constexpr Scalar T_zerodegc = C::T_zerodegc;
+  constexpr Scalar qsmall     = C::QSMALL;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+
+  // Same checks as in p3_main_part1, but without modifying the state
+  Kokkos::parallel_for(
+    "p3 find active columns",
+    policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+
+    const Int i = team.league_rank();
+
+    const auto pres      = ekat::subview(diagnostic_inputs.pres, i);
+    const auto inv_exner = ekat::subview(diagnostic_inputs.inv_exner, i);
+    const auto th_atm    = ekat::subview(prognostic_state.th, i);
+    const auto qv        = ekat::subview(prognostic_state.qv, i);
+    const auto qc        = ekat::subview(prognostic_state.qc, i);
+    const auto qr        = ekat::subview(prognostic_state.qr, i);
+    const auto qi        = ekat::subview(prognostic_state.qi, i);
+
+    Int is_active = 0;
+    Kokkos::parallel_reduce(
+      Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k, Int& lactive) {
+
+      const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+      const auto range_mask = range_pack < nk;
+
+      const Spack T_atm = th_atm(k) / inv_exner(k);
+      const Spack qv_sat_i = physics::qv_sat(T_atm, pres(k), true, range_mask, physics::MurphyKoop, "p3::p3_main_find_active_columns");
+      const Spack qv_supersat_i = qv(k) / qv_sat_i - 1;
+
+      const auto nucleation = T_atm < T_zerodegc && qv_supersat_i >= -0.05;
+      const auto hydrometeors = qc(k) >= qsmall || qr(k) >= qsmall || qi(k) >= qsmall;
+      if ( (range_mask && (nucleation || hydrometeors)).any() ) {
+        lactive = 1;
+      }
+    }, Kokkos::Max<Int>(is_active));
+
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      active(i) = is_active;
+    });
+  });
+
+  // Active columns first, then inactive ones, both in increasing order
+  Int num_active = 0;
+  Kokkos::parallel_scan(
+    "p3 compact active columns",
+    RangePolicy(0, nj),
+    KOKKOS_LAMBDA(const Int i, Int& offset, const bool final) {
+    if (active(i)) {
+      if (final) {
+        col_ids(offset) = i;
+      }
+      ++offset;
+    }
+  }, num_active);
+
+  Kokkos::parallel_scan(
+    "p3 compact inactive columns",
+    RangePolicy(0, nj),
+    KOKKOS_LAMBDA(const Int i, Int& offset, const bool final) {
+    if (!active(i)) {
+      if (final) {
+        col_ids(num_active + offset) = i;
+      }
+      ++offset;
+    }
+  });
+  Kokkos::fence();
+
+  return num_active;
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::p3_main_sort_columns_by_sed_work(
+  const view_1d<Int>& col_ids,
+  const view_1d<const Int>& sed_substeps,
+  const view_1d<Int>& sorted,
+  Int col_beg,
+  Int col_end)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using RangePolicy = Kokkos::RangePolicy<ExeSpace>;
+
+  const Int ncols = col_end - col_beg;
+  if (ncols <= 1) {
+    return;
+  }
+
+  // Counting sort on the work bin, heaviest bin first
+  Int offset = 0;
+  for (Int bin = num_sed_work_bins-1; bin >= 0; --bin) {
+    Int count = 0;
+    Kokkos::parallel_scan(
+      "p3 sort columns by sed work",
+      RangePolicy(0, ncols),
+      KOKKOS_LAMBDA(const Int j, Int& loffset, const bool final) {
+      const Int i = col_ids(col_beg + j);
+      if (sed_work_bin(sed_substeps(i)) == bin) {
+        if (final) {
+          sorted(offset + loffset) = i;
+        }
+        ++loffset;
+      }
+    }, count);
+    offset += count;
+  }
+
+  Kokkos::deep_copy(Kokkos::subview(col_ids, Kokkos::make_pair(col_beg, col_end)),
+                    Kokkos::subview(sorted, Kokkos::make_pair(0, ncols)));
+}
+
 template <typename S, typename D>
 Int Functions<S,D>
 ::p3_main(
@@ -89,7 +217,6 @@ Int Functions<S,D>
   get_latent_heat(nj, nk, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion);
 
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
 
   // load constants into local vars
   const     Scalar inv_dt          = 1 / infrastructure.dt;
@@ -101,225 +228,296 @@ Int Functions<S,D>
   // per-column bools
   view_2d<bool> bools("bools", nj, 2);
 
-  // we do not want to measure init stuff
-  auto start = std::chrono::steady_clock::now();
-
-  // p3_main loop
-  Kokkos::parallel_for(
-    "p3 main loop",
-    policy,
-    KOKKOS_LAMBDA(const MemberType& team) {
-
-    const Int i = team.league_rank();
-
-    auto workspace = workspace_mgr.get_workspace(team);
-
-    //
-    // Get temporary workspaces needed for p3
-    //
-    uview_1d<Spack>
-      mu_r,   // shape parameter of rain
-      T_atm,      // temperature at the beginning of the microphysics step [K]
-
-      // 2D size distribution and fallspeed parameters
-      lamr, logn0r, nu, cdist, cdist1, cdistr,
-
-      // Variables needed for in-cloud calculations
-      inv_cld_frac_i, inv_cld_frac_l, inv_cld_frac_r, // Inverse cloud fractions (1/cld)
-      qc_incld, qr_incld, qi_incld, qm_incld, // In cloud mass-mixing ratios
-      nc_incld, nr_incld, ni_incld, bm_incld, // In cloud number concentrations
-
-      // Other
-      inv_dz, inv_rho, ze_ice, ze_rain, prec, rho,
-      rhofacr, rhofaci, acn, qv_sat_l, qv_sat_i, sup, qv_supersat_i,
-      tmparr1, exner, diag_equiv_reflectivity, diag_vm_qi, diag_diam_qi, pratot, prctot,
-
-      // p3_tend_out, may not need these
-      qtend_ignore, ntend_ignore,
-
-      // Variables still used in F90 but removed from C++ interface
-      mu_c, lamc, precip_total_tend, nevapr, qr_evap_tend;
-
-    workspace.template take_many_and_reset<46>(
-      {
-        "mu_r", "T_atm", "lamr", "logn0r", "nu", "cdist", "cdist1", "cdistr",
-        "inv_cld_frac_i", "inv_cld_frac_l", "inv_cld_frac_r", "qc_incld", "qr_incld", "qi_incld", "qm_incld",
-        "nc_incld", "nr_incld", "ni_incld", "bm_incld",
-        "inv_dz", "inv_rho", "ze_ice", "ze_rain", "prec", "rho",
-        "rhofacr", "rhofaci", "acn", "qv_sat_l", "qv_sat_i", "sup", "qv_supersat_i",
-        "tmparr1", "exner", "diag_equiv_reflectivity", "diag_vm_qi", "diag_diam_qi",
-        "pratot", "prctot", "qtend_ignore", "ntend_ignore",
-        "mu_c", "lamc", "precip_total_tend", "nevapr", "qr_evap_tend"
-      },
-      {
-        &mu_r, &T_atm, &lamr, &logn0r, &nu, &cdist, &cdist1, &cdistr,
-        &inv_cld_frac_i, &inv_cld_frac_l, &inv_cld_frac_r, &qc_incld, &qr_incld, &qi_incld, &qm_incld,
-        &nc_incld, &nr_incld, &ni_incld, &bm_incld,
-        &inv_dz, &inv_rho, &ze_ice, &ze_rain, &prec, &rho,
-        &rhofacr, &rhofaci, &acn, &qv_sat_l, &qv_sat_i, &sup, &qv_supersat_i,
-        &tmparr1, &exner, &diag_equiv_reflectivity, &diag_vm_qi, &diag_diam_qi,
-        &pratot, &prctot, &qtend_ignore, &ntend_ignore, 
-        &mu_c, &lamc, &precip_total_tend, &nevapr, &qr_evap_tend
-      });
-      
-    // Get single-column subviews of all inputs, shouldn't need any i-indexing
-    // after this.
-    const auto opres               = ekat::subview(diagnostic_inputs.pres, i);
-    const auto odz                 = ekat::subview(diagnostic_inputs.dz, i);
-    const auto onc_nuceat_tend     = ekat::subview(diagnostic_inputs.nc_nuceat_tend, i);
-    const auto onccn_prescribed    = ekat::subview(diagnostic_inputs.nccn, i);
-    const auto oni_activated       = ekat::subview(diagnostic_inputs.ni_activated, i);
-    const auto oinv_qc_relvar      = ekat::subview(diagnostic_inputs.inv_qc_relvar, i);
-    const auto odpres              = ekat::subview(diagnostic_inputs.dpres, i);
-    const auto oinv_exner          = ekat::subview(diagnostic_inputs.inv_exner, i);
-    const auto ocld_frac_i         = ekat::subview(diagnostic_inputs.cld_frac_i, i);
-    const auto ocld_frac_l         = ekat::subview(diagnostic_inputs.cld_frac_l, i);
-    const auto ocld_frac_r         = ekat::subview(diagnostic_inputs.cld_frac_r, i);
-    const auto ocol_location       = ekat::subview(infrastructure.col_location, i);
-    const auto oqc                 = ekat::subview(prognostic_state.qc, i);
-    const auto onc                 = ekat::subview(prognostic_state.nc, i);
-    const auto oqr                 = ekat::subview(prognostic_state.qr, i);
-    const auto onr                 = ekat::subview(prognostic_state.nr, i);
-    const auto oqi                 = ekat::subview(prognostic_state.qi, i);
-    const auto oqm                 = ekat::subview(prognostic_state.qm, i);
-    const auto oni                 = ekat::subview(prognostic_state.ni, i);
-    const auto obm                 = ekat::subview(prognostic_state.bm, i);
-    const auto oqv                 = ekat::subview(prognostic_state.qv, i);
-    const auto oth                 = ekat::subview(prognostic_state.th, i);
-    const auto odiag_eff_radius_qc = ekat::subview(diagnostic_outputs.diag_eff_radius_qc, i);
-    const auto odiag_eff_radius_qi = ekat::subview(diagnostic_outputs.diag_eff_radius_qi, i);
-    const auto oqv2qi_depos_tend   = ekat::subview(diagnostic_outputs.qv2qi_depos_tend, i);
-    const auto orho_qi             = ekat::subview(diagnostic_outputs.rho_qi, i);
-    const auto oprecip_liq_flux    = ekat::subview(diagnostic_outputs.precip_liq_flux, i);
-    const auto oprecip_ice_flux    = ekat::subview(diagnostic_outputs.precip_ice_flux, i);
-    const auto oliq_ice_exchange   = ekat::subview(history_only.liq_ice_exchange, i);
-    const auto ovap_liq_exchange   = ekat::subview(history_only.vap_liq_exchange, i);
-    const auto ovap_ice_exchange   = ekat::subview(history_only.vap_ice_exchange, i);
-    const auto olatent_heat_vapor  = ekat::subview(latent_heat_vapor, i);
-    const auto olatent_heat_sublim = ekat::subview(latent_heat_sublim, i);
-    const auto olatent_heat_fusion = ekat::subview(latent_heat_fusion, i);
-    const auto oqv_prev            = ekat::subview(diagnostic_inputs.qv_prev, i);
-    const auto ot_prev             = ekat::subview(diagnostic_inputs.t_prev, i);
-
-    // Need to watch out for race conditions with these shared variables
-    bool &nucleationPossible  = bools(i, 0);
-    bool &hydrometeorsPresent = bools(i, 1);
-
-    view_1d_ptr_array<Spack, 36> zero_init = {
-      &mu_r, &lamr, &logn0r, &nu, &cdist, &cdist1, &cdistr,
-      &qc_incld, &qr_incld, &qi_incld, &qm_incld,
-      &nc_incld, &nr_incld, &ni_incld, &bm_incld,
-      &inv_rho, &prec, &rho, &rhofacr, &rhofaci, &acn, &qv_sat_l, &qv_sat_i, &sup, &qv_supersat_i,
-      &tmparr1, &qtend_ignore, &ntend_ignore,
-      &mu_c, &lamc, &orho_qi, &oqv2qi_depos_tend, &precip_total_tend, &nevapr, &oprecip_liq_flux, &oprecip_ice_flux
-    };
-
-    // initialize
-    p3_main_init(
-      team, nk_pack,
-      ocld_frac_i, ocld_frac_l, ocld_frac_r, oinv_exner, oth, odz, diag_equiv_reflectivity,
-      ze_ice, ze_rain, odiag_eff_radius_qc, odiag_eff_radius_qi, inv_cld_frac_i, inv_cld_frac_l,
-      inv_cld_frac_r, exner, T_atm, oqv, inv_dz,
-      diagnostic_outputs.precip_liq_surf(i), diagnostic_outputs.precip_ice_surf(i), zero_init);
-
-    p3_main_part1(
-      team, nk, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt,
-      opres, odpres, odz, onc_nuceat_tend, onccn_prescribed, oinv_exner, exner, inv_cld_frac_l, inv_cld_frac_i,
-      inv_cld_frac_r, olatent_heat_vapor, olatent_heat_sublim, olatent_heat_fusion,
-      T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr,
-      rhofaci, acn, oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm,
-      obm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
-      ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent);
-
-    // There might not be any work to do for this team
-    if (!(nucleationPossible || hydrometeorsPresent)) {
-      return; // this is how you do a "continue" in a kokkos lambda
+  // If compaction is on, the columns where microphysics may be active are
+  // processed in a first launch, and the (cheap) remaining ones in a second
+  // launch, so that clear columns do not compete for teams with the expensive
+  // ones. Columns are then processed in the order given by col_ids, which is
+  // only needed if columns are reordered at all.
+  const bool reorder_columns = infrastructure.compact_columns || infrastructure.sed_work_scheduling;
+  view_1d<Int> col_ids, col_ids_tmp;
+  if (reorder_columns) {
+    col_ids     = infrastructure.col_ids;
+    col_ids_tmp = infrastructure.col_ids_tmp;
+    if (col_ids.extent_int(0) < nj) {
+      col_ids = view_1d<Int>("col_ids", nj);
+    }
+    if (col_ids_tmp.extent_int(0) < nj) {
+      col_ids_tmp = view_1d<Int>("col_ids_tmp", nj);
     }
+  }
 
-    // ------------------------------------------------------------------------------------------
-    // main k-loop (for processes):
-
-    p3_main_part2(
-      team, nk_pack, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
-      lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, lookup_tables.revap_table_vals, opres, odpres, odz, onc_nuceat_tend, oinv_exner,
-      exner, inv_cld_frac_l, inv_cld_frac_i, inv_cld_frac_r, oni_activated, oinv_qc_relvar, ocld_frac_i,
-      ocld_frac_l, ocld_frac_r, oqv_prev, ot_prev, T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr, rhofaci, acn,
-      oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm, obm, olatent_heat_vapor,
-      olatent_heat_sublim, olatent_heat_fusion, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld,
-      nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
-      mu_r, lamr, logn0r, oqv2qi_depos_tend, precip_total_tend, nevapr, qr_evap_tend,
-      ovap_liq_exchange, ovap_ice_exchange, oliq_ice_exchange,
-      pratot, prctot, hydrometeorsPresent, nk);
-
-    //NOTE: At this point, it is possible to have negative (but small) nc, nr, ni.  This is not
-    //      a problem; those values get clipped to zero in the sedimentation section (if necessary).
-    //      (This is not done above simply for efficiency purposes.)
-
-    if (!hydrometeorsPresent) return;
-
-    // -----------------------------------------------------------------------------------------
-    // End of main microphysical processes section
-    // =========================================================================================
-
-    // ==========================================================================================!
-    // Sedimentation:
-
-    // Cloud sedimentation:  (adaptive substepping)
-
-    cloud_sedimentation(
-      qc_incld, rho, inv_rho, ocld_frac_l, acn, inv_dz, lookup_tables.dnu_table_vals, team, workspace,
-      nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
-      oqc, onc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf(i));
-
-    // Rain sedimentation:  (adaptive substepping)
-    rain_sedimentation(
-      rho, inv_rho, rhofacr, ocld_frac_r, inv_dz, qr_incld, team, workspace,
-      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, oqr,
-      onr, nr_incld, mu_r, lamr, oprecip_liq_flux, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf(i));
-
-    // Ice sedimentation:  (adaptive substepping)
-    ice_sedimentation(
-      rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop, kbot,
-      kdir, infrastructure.dt, inv_dt, oqi, qi_incld, oni, ni_incld,
-      oqm, qm_incld, obm, bm_incld, qtend_ignore, ntend_ignore,
-      lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf(i));
-
-    // homogeneous freezing of cloud and rain
-    homogeneous_freezing(
-      T_atm, oinv_exner, olatent_heat_fusion, team, nk, ktop, kbot, kdir, oqc, onc, oqr, onr, oqi,
-      oni, oqm, obm, oth);
-
-    //
-    // final checks to ensure consistency of mass/number
-    // and compute diagnostic fields for output
-    //
-    p3_main_part3(
-      team, nk_pack, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, oinv_exner, ocld_frac_l, ocld_frac_r, ocld_frac_i,
-      rho, inv_rho, rhofaci, oqv, oth, oqc, onc, oqr, onr, oqi, oni,
-      oqm, obm, olatent_heat_vapor, olatent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
-      ovap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, odiag_eff_radius_qi, diag_diam_qi,
-      orho_qi, diag_equiv_reflectivity, odiag_eff_radius_qc);
-
-    //
-    // merge ice categories with similar properties
-
-    //   note:  this should be relocated to above, such that the diagnostic
-    //          ice properties are computed after merging
-
-    // PMC nCat deleted nCat>1 stuff
+  // we do not want to measure init stuff, but column reordering is part of the work
+  auto start = std::chrono::steady_clock::now();
 
-#ifndef NDEBUG
+  Int num_active = nj;
+  if (infrastructure.compact_columns) {
+    num_active = p3_main_find_active_columns(prognostic_state, diagnostic_inputs, col_ids, col_ids_tmp, nj, nk);
+  } else if (reorder_columns) {
     Kokkos::parallel_for(
-      Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
-        tmparr1(k) = oth(k) * exner(k);
+      "p3 col ids",
+      Kokkos::RangePolicy<ExeSpace>(0, nj),
+      KOKKOS_LAMBDA(const Int i) {
+      col_ids(i) = i;
     });
+  }
+  const Int col_ranges[3] = {0, num_active, nj};
+
+  // Within each range, start the columns with the most sedimentation substeps
+  // first, so that the few slow columns do not end up at the tail of the launch.
+  const bool record_sed_work = infrastructure.sed_substeps.size() > 0;
+  if (infrastructure.sed_work_scheduling) {
+    EKAT_REQUIRE_MSG(infrastructure.sed_substeps.extent_int(0) == nj,
+        "Error! Sedimentation work scheduling requires a sed_substeps view of size nj.\n"
+        "  - nj: " << nj << "\n"
+        "  - sed_substeps size: " << infrastructure.sed_substeps.extent_int(0) << "\n");
+    for (Int irange = 0; irange < 2; ++irange) {
+      p3_main_sort_columns_by_sed_work(col_ids, infrastructure.sed_substeps, col_ids_tmp,
+                                       col_ranges[irange], col_ranges[irange+1]);
+    }
+  }
+  if (record_sed_work) {
+    Kokkos::deep_copy(infrastructure.sed_substeps, 0);
+  }
+
+  for (Int irange = 0; irange < 2; ++irange) {
+    const Int col_beg = col_ranges[irange];
+    const Int ncols   = col_ranges[irange+1] - col_beg;
+    if (ncols == 0) {
+      continue;
+    }
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nk_pack);
+
+    // p3_main loop
+    const auto p3_main_loop = KOKKOS_LAMBDA(const MemberType& team) {
+
+      const Int i = reorder_columns ? col_ids(col_beg + team.league_rank()) : col_beg + team.league_rank();
+
+      auto workspace = workspace_mgr.get_workspace(team);
+
+      //
+      // Get temporary workspaces needed for p3
+      //
+      uview_1d<Spack>
+        mu_r,   // shape parameter of rain
+        T_atm,      // temperature at the beginning of the microphysics step [K]
+
+        // 2D size distribution and fallspeed parameters
+        lamr, logn0r, nu, cdist, cdist1, cdistr,
+
+        // Variables needed for in-cloud calculations
+        inv_cld_frac_i, inv_cld_frac_l, inv_cld_frac_r, // Inverse cloud fractions (1/cld)
+        qc_incld, qr_incld, qi_incld, qm_incld, // In cloud mass-mixing ratios
+        nc_incld, nr_incld, ni_incld, bm_incld, // In cloud number concentrations
+
+        // Other
+        inv_dz, inv_rho, ze_ice, ze_rain, prec, rho,
+        rhofacr, rhofaci, acn, qv_sat_l, qv_sat_i, sup, qv_supersat_i,
+        tmparr1, exner, diag_equiv_reflectivity, diag_vm_qi, diag_diam_qi, pratot, prctot,
+
+        // p3_tend_out, may not need these
+        qtend_ignore, ntend_ignore,
+
+        // Variables still used in F90 but removed from C++ interface
+        mu_c, lamc, precip_total_tend, nevapr, qr_evap_tend;
+
+      workspace.template take_many_and_reset<46>(
+        {
+          "mu_r", "T_atm", "lamr", "logn0r", "nu", "cdist", "cdist1", "cdistr",
+          "inv_cld_frac_i", "inv_cld_frac_l", "inv_cld_frac_r", "qc_incld", "qr_incld", "qi_incld", "qm_incld",
+          "nc_incld", "nr_incld", "ni_incld", "bm_incld",
+          "inv_dz", "inv_rho", "ze_ice", "ze_rain", "prec", "rho",
+          "rhofacr", "rhofaci", "acn", "qv_sat_l", "qv_sat_i", "sup", "qv_supersat_i",
+          "tmparr1", "exner", "diag_equiv_reflectivity", "diag_vm_qi", "diag_diam_qi",
+          "pratot", "prctot", "qtend_ignore", "ntend_ignore",
+          "mu_c", "lamc", "precip_total_tend", "nevapr", "qr_evap_tend"
+        },
+        {
+          &mu_r, &T_atm, &lamr, &logn0r, &nu, &cdist, &cdist1, &cdistr,
+          &inv_cld_frac_i, &inv_cld_frac_l, &inv_cld_frac_r, &qc_incld, &qr_incld, &qi_incld, &qm_incld,
+          &nc_incld, &nr_incld, &ni_incld, &bm_incld,
+          &inv_dz, &inv_rho, &ze_ice, &ze_rain, &prec, &rho,
+          &rhofacr, &rhofaci, &acn, &qv_sat_l, &qv_sat_i, &sup, &qv_supersat_i,
+          &tmparr1, &exner, &diag_equiv_reflectivity, &diag_vm_qi, &diag_diam_qi,
+          &pratot, &prctot, &qtend_ignore, &ntend_ignore, 
+          &mu_c, &lamc, &precip_total_tend, &nevapr, &qr_evap_tend
+        });
+      
+      // Get single-column subviews of all inputs, shouldn't need any i-indexing
+      // after this.
+      const auto opres               = ekat::subview(diagnostic_inputs.pres, i);
+      const auto odz                 = ekat::subview(diagnostic_inputs.dz, i);
+      const auto onc_nuceat_tend     = ekat::subview(diagnostic_inputs.nc_nuceat_tend, i);
+      const auto onccn_prescribed    = ekat::subview(diagnostic_inputs.nccn, i);
+      const auto oni_activated       = ekat::subview(diagnostic_inputs.ni_activated, i);
+      const auto oinv_qc_relvar      = ekat::subview(diagnostic_inputs.inv_qc_relvar, i);
+      const auto odpres              = ekat::subview(diagnostic_inputs.dpres, i);
+      const auto oinv_exner          = ekat::subview(diagnostic_inputs.inv_exner, i);
+      const auto ocld_frac_i         = ekat::subview(diagnostic_inputs.cld_frac_i, i);
+      const auto ocld_frac_l         = ekat::subview(diagnostic_inputs.cld_frac_l, i);
+      const auto ocld_frac_r         = ekat::subview(diagnostic_inputs.cld_frac_r, i);
+      const auto ocol_location       = ekat::subview(infrastructure.col_location, i);
+      const auto oqc                 = ekat::subview(prognostic_state.qc, i);
+      const auto onc                 = ekat::subview(prognostic_state.nc, i);
+      const auto oqr                 = ekat::subview(prognostic_state.qr, i);
+      const auto onr                 = ekat::subview(prognostic_state.nr, i);
+      const auto oqi                 = ekat::subview(prognostic_state.qi, i);
+      const auto oqm                 = ekat::subview(prognostic_state.qm, i);
+      const auto oni                 = ekat::subview(prognostic_state.ni, i);
+      const auto obm                 = ekat::subview(prognostic_state.bm, i);
+      const auto oqv                 = ekat::subview(prognostic_state.qv, i);
+      const auto oth                 = ekat::subview(prognostic_state.th, i);
+      const auto odiag_eff_radius_qc = ekat::subview(diagnostic_outputs.diag_eff_radius_qc, i);
+      const auto odiag_eff_radius_qi = ekat::subview(diagnostic_outputs.diag_eff_radius_qi, i);
+      const auto oqv2qi_depos_tend   = ekat::subview(diagnostic_outputs.qv2qi_depos_tend, i);
+      const auto orho_qi             = ekat::subview(diagnostic_outputs.rho_qi, i);
+      const auto oprecip_liq_flux    = ekat::subview(diagnostic_outputs.precip_liq_flux, i);
+      const auto oprecip_ice_flux    = ekat::subview(diagnostic_outputs.precip_ice_flux, i);
+      const auto oliq_ice_exchange   = ekat::subview(history_only.liq_ice_exchange, i);
+      const auto ovap_liq_exchange   = ekat::subview(history_only.vap_liq_exchange, i);
+      const auto ovap_ice_exchange   = ekat::subview(history_only.vap_ice_exchange, i);
+      const auto olatent_heat_vapor  = ekat::subview(latent_heat_vapor, i);
+      const auto olatent_heat_sublim = ekat::subview(latent_heat_sublim, i);
+      const auto olatent_heat_fusion = ekat::subview(latent_heat_fusion, i);
+      const auto oqv_prev            = ekat::subview(diagnostic_inputs.qv_prev, i);
+      const auto ot_prev             = ekat::subview(diagnostic_inputs.t_prev, i);
+
+      // Need to watch out for race conditions with these shared variables
+      bool &nucleationPossible  = bools(i, 0);
+      bool &hydrometeorsPresent = bools(i, 1);
+
+      view_1d_ptr_array<Spack, 36> zero_init = {
+        &mu_r, &lamr, &logn0r, &nu, &cdist, &cdist1, &cdistr,
+        &qc_incld, &qr_incld, &qi_incld, &qm_incld,
+        &nc_incld, &nr_incld, &ni_incld, &bm_incld,
+        &inv_rho, &prec, &rho, &rhofacr, &rhofaci, &acn, &qv_sat_l, &qv_sat_i, &sup, &qv_supersat_i,
+        &tmparr1, &qtend_ignore, &ntend_ignore,
+        &mu_c, &lamc, &orho_qi, &oqv2qi_depos_tend, &precip_total_tend, &nevapr, &oprecip_liq_flux, &oprecip_ice_flux
+      };
+
+      // initialize
+      p3_main_init(
+        team, nk_pack,
+        ocld_frac_i, ocld_frac_l, ocld_frac_r, oinv_exner, oth, odz, diag_equiv_reflectivity,
+        ze_ice, ze_rain, odiag_eff_radius_qc, odiag_eff_radius_qi, inv_cld_frac_i, inv_cld_frac_l,
+        inv_cld_frac_r, exner, T_atm, oqv, inv_dz,
+        diagnostic_outputs.precip_liq_surf(i), diagnostic_outputs.precip_ice_surf(i), zero_init);
+
+      p3_main_part1(
+        team, nk, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt,
+        opres, odpres, odz, onc_nuceat_tend, onccn_prescribed, oinv_exner, exner, inv_cld_frac_l, inv_cld_frac_i,
+        inv_cld_frac_r, olatent_heat_vapor, olatent_heat_sublim, olatent_heat_fusion,
+        T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr,
+        rhofaci, acn, oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm,
+        obm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
+        ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent);
+
+      // There might not be any work to do for this team
+      if (!(nucleationPossible || hydrometeorsPresent)) {
+        return; // this is how you do a "continue" in a kokkos lambda
+      }
+
+      // ------------------------------------------------------------------------------------------
+      // main k-loop (for processes):
+
+      p3_main_part2(
+        team, nk_pack, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
+        lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, lookup_tables.revap_table_vals, opres, odpres, odz, onc_nuceat_tend, oinv_exner,
+        exner, inv_cld_frac_l, inv_cld_frac_i, inv_cld_frac_r, oni_activated, oinv_qc_relvar, ocld_frac_i,
+        ocld_frac_l, ocld_frac_r, oqv_prev, ot_prev, T_atm, rho, inv_rho, qv_sat_l, qv_sat_i, qv_supersat_i, rhofacr, rhofaci, acn,
+        oqv, oth, oqc, onc, oqr, onr, oqi, oni, oqm, obm, olatent_heat_vapor,
+        olatent_heat_sublim, olatent_heat_fusion, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld,
+        nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
+        mu_r, lamr, logn0r, oqv2qi_depos_tend, precip_total_tend, nevapr, qr_evap_tend,
+        ovap_liq_exchange, ovap_ice_exchange, oliq_ice_exchange,
+        pratot, prctot, hydrometeorsPresent, nk);
+
+      //NOTE: At this point, it is possible to have negative (but small) nc, nr, ni.  This is not
+      //      a problem; those values get clipped to zero in the sedimentation section (if necessary).
+      //      (This is not done above simply for efficiency purposes.)
+
+      if (!hydrometeorsPresent) return;
+
+      // -----------------------------------------------------------------------------------------
+      // End of main microphysical processes section
+      // =========================================================================================
+
+      // ==========================================================================================!
+      // Sedimentation:
+
+      // Cloud sedimentation:  (adaptive substepping)
+
+      Int sed_substeps = cloud_sedimentation(
+        qc_incld, rho, inv_rho, ocld_frac_l, acn, inv_dz, lookup_tables.dnu_table_vals, team, workspace,
+        nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
+        oqc, onc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
+        diagnostic_outputs.precip_liq_surf(i));
+
+      // Rain sedimentation:  (adaptive substepping)
+      sed_substeps += rain_sedimentation(
+        rho, inv_rho, rhofacr, ocld_frac_r, inv_dz, qr_incld, team, workspace,
+        lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, oqr,
+        onr, nr_incld, mu_r, lamr, oprecip_liq_flux, qtend_ignore, ntend_ignore,
+        diagnostic_outputs.precip_liq_surf(i));
+
+      // Ice sedimentation:  (adaptive substepping)
+      sed_substeps += ice_sedimentation(
+        rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop, kbot,
+        kdir, infrastructure.dt, inv_dt, oqi, qi_incld, oni, ni_incld,
+        oqm, qm_incld, obm, bm_incld, qtend_ignore, ntend_ignore,
+        lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf(i));
+
+      if (record_sed_work) {
+        Kokkos::single(
+          Kokkos::PerTeam(team), [&] () {
+            infrastructure.sed_substeps(i) = sed_substeps;
+        });
+      }
+
+      // homogeneous freezing of cloud and rain
+      homogeneous_freezing(
+        T_atm, oinv_exner, olatent_heat_fusion, team, nk, ktop, kbot, kdir, oqc, onc, oqr, onr, oqi,
+        oni, oqm, obm, oth);
+
+      //
+      // final checks to ensure consistency of mass/number
+      // and compute diagnostic fields for output
+      //
+      p3_main_part3(
+        team, nk_pack, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, oinv_exner, ocld_frac_l, ocld_frac_r, ocld_frac_i,
+        rho, inv_rho, rhofaci, oqv, oth, oqc, onc, oqr, onr, oqi, oni,
+        oqm, obm, olatent_heat_vapor, olatent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
+        ovap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, odiag_eff_radius_qi, diag_diam_qi,
+        orho_qi, diag_equiv_reflectivity, odiag_eff_radius_qc);
+
+      //
+      // merge ice categories with similar properties
+
+      //   note:  this should be relocated to above, such that the diagnostic
+      //          ice properties are computed after merging
+
+      // PMC nCat deleted nCat>1 stuff
 
-    check_values(oqv, tmparr1, ktop, kbot, infrastructure.it, debug_ABORT, 900,
-                 team, ocol_location);
+#ifndef NDEBUG
+      Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+          tmparr1(k) = oth(k) * exner(k);
+      });
+
+      check_values(oqv, tmparr1, ktop, kbot, infrastructure.it, debug_ABORT, 900,
+                   team, ocol_location);
 #endif
-  });
+    };
+
+    if (infrastructure.sed_work_scheduling) {
+      // Columns are sorted by decreasing work: hand them out to threads one at
+      // a time, rather than in contiguous chunks.
+      using DynamicPolicy = Kokkos::TeamPolicy<ExeSpace, Kokkos::Schedule<Kokkos::Dynamic>>;
+      const DynamicPolicy dyn_policy(ncols, policy.team_size(), policy.impl_vector_length());
+      Kokkos::parallel_for("p3 main loop", dyn_policy, p3_main_loop);
+    } else {
+      Kokkos::parallel_for("p3 main loop", policy, p3_main_loop);
+    }
+  }
   Kokkos::fence();
 
   auto finish = std::chrono::steady_clock::now();
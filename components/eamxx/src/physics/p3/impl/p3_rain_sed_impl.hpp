@@ -35,7 +35,7 @@ void Functions<S,D>
 
 template <typename S, typename D>
 KOKKOS_FUNCTION
-void Functions<S,D>
+Int Functions<S,D>
 ::rain_sedimentation(
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -75,6 +75,7 @@ void Functions<S,D>
   constexpr Scalar qsmall = C::QSMALL;
   bool log_qxpresent;
   const Int k_qxtop = find_top(team, sqr, qsmall, kbot, ktop, kdir, log_qxpresent);
+  Int nsubsteps = 0;
 
   if (log_qxpresent) {
     Scalar dt_left   = dt;  // time remaining for sedi over full model (mp) time step
@@ -84,6 +85,7 @@ void Functions<S,D>
     Int k_qxbot = find_bottom(team, sqr, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
 
     while (dt_left > C::dt_left_tol) {
+      ++nsubsteps;
       Scalar Co_max = 0.0;
       Int kmin, kmax;
       Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
@@ -166,6 +168,8 @@ void Functions<S,D>
 
   workspace.template release_many_contiguous<4>(
     {&V_qr, &V_nr, &flux_qx, &flux_nx});
+
+  return nsubsteps;
 }
 
 } // namespace p3
@@ -205,6 +205,23 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // Set to true to launch the expensive part of p3_main only over the columns
+    // where microphysics may be active (see p3_main_find_active_columns)
+    bool compact_columns = false;
+    // Set to true to start the columns with the most sedimentation substeps
+    // first, and to hand out columns to threads dynamically (see
+    // p3_main_sort_columns_by_sed_work)
+    bool sed_work_scheduling = false;
+    // Optional, nj. On input, the estimated number of sedimentation substeps
+    // of each column, used if sed_work_scheduling is true (the counts from the
+    // previous step work well). On output, the number of cloud+rain+ice
+    // sedimentation substeps taken in each column.
+    view_1d<Int> sed_substeps;
+    // Optional, nj. Scratch space for the column reordering done if
+    // compact_columns or sed_work_scheduling is true. If not provided,
+    // p3_main allocates them at every call.
+    view_1d<Int> col_ids;
+    view_1d<Int> col_ids_tmp;
   };
 
   // This struct stores tendencies computed by P3 and used by other
@@ -384,9 +401,9 @@ struct Functions
     const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
     const view_1d_ptr_array<Spack, nfield>& rs);
 
-  // Cloud sedimentation
+  // Cloud sedimentation. Returns the number of CFL substeps taken.
   KOKKOS_FUNCTION
-  static void cloud_sedimentation(
+  static Int cloud_sedimentation(
     const uview_1d<Spack>& qc_incld,
     const uview_1d<const Spack>& rho,
     const uview_1d<const Spack>& inv_rho,
@@ -407,9 +424,9 @@ struct Functions
     const uview_1d<Spack>& nc_tend,
     Scalar& precip_liq_surf);
 
-  // TODO: comment
+  // Rain sedimentation. Returns the number of CFL substeps taken.
   KOKKOS_FUNCTION
-  static void rain_sedimentation(
+  static Int rain_sedimentation(
     const uview_1d<const Spack>& rho,
     const uview_1d<const Spack>& inv_rho,
     const uview_1d<const Spack>& rhofacr,
@@ -430,9 +447,9 @@ struct Functions
     const uview_1d<Spack>& nr_tend,
     Scalar& precip_liq_surf);
 
-  // TODO: comment
+  // Ice sedimentation. Returns the number of CFL substeps taken.
   KOKKOS_FUNCTION
-  static void ice_sedimentation(
+  static Int ice_sedimentation(
     const uview_1d<const Spack>& rho,
     const uview_1d<const Spack>& inv_rho,
     const uview_1d<const Spack>& rhofaci,
@@ -949,6 +966,42 @@ struct Functions
     const uview_1d<Spack>& diag_equiv_reflectivity,
     const uview_1d<Spack>& diag_eff_radius_qc);
 
+  // Sort column indices so that the columns where p3_main_part1 may find
+  // hydrometeors or possible nucleation come first. Returns the number of such
+  // columns. This is only a scheduling hint: p3_main gives the same results
+  // regardless of how columns are classified. active is scratch space of size nj.
+  static Int p3_main_find_active_columns(
+    const P3PrognosticState& prognostic_state,
+    const P3DiagnosticInputs& diagnostic_inputs,
+    const view_1d<Int>& col_ids,
+    const view_1d<Int>& active,
+    Int nj, // number of columns
+    Int nk); // number of vertical cells per column
+
+  // Work bins used to schedule columns and to report the sedimentation substep
+  // histogram: bin 0 holds columns with no substeps, bin b>0 the columns with
+  // [2^(b-1), 2^b) substeps. The last bin is open ended.
+  static constexpr Int num_sed_work_bins = 8;
+
+  KOKKOS_INLINE_FUNCTION
+  static Int sed_work_bin(const Int nsubsteps) {
+    Int bin = 0;
+    for (Int n = nsubsteps; n > 0 && bin < num_sed_work_bins-1; n /= 2) {
+      ++bin;
+    }
+    return bin;
+  }
+
+  // Reorder col_ids(col_beg:col_end-1) by decreasing work bin of sed_substeps,
+  // keeping the original order within each bin. sorted is scratch space of
+  // size at least col_end-col_beg.
+  static void p3_main_sort_columns_by_sed_work(
+    const view_1d<Int>& col_ids,
+    const view_1d<const Int>& sed_substeps,
+    const view_1d<Int>& sorted,
+    Int col_beg,
+    Int col_end);
+
   // Return microseconds elapsed
   static Int p3_main(
     const P3PrognosticState& prognostic_state,
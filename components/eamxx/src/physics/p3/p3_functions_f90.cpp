@@ -1924,7 +1924,8 @@ Int p3_main_f(
   Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
   Real* diag_eff_radius_qi, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
   Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i,
-  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev,
+  bool compact_columns)
 {
   using P3F  = Functions<Real, DefaultDevice>;
 
@@ -2045,6 +2046,12 @@ Int p3_main_f(
                                         rho_qi_d,precip_liq_flux_d, precip_ice_flux_d};
   P3F::P3Infrastructure infrastructure{dt, it, its, ite, kts, kte,
                                        do_predict_nc, do_prescribed_CCN, col_location_d};
+  infrastructure.compact_columns = compact_columns;
+  if (compact_columns) {
+    // Allocate the scratch here, so that it is not part of the p3_main timing
+    infrastructure.col_ids     = P3F::view_1d<Int>("col_ids", nj);
+    infrastructure.col_ids_tmp = P3F::view_1d<Int>("col_ids_tmp", nj);
+  }
   P3F::P3HistoryOnly history_only{liq_ice_exchange_d, vap_liq_exchange_d,
                                   vap_ice_exchange_d};
 
@@ -119,9 +119,28 @@ FortranData::Ptr make_mixed (const Int ncol, const Int nlev) {
   return dp;
 }
 
+// The mixed case, but only one column out of four is cloudy. The other ones
+// are dry and free of hydrometeors, so that p3 has nothing to do there.
+FortranData::Ptr make_mixed_clear (const Int ncol, const Int nlev) {
+  const auto dp = make_mixed(ncol, nlev);
+  auto& d = *dp;
+
+  for (Int i = 0; i < ncol; ++i) {
+    if (i % 4 == 0) continue;
+    for (Int k = 0; k < nlev; ++k) {
+      d.qc(i,k) = d.qr(i,k) = d.qi(i,k) = 0;
+      d.qm(i,k) = d.bm(i,k) = 0;
+      d.qv(i,k) = d.qv_prev(i,k) = 0;
+    }
+  }
+
+  return dp;
+}
+
 FortranData::Ptr Factory::create (IC ic, Int ncol, Int nlev) {
  switch (ic) {
    case mixed: return make_mixed(ncol, nlev);
+   case mixed_clear: return make_mixed_clear(ncol, nlev);
  default:
    EKAT_REQUIRE_MSG(false, "Not an IC: " << ic);
  }
@@ -8,9 +8,10 @@ namespace p3 {
 namespace ic {
 
 FortranData::Ptr make_mixed(Int ncol);
+FortranData::Ptr make_mixed_clear(Int ncol);
 
 struct Factory {
-  enum IC { mixed };
+  enum IC { mixed, mixed_clear };
 
   static FortranData::Ptr create(IC ic, Int ncol = 1, Int nlev = 72);
 };
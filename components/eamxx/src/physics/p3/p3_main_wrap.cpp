@@ -26,7 +26,7 @@ extern "C" {
 namespace scream {
 namespace p3 {
 
-Int p3_main_wrap(const FortranData& d, bool use_fortran) {
+Int p3_main_wrap(const FortranData& d, bool use_fortran, bool compact_columns) {
   EKAT_REQUIRE_MSG(d.dt > 0, "invalid dt");
   if (use_fortran) {
     Real elapsed_s;
@@ -52,7 +52,8 @@ Int p3_main_wrap(const FortranData& d, bool use_fortran) {
                      d.precip_liq_flux.data(), d.precip_ice_flux.data(),
                      d.cld_frac_r.data(), d.cld_frac_l.data(), d.cld_frac_i.data(),
                      d.liq_ice_exchange.data(), d.vap_liq_exchange.data(),
-                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data() );
+                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data(),
+                     compact_columns);
 
   }
 }
@@ -10,8 +10,9 @@ namespace p3 {
 
 struct FortranData;
 
-// Returns number of microseconds of p3_main execution
-Int p3_main_wrap(const FortranData& d, bool use_fortran=false);
+// Returns number of microseconds of p3_main execution. compact_columns is
+// only used by the C++ impl.
+Int p3_main_wrap(const FortranData& d, bool use_fortran=false, bool compact_columns=false);
 
 int test_p3_init();
 
@@ -13,6 +13,7 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <iostream>
 
 namespace scream {
 namespace p3 {
@@ -444,6 +445,128 @@ static void run_bfb_p3_main()
   }
 }
 
+static void run_compact_columns()
+{
+  // Run p3_main on a set of columns of which only a fraction may have active
+  // microphysics, with and without column compaction. Results must be identical.
+  auto engine = setup_random_test();
+
+  const Int ncol = 64, nlev = 72;
+  P3MainData d_ref(1, ncol, 1, nlev, 1, 1.800E+03, true, false);
+  d_ref.randomize(engine, {
+      {d_ref.pres           , {1.00000000E+02 , 9.87111111E+04}},
+      {d_ref.dz             , {1.22776609E+02 , 3.49039167E+04}},
+      {d_ref.nc_nuceat_tend , {0              , 0}},
+      {d_ref.nccn_prescribed, {0              , 0}},
+      {d_ref.ni_activated   , {0              , 0}},
+      {d_ref.dpres          , {1.37888889E+03, 1.39888889E+03}},
+      {d_ref.inv_exner      , {1.00371345E+00, 3.19721007E+00}},
+      {d_ref.cld_frac_i     , {1              , 1}},
+      {d_ref.cld_frac_l     , {1              , 1}},
+      {d_ref.cld_frac_r     , {1              , 1}},
+      {d_ref.inv_qc_relvar  , {1              , 1}},
+      {d_ref.qc             , {0              , 1.00000000E-04}},
+      {d_ref.nc             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_ref.qr             , {0              , 1.00000000E-05}},
+      {d_ref.nr             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_ref.qi             , {0              , 1.00000000E-04}},
+      {d_ref.qm             , {0              , 1.00000000E-04}},
+      {d_ref.ni             , {1.00000000E+06 , 1.00000000E+06}},
+      {d_ref.bm             , {0              , 1.00000000E-02}},
+      {d_ref.qv             , {0              , 5.00000000E-02}},
+      {d_ref.qv_prev        , {0              , 5.00000000E-02}},
+      {d_ref.th_atm         , {6.72653866E+02 , 1.07954335E+03}},
+      {d_ref.t_prev         , {1.50000000E+02 , 3.50000000E+02}},
+  });
+
+  // Make 3 out of 4 columns dry and free of hydrometeors, so that p3 has nothing to do there
+  for (Int i = 0; i < ncol; ++i) {
+    if (i % 4 == 0) continue;
+    for (Int k = 0; k < nlev; ++k) {
+      const Int idx = i*nlev + k;
+      d_ref.qc[idx] = d_ref.qr[idx] = d_ref.qi[idx] = 0;
+      d_ref.qm[idx] = d_ref.bm[idx] = 0;
+      d_ref.qv[idx] = 0;
+    }
+  }
+
+  P3MainData d_cmp(d_ref);
+
+  P3MainData* ds[2] = {&d_ref, &d_cmp};
+  for (Int n = 0; n < 2; ++n) {
+    auto& d = *ds[n];
+    d.transpose<ekat::TransposeDirection::c2f>();
+    p3_main_f(
+      d.qc, d.nc, d.qr, d.nr, d.th_atm, d.qv, d.dt, d.qi, d.qm, d.ni,
+      d.bm, d.pres, d.dz, d.nc_nuceat_tend, d.nccn_prescribed, d.ni_activated, d.inv_qc_relvar, d.it, d.precip_liq_surf,
+      d.precip_ice_surf, d.its, d.ite, d.kts, d.kte, d.diag_eff_radius_qc, d.diag_eff_radius_qi,
+      d.rho_qi, d.do_predict_nc, d.do_prescribed_CCN, d.dpres, d.inv_exner, d.qv2qi_depos_tend,
+      d.precip_liq_flux, d.precip_ice_flux, d.cld_frac_r, d.cld_frac_l, d.cld_frac_i,
+      d.liq_ice_exchange, d.vap_liq_exchange, d.vap_ice_exchange, d.qv_prev, d.t_prev,
+      /* compact_columns = */ n==1);
+    d.transpose<ekat::TransposeDirection::f2c>();
+  }
+  const auto tot = d_ref.total(d_ref.qc);
+  for (Int t = 0; t < tot; ++t) {
+    REQUIRE(d_ref.qc[t]                 == d_cmp.qc[t]);
+    REQUIRE(d_ref.nc[t]                 == d_cmp.nc[t]);
+    REQUIRE(d_ref.qr[t]                 == d_cmp.qr[t]);
+    REQUIRE(d_ref.nr[t]                 == d_cmp.nr[t]);
+    REQUIRE(d_ref.qi[t]                 == d_cmp.qi[t]);
+    REQUIRE(d_ref.qm[t]                 == d_cmp.qm[t]);
+    REQUIRE(d_ref.ni[t]                 == d_cmp.ni[t]);
+    REQUIRE(d_ref.bm[t]                 == d_cmp.bm[t]);
+    REQUIRE(d_ref.qv[t]                 == d_cmp.qv[t]);
+    REQUIRE(d_ref.th_atm[t]             == d_cmp.th_atm[t]);
+    REQUIRE(d_ref.diag_eff_radius_qc[t] == d_cmp.diag_eff_radius_qc[t]);
+    REQUIRE(d_ref.diag_eff_radius_qi[t] == d_cmp.diag_eff_radius_qi[t]);
+    REQUIRE(d_ref.rho_qi[t]             == d_cmp.rho_qi[t]);
+    REQUIRE(d_ref.qv2qi_depos_tend[t]   == d_cmp.qv2qi_depos_tend[t]);
+    REQUIRE(d_ref.liq_ice_exchange[t]   == d_cmp.liq_ice_exchange[t]);
+    REQUIRE(d_ref.vap_liq_exchange[t]   == d_cmp.vap_liq_exchange[t]);
+    REQUIRE(d_ref.vap_ice_exchange[t]   == d_cmp.vap_ice_exchange[t]);
+    REQUIRE(d_ref.precip_liq_flux[t]    == d_cmp.precip_liq_flux[t]);
+    REQUIRE(d_ref.precip_ice_flux[t]    == d_cmp.precip_ice_flux[t]);
+  }
+  for (Int i = 0; i < ncol; ++i) {
+    REQUIRE(d_ref.precip_liq_surf[i] == d_cmp.precip_liq_surf[i]);
+    REQUIRE(d_ref.precip_ice_surf[i] == d_cmp.precip_ice_surf[i]);
+  }
+}
+
+static void run_sort_columns_by_sed_work()
+{
+  // Work bins
+  REQUIRE(Functions::sed_work_bin(0) == 0);
+  REQUIRE(Functions::sed_work_bin(1) == 1);
+  REQUIRE(Functions::sed_work_bin(2) == 2);
+  REQUIRE(Functions::sed_work_bin(3) == 2);
+  REQUIRE(Functions::sed_work_bin(4) == 3);
+  REQUIRE(Functions::sed_work_bin(1000000) == Functions::num_sed_work_bins-1);
+
+  // Sort the last 8 of 10 columns by decreasing work bin
+  const Int nj = 10, col_beg = 2;
+  const Int substeps[nj] = {50, 0, 1, 0, 12, 3, 100, 2, 0, 13};
+  view_1d<Int> col_ids("col_ids", nj), sed_substeps("sed_substeps", nj);
+  const auto col_ids_h      = Kokkos::create_mirror_view(col_ids);
+  const auto sed_substeps_h = Kokkos::create_mirror_view(sed_substeps);
+  for (Int i = 0; i < nj; ++i) {
+    col_ids_h(i) = i;
+    sed_substeps_h(i) = substeps[i];
+  }
+  Kokkos::deep_copy(col_ids, col_ids_h);
+  Kokkos::deep_copy(sed_substeps, sed_substeps_h);
+
+  view_1d<Int> sorted("sorted", nj-col_beg);
+  Functions::p3_main_sort_columns_by_sed_work(col_ids, sed_substeps, sorted, col_beg, nj);
+
+  Kokkos::deep_copy(col_ids_h, col_ids);
+  const Int expected[nj] = {0, 1, 6, 4, 9, 5, 7, 2, 3, 8};
+  for (Int i = 0; i < nj; ++i) {
+    REQUIRE(col_ids_h(i) == expected[i]);
+  }
+}
+
 static void run_bfb()
 {
   run_bfb_p3_main_part1();
@@ -466,6 +589,8 @@ TEST_CASE("p3_main", "[p3_functions]")
 
   TP3::run_phys();
   TP3::run_bfb();
+  TP3::run_compact_columns();
+  TP3::run_sort_columns_by_sed_work();
 
   scream::p3::P3GlobalForFortran::deinit();
 }
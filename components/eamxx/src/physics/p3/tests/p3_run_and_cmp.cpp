@@ -50,7 +50,9 @@ using namespace scream::p3;
 }
 
 struct Baseline {
-  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN)
+  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN,
+            const ic::Factory::IC ic, const bool compact_columns)
+    : compact_columns_(compact_columns)
   {
     //If predict_nc="both", start looping at i_start=0 (false) and end after i_start=1 (true)
     //otherwise, modify start and end to only loop over case of interest. Test that predict_nc
@@ -70,7 +72,7 @@ struct Baseline {
     for (int i = i_start; i < i_end; ++i) { // predict_nc is false or true
       for (int j = j_start; j< j_end; ++j) { //prescribed_CCN is false or true
   //                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not
-  params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
+  params_.push_back({ic,                repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
       }
     }
   }
@@ -96,13 +98,14 @@ struct Baseline {
                     << ", prescribed_CCN=" << d->do_prescribed_CCN;
 
           if (!use_fortran) {
-            std::cout << ", small_packn=" << SCREAM_SMALL_PACK_SIZE;
+            std::cout << ", small_packn=" << SCREAM_SMALL_PACK_SIZE
+                      << ", compact_columns=" << compact_columns_;
           }
           std::cout << std::endl;
         }
 
         for (int it=0; it<ps.nsteps; it++) {
-          Int current_microsec = p3_main_wrap(*d, use_fortran);
+          Int current_microsec = p3_main_wrap(*d, use_fortran, compact_columns_);
 
           if (r != -1 && ps.repeat > 0) { // do not count the "cold" run
             total_duration_microsec += current_microsec;
@@ -142,7 +145,7 @@ struct Baseline {
         for (int it=0; it<ps.nsteps; it++) {
           std::cout << "--- checking case # " << case_num << ", timestep # " << it+1 << " of " << ps.nsteps << " ---\n" << std::flush;
           read(fid, d_ref);
-          p3_main_wrap(*d, use_fortran);
+          p3_main_wrap(*d, use_fortran, compact_columns_);
           ne = compare(tol, d_ref, d);
           if (ne) std::cout << "Ref impl failed.\n";
           nerr += ne;
@@ -171,6 +174,7 @@ private:
   }
 
   std::vector<ParamSet> params_;
+  bool compact_columns_;
 
   static void write (const ekat::FILEPtr& fid, const FortranData::Ptr& d) {
     FortranDataIterator fdi(d);
@@ -231,11 +235,15 @@ int main (int argc, char** argv) {
       "  -k <nlev>           Number of vertical levels. Default=72.\n"
       "  -r <repeat>         Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
       "  -p <predict_nc>     yes|no|both. Default=both.\n"
-      "  -c <prescribed_ccn> yes|no|both. Default=both.\n";
+      "  -c <prescribed_ccn> yes|no|both. Default=both.\n"
+      "  -ic <case>          mixed|mixed_clear. Default=mixed.\n"
+      "  -a                  Compact the active columns (c++ only). Default False.\n"
+      "E.g., to time the column compaction on mostly clear columns:\n"
+      "  " << argv[0] << " -r 10 -i 1024 -ic mixed_clear [-a] baseline-filename\n";
     return 1;
   }
 
-  bool generate = false, use_fortran = false;
+  bool generate = false, use_fortran = false, compact_columns = false;
   scream::Real tol = SCREAM_BFB_TESTING ? 0 : std::numeric_limits<Real>::infinity();
   Int timesteps = 6;
   Int dt = 300;
@@ -245,10 +253,12 @@ int main (int argc, char** argv) {
   std::string device;
   std::string predict_nc = "both";
   std::string prescribed_ccn = "both";
+  ic::Factory::IC ic = ic::Factory::mixed;
   std::string baseline_fn;
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
     if (ekat::argv_matches(argv[i], "-f", "--fortran")) use_fortran = true;
+    if (ekat::argv_matches(argv[i], "-a", "--compact-columns")) compact_columns = true;
     if (ekat::argv_matches(argv[i], "-t", "--tol")) {
       expect_another_arg(i, argc);
       ++i;
@@ -306,6 +316,14 @@ int main (int argc, char** argv) {
       EKAT_REQUIRE_MSG(prescribed_ccn == "yes" || prescribed_ccn == "no" || prescribed_ccn == "both",
                        "Prescribed CCN option value must be one of yes|no|both");
     }
+    if (ekat::argv_matches(argv[i], "-ic", "--initial-condition")) {
+      expect_another_arg(i, argc);
+      ++i;
+      const std::string ic_name(argv[i]);
+      EKAT_REQUIRE_MSG(ic_name == "mixed" || ic_name == "mixed_clear",
+                       "Initial condition must be one of mixed|mixed_clear");
+      ic = ic_name == "mixed" ? ic::Factory::mixed : ic::Factory::mixed_clear;
+    }
   }
 
   // Decorate baseline name with precision.
@@ -337,7 +355,7 @@ int main (int argc, char** argv) {
   }
 
   scream::initialize_scream_session(args.size(), args.data()); {
-    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn);
+    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn, ic, compact_columns);
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
       nerr += bln.generate_baseline(baseline_fn, use_fortran);
@@ -10,6 +10,9 @@
 #include "YAKL.h"
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 namespace scream {
 
 using KT = KokkosTypes<DefaultDevice>;
@@ -58,21 +61,54 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   m_lat  = m_grid->get_geometry_data("lat");
   m_lon  = m_grid->get_geometry_data("lon");
 
+  m_nswgpts = m_params.get<int>("nswgpts",112);
+  m_nlwgpts = m_params.get<int>("nlwgpts",128);
+
   // Figure out radiation column chunks stats
-  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
-  m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
-  m_col_chunk_beg.resize(m_num_col_chunks+1,0);
-  for (int i=0; i<m_num_col_chunks; ++i) {
-    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
+  m_max_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
+  m_pipeline_chunks = m_params.get<bool>("pipeline_column_chunks",false);
+  m_tune_chunk_size = m_params.get<bool>("tune_column_chunk_size",false);
+  m_num_buffers = m_pipeline_chunks ? 2 : 1;
+  const double max_buffer_mb = m_params.get<double>("column_chunk_max_buffer_mb",-1);
+  if (max_buffer_mb>0) {
+    // Cap the chunk size, so that all buffers fit in the given amount of memory.
+    // The inputs needed by all chunks (mu0 and aerosol optics) are allocated for
+    // all columns, regardless of the chunk size, so they come off the top.
+    using SmallPack = ekat::Pack<Real,SCREAM_SMALL_PACK_SIZE>;
+    const int n_lay_w_pack = SCREAM_SMALL_PACK_SIZE*ekat::npack<SmallPack>(m_nlay);
+    const double full_ncol_bytes = sizeof(Real)*m_ncol*(1.0 + (3*m_nswbands+m_nlwbands)*n_lay_w_pack);
+    const auto bytes_per_col = m_num_buffers*buffer_size_per_col_in_bytes();
+    const int max_cols = (max_buffer_mb*1024*1024 - full_ncol_bytes) / bytes_per_col;
+    EKAT_REQUIRE_MSG (max_cols>0,
+        "Error! Not enough memory for a single column chunk in RRTMGP buffers.\n"
+        "  - column_chunk_max_buffer_mb: " + std::to_string(max_buffer_mb) + "\n"
+        "  - MB needed by full-ncol inputs: " + std::to_string(full_ncol_bytes/(1024*1024)) + "\n"
+        "  - Bytes per column: " + std::to_string(bytes_per_col) + "\n");
+    m_max_col_chunk_size = std::min(m_max_col_chunk_size,max_cols);
+  }
+  set_col_chunk_size(m_max_col_chunk_size);
+  if (m_num_col_chunks==1 && not m_tune_chunk_size) {
+    // Nothing to overlap, don't waste memory
+    m_pipeline_chunks = false;
+    m_num_buffers = 1;
+  }
+
+  // If tuning, try the max chunk size, and three halvings of it. All ranks must try
+  // the same number of sizes, since the timings are reduced across ranks.
+  m_tuning_idx = 0;
+  if (m_tune_chunk_size) {
+    for (int k=0; k<4; ++k) {
+      m_tuning_chunk_sizes.push_back(std::max(m_max_col_chunk_size >> k,1));
+    }
   }
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
             "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
-            "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
+            "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n"
+            "  - Pipelined chunks: " + std::string(m_pipeline_chunks ? "yes" : "no") + "\n"
+            "  - Tune chunk size: " + std::string(m_tune_chunk_size ? "yes" : "no") + "\n");
 
   // Set up dimension layouts
-  m_nswgpts = m_params.get<int>("nswgpts",112);
-  m_nlwgpts = m_params.get<int>("nlwgpts",128);
   FieldLayout scalar2d_layout     { {COL   }, {m_ncol    } };
   FieldLayout scalar3d_layout_mid { {COL,LEV}, {m_ncol,m_nlay} };
   FieldLayout scalar3d_layout_int { {COL,ILEV}, {m_ncol,m_nlay+1} };
@@ -164,21 +200,26 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   }
 }  // RRTMGPRadiation::set_grids
 
-size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
+size_t RRTMGPRadiation::buffer_size_per_col_in_bytes() const
 {
   const size_t interface_request =
-    Buffer::num_1d_ncol*m_col_chunk_size +
-    Buffer::num_2d_nlay*m_col_chunk_size*m_nlay +
-    Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1) +
-    Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands +
-    Buffer::num_3d_nlev_nswbands*m_col_chunk_size*(m_nlay+1)*m_nswbands +
-    Buffer::num_3d_nlev_nlwbands*m_col_chunk_size*(m_nlay+1)*m_nlwbands +
-    Buffer::num_3d_nlay_nswbands*m_col_chunk_size*(m_nlay)*m_nswbands +
-    Buffer::num_3d_nlay_nlwbands*m_col_chunk_size*(m_nlay)*m_nlwbands +
-    Buffer::num_3d_nlay_nswgpts*m_col_chunk_size*(m_nlay)*m_nswgpts +
-    Buffer::num_3d_nlay_nlwgpts*m_col_chunk_size*(m_nlay)*m_nlwgpts;
+    Buffer::num_1d_ncol +
+    Buffer::num_2d_nlay*m_nlay +
+    Buffer::num_2d_nlay_p1*(m_nlay+1) +
+    Buffer::num_2d_nswbands*m_nswbands +
+    Buffer::num_3d_nlev_nswbands*(m_nlay+1)*m_nswbands +
+    Buffer::num_3d_nlev_nlwbands*(m_nlay+1)*m_nlwbands +
+    Buffer::num_3d_nlay_nswbands*(m_nlay)*m_nswbands +
+    Buffer::num_3d_nlay_nlwbands*(m_nlay)*m_nlwbands +
+    Buffer::num_3d_nlay_nswgpts*(m_nlay)*m_nswgpts +
+    Buffer::num_3d_nlay_nlwgpts*(m_nlay)*m_nlwgpts;
 
   return interface_request * sizeof(Real);
+}
+
+size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
+{
+  return m_num_buffers*m_max_col_chunk_size*buffer_size_per_col_in_bytes();
 } // RRTMGPRadiation::requested_buffer_size
 // =========================================================================================
 
@@ -187,114 +228,117 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= requested_buffer_size_in_bytes(), "Error! Buffers size not sufficient.\n");
 
   Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
-
-  // 1d arrays
-  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, m_col_chunk_size);
-  mem += m_buffer.mu0.totElems();
-  m_buffer.sfc_alb_dir_vis = decltype(m_buffer.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_vis.totElems();
-  m_buffer.sfc_alb_dir_nir = decltype(m_buffer.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dir_nir.totElems();
-  m_buffer.sfc_alb_dif_vis = decltype(m_buffer.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_vis.totElems();
-  m_buffer.sfc_alb_dif_nir = decltype(m_buffer.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_alb_dif_nir.totElems();
-  m_buffer.sfc_flux_dir_vis = decltype(m_buffer.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_vis.totElems();
-  m_buffer.sfc_flux_dir_nir = decltype(m_buffer.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dir_nir.totElems();
-  m_buffer.sfc_flux_dif_vis = decltype(m_buffer.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_vis.totElems();
-  m_buffer.sfc_flux_dif_nir = decltype(m_buffer.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunk_size);
-  mem += m_buffer.sfc_flux_dif_nir.totElems();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
-  mem += m_buffer.cosine_zenith.size();
-
-  // 2d arrays
-  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_lay.totElems();
-  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.t_lay.totElems();
-  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.p_del.totElems();
-  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qc.totElems();
-  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.qi.totElems();
-  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.cldfrac_tot.totElems();
-  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qc.totElems();
-  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.eff_radius_qi.totElems();
-  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.tmp2d.totElems();
-  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lwp.totElems();
-  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.iwp.totElems();
-  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.sw_heating.totElems();
-  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, m_col_chunk_size, m_nlay);
-  mem += m_buffer.lw_heating.totElems();
-  // 3d arrays
-  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.p_lev.totElems();
-  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.t_lev.totElems();
-  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_up.totElems();
-  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn.totElems();
-  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_flux_dn_dir.totElems();
-  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_up.totElems();
-  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_flux_dn.totElems();
-  m_buffer.sw_clrsky_flux_up = decltype(m_buffer.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_up.totElems();
-  m_buffer.sw_clrsky_flux_dn = decltype(m_buffer.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn.totElems();
-  m_buffer.sw_clrsky_flux_dn_dir = decltype(m_buffer.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.sw_clrsky_flux_dn_dir.totElems();
-  m_buffer.lw_clrsky_flux_up = decltype(m_buffer.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_up.totElems();
-  m_buffer.lw_clrsky_flux_dn = decltype(m_buffer.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
-  mem += m_buffer.lw_clrsky_flux_dn.totElems();
-  // 3d arrays with nswbands dimension (shortwave fluxes by band)
-  m_buffer.sw_bnd_flux_up = decltype(m_buffer.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_up.totElems();
-  m_buffer.sw_bnd_flux_dn = decltype(m_buffer.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dn.totElems();
-  m_buffer.sw_bnd_flux_dir = decltype(m_buffer.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dir.totElems();
-  m_buffer.sw_bnd_flux_dif = decltype(m_buffer.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
-  mem += m_buffer.sw_bnd_flux_dif.totElems();
-  // 3d arrays with nlwbands dimension (longwave fluxes by band)
-  m_buffer.lw_bnd_flux_up = decltype(m_buffer.lw_bnd_flux_up)("lw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_up.totElems();
-  m_buffer.lw_bnd_flux_dn = decltype(m_buffer.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
-  mem += m_buffer.lw_bnd_flux_dn.totElems();
-  // 2d arrays with extra nswbands dimension (surface albedos by band)
-  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("sfc_alb_dir", mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dir.totElems();
-  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("sfc_alb_dif", mem, m_col_chunk_size, m_nswbands);
-  mem += m_buffer.sfc_alb_dif.totElems();
-  // 3d arrays with extra band dimension (aerosol optics by band)
-  m_buffer.aero_tau_sw = decltype(m_buffer.aero_tau_sw)("aero_tau_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_tau_sw.totElems();
-  m_buffer.aero_ssa_sw = decltype(m_buffer.aero_ssa_sw)("aero_ssa_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_ssa_sw.totElems();
-  m_buffer.aero_g_sw   = decltype(m_buffer.aero_g_sw  )("aero_g_sw"  , mem, m_col_chunk_size, m_nlay, m_nswbands);
-  mem += m_buffer.aero_g_sw.totElems();
-  m_buffer.aero_tau_lw = decltype(m_buffer.aero_tau_lw)("aero_tau_lw", mem, m_col_chunk_size, m_nlay, m_nlwbands);
-  mem += m_buffer.aero_tau_lw.totElems();
-  // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
-  m_buffer.cld_tau_sw_gpt = decltype(m_buffer.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, m_col_chunk_size, m_nlay, m_nswgpts);
-  mem += m_buffer.cld_tau_sw_gpt.totElems();
-  m_buffer.cld_tau_lw_gpt = decltype(m_buffer.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunk_size, m_nlay, m_nlwgpts);
-  mem += m_buffer.cld_tau_lw_gpt.totElems();
+  const int ncol = m_max_col_chunk_size;
+
+  for (int ibuf=0; ibuf<m_num_buffers; ++ibuf) {
+    auto& buf = m_buffers[ibuf];
+
+    // 1d arrays
+    buf.mu0 = decltype(buf.mu0)("mu0", mem, ncol);
+    mem += buf.mu0.totElems();
+    buf.sfc_alb_dir_vis = decltype(buf.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, ncol);
+    mem += buf.sfc_alb_dir_vis.totElems();
+    buf.sfc_alb_dir_nir = decltype(buf.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, ncol);
+    mem += buf.sfc_alb_dir_nir.totElems();
+    buf.sfc_alb_dif_vis = decltype(buf.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, ncol);
+    mem += buf.sfc_alb_dif_vis.totElems();
+    buf.sfc_alb_dif_nir = decltype(buf.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, ncol);
+    mem += buf.sfc_alb_dif_nir.totElems();
+    buf.sfc_flux_dir_vis = decltype(buf.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, ncol);
+    mem += buf.sfc_flux_dir_vis.totElems();
+    buf.sfc_flux_dir_nir = decltype(buf.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, ncol);
+    mem += buf.sfc_flux_dir_nir.totElems();
+    buf.sfc_flux_dif_vis = decltype(buf.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, ncol);
+    mem += buf.sfc_flux_dif_vis.totElems();
+    buf.sfc_flux_dif_nir = decltype(buf.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, ncol);
+    mem += buf.sfc_flux_dif_nir.totElems();
+
+    // 2d arrays
+    buf.p_lay = decltype(buf.p_lay)("p_lay", mem, ncol, m_nlay);
+    mem += buf.p_lay.totElems();
+    buf.t_lay = decltype(buf.t_lay)("t_lay", mem, ncol, m_nlay);
+    mem += buf.t_lay.totElems();
+    buf.p_del = decltype(buf.p_del)("p_del", mem, ncol, m_nlay);
+    mem += buf.p_del.totElems();
+    buf.qc = decltype(buf.qc)("qc", mem, ncol, m_nlay);
+    mem += buf.qc.totElems();
+    buf.qi = decltype(buf.qi)("qi", mem, ncol, m_nlay);
+    mem += buf.qi.totElems();
+    buf.cldfrac_tot = decltype(buf.cldfrac_tot)("cldfrac_tot", mem, ncol, m_nlay);
+    mem += buf.cldfrac_tot.totElems();
+    buf.eff_radius_qc = decltype(buf.eff_radius_qc)("eff_radius_qc", mem, ncol, m_nlay);
+    mem += buf.eff_radius_qc.totElems();
+    buf.eff_radius_qi = decltype(buf.eff_radius_qi)("eff_radius_qi", mem, ncol, m_nlay);
+    mem += buf.eff_radius_qi.totElems();
+    buf.tmp2d = decltype(buf.tmp2d)("tmp2d", mem, ncol, m_nlay);
+    mem += buf.tmp2d.totElems();
+    buf.lwp = decltype(buf.lwp)("lwp", mem, ncol, m_nlay);
+    mem += buf.lwp.totElems();
+    buf.iwp = decltype(buf.iwp)("iwp", mem, ncol, m_nlay);
+    mem += buf.iwp.totElems();
+    buf.sw_heating = decltype(buf.sw_heating)("sw_heating", mem, ncol, m_nlay);
+    mem += buf.sw_heating.totElems();
+    buf.lw_heating = decltype(buf.lw_heating)("lw_heating", mem, ncol, m_nlay);
+    mem += buf.lw_heating.totElems();
+    // 3d arrays
+    buf.p_lev = decltype(buf.p_lev)("p_lev", mem, ncol, m_nlay+1);
+    mem += buf.p_lev.totElems();
+    buf.t_lev = decltype(buf.t_lev)("t_lev", mem, ncol, m_nlay+1);
+    mem += buf.t_lev.totElems();
+    buf.sw_flux_up = decltype(buf.sw_flux_up)("sw_flux_up", mem, ncol, m_nlay+1);
+    mem += buf.sw_flux_up.totElems();
+    buf.sw_flux_dn = decltype(buf.sw_flux_dn)("sw_flux_dn", mem, ncol, m_nlay+1);
+    mem += buf.sw_flux_dn.totElems();
+    buf.sw_flux_dn_dir = decltype(buf.sw_flux_dn_dir)("sw_flux_dn_dir", mem, ncol, m_nlay+1);
+    mem += buf.sw_flux_dn_dir.totElems();
+    buf.lw_flux_up = decltype(buf.lw_flux_up)("lw_flux_up", mem, ncol, m_nlay+1);
+    mem += buf.lw_flux_up.totElems();
+    buf.lw_flux_dn = decltype(buf.lw_flux_dn)("lw_flux_dn", mem, ncol, m_nlay+1);
+    mem += buf.lw_flux_dn.totElems();
+    buf.sw_clrsky_flux_up = decltype(buf.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, ncol, m_nlay+1);
+    mem += buf.sw_clrsky_flux_up.totElems();
+    buf.sw_clrsky_flux_dn = decltype(buf.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, ncol, m_nlay+1);
+    mem += buf.sw_clrsky_flux_dn.totElems();
+    buf.sw_clrsky_flux_dn_dir = decltype(buf.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, ncol, m_nlay+1);
+    mem += buf.sw_clrsky_flux_dn_dir.totElems();
+    buf.lw_clrsky_flux_up = decltype(buf.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, ncol, m_nlay+1);
+    mem += buf.lw_clrsky_flux_up.totElems();
+    buf.lw_clrsky_flux_dn = decltype(buf.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, ncol, m_nlay+1);
+    mem += buf.lw_clrsky_flux_dn.totElems();
+    // 3d arrays with nswbands dimension (shortwave fluxes by band)
+    buf.sw_bnd_flux_up = decltype(buf.sw_bnd_flux_up)("sw_bnd_flux_up", mem, ncol, m_nlay+1, m_nswbands);
+    mem += buf.sw_bnd_flux_up.totElems();
+    buf.sw_bnd_flux_dn = decltype(buf.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, ncol, m_nlay+1, m_nswbands);
+    mem += buf.sw_bnd_flux_dn.totElems();
+    buf.sw_bnd_flux_dir = decltype(buf.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, ncol, m_nlay+1, m_nswbands);
+    mem += buf.sw_bnd_flux_dir.totElems();
+    buf.sw_bnd_flux_dif = decltype(buf.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, ncol, m_nlay+1, m_nswbands);
+    mem += buf.sw_bnd_flux_dif.totElems();
+    // 3d arrays with nlwbands dimension (longwave fluxes by band)
+    buf.lw_bnd_flux_up = decltype(buf.lw_bnd_flux_up)("lw_bnd_flux_up", mem, ncol, m_nlay+1, m_nlwbands);
+    mem += buf.lw_bnd_flux_up.totElems();
+    buf.lw_bnd_flux_dn = decltype(buf.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, ncol, m_nlay+1, m_nlwbands);
+    mem += buf.lw_bnd_flux_dn.totElems();
+    // 2d arrays with extra nswbands dimension (surface albedos by band)
+    buf.sfc_alb_dir = decltype(buf.sfc_alb_dir)("sfc_alb_dir", mem, ncol, m_nswbands);
+    mem += buf.sfc_alb_dir.totElems();
+    buf.sfc_alb_dif = decltype(buf.sfc_alb_dif)("sfc_alb_dif", mem, ncol, m_nswbands);
+    mem += buf.sfc_alb_dif.totElems();
+    // 3d arrays with extra band dimension (aerosol optics by band)
+    buf.aero_tau_sw = decltype(buf.aero_tau_sw)("aero_tau_sw", mem, ncol, m_nlay, m_nswbands);
+    mem += buf.aero_tau_sw.totElems();
+    buf.aero_ssa_sw = decltype(buf.aero_ssa_sw)("aero_ssa_sw", mem, ncol, m_nlay, m_nswbands);
+    mem += buf.aero_ssa_sw.totElems();
+    buf.aero_g_sw   = decltype(buf.aero_g_sw  )("aero_g_sw"  , mem, ncol, m_nlay, m_nswbands);
+    mem += buf.aero_g_sw.totElems();
+    buf.aero_tau_lw = decltype(buf.aero_tau_lw)("aero_tau_lw", mem, ncol, m_nlay, m_nlwbands);
+    mem += buf.aero_tau_lw.totElems();
+    // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
+    buf.cld_tau_sw_gpt = decltype(buf.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, ncol, m_nlay, m_nswgpts);
+    mem += buf.cld_tau_sw_gpt.totElems();
+    buf.cld_tau_lw_gpt = decltype(buf.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, ncol, m_nlay, m_nlwgpts);
+    mem += buf.cld_tau_lw_gpt.totElems();
+  }
 
   size_t used_mem = (reinterpret_cast<Real*>(mem) - buffer_manager.get_memory())*sizeof(Real);
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
@@ -353,7 +397,7 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   std::string coefficients_file_lw = m_params.get<std::string>("rrtmgp_coefficients_file_lw");
   std::string cloud_optics_file_sw = m_params.get<std::string>("rrtmgp_cloud_optics_file_sw");
   std::string cloud_optics_file_lw = m_params.get<std::string>("rrtmgp_cloud_optics_file_lw");
-  m_gas_concs.init(gas_names_yakl_offset,m_col_chunk_size,m_nlay);
+  m_gas_concs.init(gas_names_yakl_offset,m_max_col_chunk_size,m_nlay);
   rrtmgp::rrtmgp_initialize(
           m_gas_concs,
           coefficients_file_sw, coefficients_file_lw,
@@ -361,6 +405,20 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
           m_atm_logger
   );
 
+  // Inputs needed by all chunks. If aerosol forcing is off, aerosol optics stay zero.
+  using SmallPack = ekat::Pack<Real,SCREAM_SMALL_PACK_SIZE>;
+  const int n_lay_w_pack = SCREAM_SMALL_PACK_SIZE*ekat::npack<SmallPack>(m_nlay);
+  m_mu0 = view_1d_real("mu0",m_ncol);
+  m_aero_tau_sw = view_3d_real("aero_tau_sw",m_ncol,m_nswbands,n_lay_w_pack);
+  m_aero_ssa_sw = view_3d_real("aero_ssa_sw",m_ncol,m_nswbands,n_lay_w_pack);
+  m_aero_g_sw   = view_3d_real("aero_g_sw"  ,m_ncol,m_nswbands,n_lay_w_pack);
+  m_aero_tau_lw = view_3d_real("aero_tau_lw",m_ncol,m_nlwbands,n_lay_w_pack);
+
+  if (m_pipeline_chunks) {
+    // Get an execution space instance for the chunks copy-in, separate from the default one
+    m_pipe_space = Kokkos::Experimental::partition_space(ExeSpace(),1,1)[1];
+  }
+
   // Set property checks for fields in this process
   add_invariant_check<FieldWithinIntervalCheck>(get_field_out("T_mid"),m_grid,100.0, 500.0,false);
 }
@@ -370,7 +428,6 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
 void RRTMGPRadiation::run_impl (const double dt) {
   using PF = scream::PhysicsFunctions<DefaultDevice>;
   using PC = scream::physics::Constants<Real>;
-  using CO = scream::ColumnOps<DefaultDevice,Real>;
 
   // get a host copy of lat/lon
   auto h_lat  = m_lat.get_view<const Real*,Host>();
@@ -378,66 +435,17 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
   // Get data from the FieldManager
   auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
-  auto d_pint = get_field_in("p_int").get_view<const Real**>();
   auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
-  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
-  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
-  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
-  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
   auto d_qv = get_field_in("qv").get_view<const Real**>();
-  auto d_qc = get_field_in("qc").get_view<const Real**>();
-  auto d_qi = get_field_in("qi").get_view<const Real**>();
-  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
-  auto d_rel = get_field_in("eff_radius_qc").get_view<const Real**>();
-  auto d_rei = get_field_in("eff_radius_qi").get_view<const Real**>();
-  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
   // Output fields
   auto d_tmid = get_field_out("T_mid").get_view<Real**>();
-  using SmallPack = ekat::Pack<Real,SCREAM_SMALL_PACK_SIZE>;
-  const int n_lay_w_pack = SCREAM_SMALL_PACK_SIZE*ekat::npack<SmallPack>(m_nlay);
-  view_3d_real d_aero_tau_sw("aero_tau_sw",m_ncol,m_nswbands,n_lay_w_pack);
-  view_3d_real d_aero_ssa_sw("aero_ssa_sw",m_ncol,m_nswbands,n_lay_w_pack);
-  view_3d_real d_aero_g_sw  ("aero_g_sw"  ,m_ncol,m_nswbands,n_lay_w_pack);
-  view_3d_real d_aero_tau_lw("aero_tau_lw",m_ncol,m_nlwbands,n_lay_w_pack);
-  if (m_do_aerosol_rad) {
-    Kokkos::deep_copy(d_aero_tau_sw,get_field_in("aero_tau_sw").get_view<const Real***>());
-    Kokkos::deep_copy(d_aero_ssa_sw,get_field_in("aero_ssa_sw").get_view<const Real***>());
-    Kokkos::deep_copy(d_aero_g_sw  ,get_field_in("aero_g_sw"  ).get_view<const Real***>());
-    Kokkos::deep_copy(d_aero_tau_lw,get_field_in("aero_tau_lw").get_view<const Real***>());
-  } else {
-    Kokkos::deep_copy(d_aero_tau_sw,0.0);
-    Kokkos::deep_copy(d_aero_ssa_sw,0.0);
-    Kokkos::deep_copy(d_aero_g_sw  ,0.0);
-    Kokkos::deep_copy(d_aero_tau_lw,0.0);
-
-  }
   auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
   auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
-  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
   auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
   auto d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
-  auto d_sw_clrsky_flux_up = get_field_out("SW_clrsky_flux_up").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn = get_field_out("SW_clrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn_dir = get_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
-  auto d_lw_clrsky_flux_up = get_field_out("LW_clrsky_flux_up").get_view<Real**>();
-  auto d_lw_clrsky_flux_dn = get_field_out("LW_clrsky_flux_dn").get_view<Real**>();
   auto d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
-  auto d_sfc_flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
-  auto d_sfc_flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
-  auto d_sfc_flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
-  auto d_sfc_flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
-  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
-  auto d_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
-  auto d_cldlow = get_field_out("cldlow").get_view<Real*>();
-  auto d_cldmed = get_field_out("cldmed").get_view<Real*>();
-  auto d_cldhgh = get_field_out("cldhgh").get_view<Real*>();
-  auto d_cldtot = get_field_out("cldtot").get_view<Real*>();
 
-  constexpr auto stebol = PC::stebol;
   const auto nlay = m_nlay;
-  const auto nlwbands = m_nlwbands;
-  const auto nswbands = m_nswbands;
-  const auto nlwgpts = m_nlwgpts;
 
   // Are we going to update fluxes and heating this step?
   auto ts = timestamp();
@@ -474,198 +482,52 @@ void RRTMGPRadiation::run_impl (const double dt) {
     shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
                      obliqr, &delta, &eccf);
 
-    // Loop over each chunk of columns
-    for (int ic=0; ic<m_num_col_chunks; ++ic) {
-      const int beg  = m_col_chunk_beg[ic];
-      const int ncol = m_col_chunk_beg[ic+1] - beg;
-      this->log(LogLevel::debug,
-                "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) + "\n");
-
-
-      // Create YAKL arrays. RRTMGP expects YAKL arrays with styleFortran, i.e., data has ncol
-      // as the fastest index. For this reason we must copy the data.
-      auto subview_1d = [&](const real1d v) -> real1d {
-        return real1d(v.label(),v.myData,ncol);
-      };
-      auto subview_2d = [&](const real2d v) -> real2d {
-        return real2d(v.label(),v.myData,ncol,v.dimension[1]);
-      };
-      auto subview_3d = [&](const real3d v) -> real3d {
-        return real3d(v.label(),v.myData,ncol,v.dimension[1],v.dimension[2]);
-      };
-
-      auto p_lay           = subview_2d(m_buffer.p_lay);
-      auto t_lay           = subview_2d(m_buffer.t_lay);
-      auto p_lev           = subview_2d(m_buffer.p_lev);
-      auto p_del           = subview_2d(m_buffer.p_del);
-      auto t_lev           = subview_2d(m_buffer.t_lev);
-      auto mu0             = subview_1d(m_buffer.mu0);
-      auto sfc_alb_dir     = subview_2d(m_buffer.sfc_alb_dir);
-      auto sfc_alb_dif     = subview_2d(m_buffer.sfc_alb_dif);
-      auto sfc_alb_dir_vis = subview_1d(m_buffer.sfc_alb_dir_vis);
-      auto sfc_alb_dir_nir = subview_1d(m_buffer.sfc_alb_dir_nir);
-      auto sfc_alb_dif_vis = subview_1d(m_buffer.sfc_alb_dif_vis);
-      auto sfc_alb_dif_nir = subview_1d(m_buffer.sfc_alb_dif_nir);
-      auto qc              = subview_2d(m_buffer.qc);
-      auto qi              = subview_2d(m_buffer.qi);
-      auto cldfrac_tot     = subview_2d(m_buffer.cldfrac_tot);
-      auto rel             = subview_2d(m_buffer.eff_radius_qc);
-      auto rei             = subview_2d(m_buffer.eff_radius_qi);
-      auto sw_flux_up      = subview_2d(m_buffer.sw_flux_up);
-      auto sw_flux_dn      = subview_2d(m_buffer.sw_flux_dn);
-      auto sw_flux_dn_dir  = subview_2d(m_buffer.sw_flux_dn_dir);
-      auto lw_flux_up      = subview_2d(m_buffer.lw_flux_up);
-      auto lw_flux_dn      = subview_2d(m_buffer.lw_flux_dn);
-      auto sw_clrsky_flux_up      = subview_2d(m_buffer.sw_clrsky_flux_up);
-      auto sw_clrsky_flux_dn      = subview_2d(m_buffer.sw_clrsky_flux_dn);
-      auto sw_clrsky_flux_dn_dir  = subview_2d(m_buffer.sw_clrsky_flux_dn_dir);
-      auto lw_clrsky_flux_up      = subview_2d(m_buffer.lw_clrsky_flux_up);
-      auto lw_clrsky_flux_dn      = subview_2d(m_buffer.lw_clrsky_flux_dn);
-      auto sw_bnd_flux_up  = subview_3d(m_buffer.sw_bnd_flux_up);
-      auto sw_bnd_flux_dn  = subview_3d(m_buffer.sw_bnd_flux_dn);
-      auto sw_bnd_flux_dir = subview_3d(m_buffer.sw_bnd_flux_dir);
-      auto sw_bnd_flux_dif = subview_3d(m_buffer.sw_bnd_flux_dif);
-      auto lw_bnd_flux_up  = subview_3d(m_buffer.lw_bnd_flux_up);
-      auto lw_bnd_flux_dn  = subview_3d(m_buffer.lw_bnd_flux_dn);
-      auto sfc_flux_dir_vis = subview_1d(m_buffer.sfc_flux_dir_vis);
-      auto sfc_flux_dir_nir = subview_1d(m_buffer.sfc_flux_dir_nir);
-      auto sfc_flux_dif_vis = subview_1d(m_buffer.sfc_flux_dif_vis);
-      auto sfc_flux_dif_nir = subview_1d(m_buffer.sfc_flux_dif_nir);
-      auto aero_tau_sw     = subview_3d(m_buffer.aero_tau_sw);
-      auto aero_ssa_sw     = subview_3d(m_buffer.aero_ssa_sw);
-      auto aero_g_sw       = subview_3d(m_buffer.aero_g_sw);
-      auto aero_tau_lw     = subview_3d(m_buffer.aero_tau_lw);
-      auto cld_tau_sw_gpt  = subview_3d(m_buffer.cld_tau_sw_gpt);
-      auto cld_tau_lw_gpt  = subview_3d(m_buffer.cld_tau_lw_gpt);
-
-      // Set gas concs to "view" only the first ncol columns
-      m_gas_concs.ncol = ncol;
-      m_gas_concs.concs = subview_3d(gas_concs);
-
-      // Copy data from the FieldManager to the YAKL arrays
-      {
-        // Determine the cosine zenith angle
-        // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
-        //       deep copied to a device view.
-        auto d_mu0 = m_buffer.cosine_zenith;
-        auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
-        if (m_fixed_solar_zenith_angle > 0) {
-          for (int i=0; i<ncol; i++) {
-            h_mu0(i) = m_fixed_solar_zenith_angle;
-          }
-        } else {
-          // Now use solar declination to calculate zenith angle for all points
-          for (int i=0;i<ncol;i++) {
-            double lat = h_lat(i+beg)*PC::Pi/180.0;  // Convert lat/lon to radians
-            double lon = h_lon(i+beg)*PC::Pi/180.0;
-            h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
-          }
+    // The following inputs do not depend on the chunk, so compute them for all columns at once.
+    {
+      // Determine the cosine zenith angle
+      // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
+      //       deep copied to a device view.
+      auto h_mu0 = Kokkos::create_mirror_view(m_mu0);
+      if (m_fixed_solar_zenith_angle > 0) {
+        for (int i=0; i<m_ncol; i++) {
+          h_mu0(i) = m_fixed_solar_zenith_angle;
         }
-        Kokkos::deep_copy(d_mu0,h_mu0);
-
-        // dz and T_int will need to be computed
-        view_2d_real d_tint("T_int", ncol, m_nlay+1);
-        view_2d_real d_dz  ("dz",    ncol, m_nlay);
-
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int i = team.league_rank();
-          const int icol = i+beg;
-
-          // Calculate dz
-          const auto pseudo_density = ekat::subview(d_pdel, icol);
-          const auto p_mid          = ekat::subview(d_pmid, icol);
-          const auto T_mid          = ekat::subview(d_tmid, icol);
-          const auto qv             = ekat::subview(d_qv,   icol);
-          const auto dz             = ekat::subview(d_dz,   i);
-          PF::calculate_dz<Real>(team, pseudo_density, p_mid, T_mid, qv, dz);
-          team.team_barrier();
-
-          // Calculate T_int from longwave flux up from the surface, assuming
-          // blackbody emission with emissivity of 1.
-          // TODO: Does land model assume something other than emissivity of 1? If so
-          // we should use that here rather than assuming perfect blackbody emission.
-          // NOTE: RRTMGP can accept vertical ordering surface to toa, or toa to
-          // surface. The input data for the standalone test is ordered surface to
-          // toa, but SCREAM in general assumes data is toa to surface. We account
-          // for this here by swapping bc_top and bc_bot in the case that the input
-          // data is ordered surface to toa.
-          const auto T_int = ekat::subview(d_tint, i);
-          const auto P_mid = ekat::subview(d_pmid, icol);
-          const int itop = (P_mid(0) < P_mid(nlay-1)) ? 0 : nlay-1;
-          const Real bc_top = T_mid(itop);
-          const Real bc_bot = sqrt(sqrt(d_surf_lw_flux_up(icol)/stebol));
-          if (itop == 0) {
-              CO::compute_interface_values_linear(team, nlay, T_mid, dz, bc_top, bc_bot, T_int);
-          } else {
-              CO::compute_interface_values_linear(team, nlay, T_mid, dz, bc_bot, bc_top, T_int);
-          }
-          team.team_barrier();
-
-          mu0(i+1) = d_mu0(i);
-          sfc_alb_dir_vis(i+1) = d_sfc_alb_dir_vis(icol);
-          sfc_alb_dir_nir(i+1) = d_sfc_alb_dir_nir(icol);
-          sfc_alb_dif_vis(i+1) = d_sfc_alb_dif_vis(icol);
-          sfc_alb_dif_nir(i+1) = d_sfc_alb_dif_nir(icol);
-
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-            p_lay(i+1,k+1)       = d_pmid(icol,k);
-            t_lay(i+1,k+1)       = d_tmid(icol,k);
-            p_del(i+1,k+1)       = d_pdel(icol,k);
-            qc(i+1,k+1)          = d_qc(icol,k);
-            qi(i+1,k+1)          = d_qi(icol,k);
-            rel(i+1,k+1)         = d_rel(icol,k);
-            rei(i+1,k+1)         = d_rei(icol,k);
-            p_lev(i+1,k+1)       = d_pint(icol,k);
-            t_lev(i+1,k+1)       = d_tint(i,k);
-          });
-
-          p_lev(i+1,nlay+1) = d_pint(icol,nlay);
-          t_lev(i+1,nlay+1) = d_tint(i,nlay);
+      } else {
+        // Now use solar declination to calculate zenith angle for all points
+        for (int i=0;i<m_ncol;i++) {
+          double lat = h_lat(i)*PC::Pi/180.0;  // Convert lat/lon to radians
+          double lon = h_lon(i)*PC::Pi/180.0;
+          h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
+        }
+      }
+      Kokkos::deep_copy(m_mu0,h_mu0);
 
-          // Note that RRTMGP expects ordering (col,lay,bnd) but the FM keeps things in (col,bnd,lay) order
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nswbands*nlay), [&] (const int&idx) {
-              auto b = idx / nlay;
-              auto k = idx % nlay;
-              aero_tau_sw(i+1,k+1,b+1) = d_aero_tau_sw(icol,b,k);
-              aero_ssa_sw(i+1,k+1,b+1) = d_aero_ssa_sw(icol,b,k);
-              aero_g_sw  (i+1,k+1,b+1) = d_aero_g_sw  (icol,b,k);
-          });
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlwbands*nlay), [&] (const int&idx) {
-              auto b = idx / nlay;
-              auto k = idx % nlay;
-              aero_tau_lw(i+1,k+1,b+1) = d_aero_tau_lw(icol,b,k);
-          });
-        });
+      if (m_do_aerosol_rad) {
+        Kokkos::deep_copy(m_aero_tau_sw,get_field_in("aero_tau_sw").get_view<const Real***>());
+        Kokkos::deep_copy(m_aero_ssa_sw,get_field_in("aero_ssa_sw").get_view<const Real***>());
+        Kokkos::deep_copy(m_aero_g_sw  ,get_field_in("aero_g_sw"  ).get_view<const Real***>());
+        Kokkos::deep_copy(m_aero_tau_lw,get_field_in("aero_tau_lw").get_view<const Real***>());
       }
-      Kokkos::fence();
 
-      // Populate GasConcs object to pass to RRTMGP driver
-      // set_vmr requires the input array size to have the correct size,
-      // and the last chunk may have less columns, so create a temp of
-      // correct size that uses m_buffer.tmp2d's pointer
-      //
-      // h2o is taken from qv and requies no initialization here;
+      // Compute gas volume mixing ratios
+      // h2o is taken from qv;
       // o3 is computed elsewhere (either read from file or computed by chemistry);
       // n2 and co are set to constants and are not handled by trcmix;
       // the rest are handled by trcmix
-      real2d tmp2d = subview_2d(m_buffer.tmp2d);
       const auto gas_mol_weights = m_gas_mol_weights;
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
       for (int igas = 0; igas < m_ngas; igas++) {
         auto name = m_gas_names[igas];
         auto d_vmr = get_field_out(name + "_volume_mix_ratio").get_view<Real**>();
         if (name == "h2o") {
           // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
           // Convert to vmr
-          const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
           Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
             const int i = team.league_rank();
-            const int icol = i + beg;
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-              d_vmr(icol,k) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(icol,k),d_qv(icol,k));
+              d_vmr(i,k) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(i,k),d_qv(i,k));
             });
           });
-          Kokkos::fence();
         } else if (name == "o3") {
           // We read o3 in as a vmr already
         } else if (name == "n2") {
@@ -682,7 +544,6 @@ void RRTMGPRadiation::run_impl (const double dt) {
           );
           // Back out volume mixing ratios
           const auto air_mol_weight = PC::MWdry;
-          const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
           Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
             const int i = team.league_rank();
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -690,195 +551,77 @@ void RRTMGPRadiation::run_impl (const double dt) {
             });
           });
         }
-
-        // Copy to YAKL
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int i = team.league_rank();
-          const int icol = i + beg;
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-            tmp2d(i+1,k+1) = d_vmr(icol,k); // Note that for YAKL arrays i and k start with index 1
-          });
-        });
-        Kokkos::fence();
-
-        // Populate GasConcs object
-        m_gas_concs.set_vmr(name, tmp2d);
-      }
-
-      // Set layer cloud fraction.
-      //
-      // If not doing subcolumn sampling for mcica, we want to make sure we use grid-mean
-      // condensate for computing cloud optical properties, because we are assuming the
-      // entire column is completely clear or cloudy. Thus, in this case we want to set
-      // cloud fraction to 0 or 1. Note that we could choose an alternative threshold
-      // criteria here, like qc + qi > 1e-5 or something.
-      //
-      // If we *are* doing subcolumn sampling for MCICA, then keep cloud fraction as input
-      // from cloud fraction parameterization, wherever that is computed.
-      auto do_subcol_sampling = m_do_subcol_sampling;
-      auto lwp = m_buffer.lwp;
-      auto iwp = m_buffer.iwp;
-      if (not do_subcol_sampling) {
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int i = team.league_rank();
-          const int icol = i + beg;
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-            if (d_cldfrac_tot(icol,k) > 0) {
-              cldfrac_tot(i+1,k+1) = 1;
-            } else {
-              cldfrac_tot(i+1,k+1) = 0;
-            }
-          });
-        });
-      } else {
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int i = team.league_rank();
-          const int icol = i + beg;
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-            cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k);
-          });
-        });
       }
       Kokkos::fence();
-      // Compute layer cloud mass (per unit area)
-      scream::rrtmgp::mixing_ratio_to_cloud_mass(qc, cldfrac_tot, p_del, lwp);
-      scream::rrtmgp::mixing_ratio_to_cloud_mass(qi, cldfrac_tot, p_del, iwp);
-      // Convert to g/m2 (needed by RRTMGP)
-      {
-      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-        const int i = team.league_rank();
-        Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
-          // Note that for YAKL arrays i and k start with index 1
-          lwp(i+1,k+1) *= 1e3;
-          iwp(i+1,k+1) *= 1e3;
-        });
-      });
-      }
+    }
+
+    std::chrono::steady_clock::time_point start;
+    const bool tuning = m_tuning_idx<static_cast<int>(m_tuning_chunk_sizes.size());
+    if (tuning) {
+      // Time all ranks from the same point, after all prior work is done
       Kokkos::fence();
+      m_comm.barrier();
+      start = std::chrono::steady_clock::now();
+    }
 
-      // Compute band-by-band surface_albedos. This is needed since
-      // the AD passes broadband albedos, but rrtmgp require band-by-band.
-      rrtmgp::compute_band_by_band_surface_albedos(
-        ncol, nswbands,
-        sfc_alb_dir_vis, sfc_alb_dir_nir,
-        sfc_alb_dif_vis, sfc_alb_dif_nir,
-        sfc_alb_dir, sfc_alb_dif);
-
-      // Compute cloud optical properties here?
-
-      // Run RRTMGP driver
-      rrtmgp::rrtmgp_main(
-        ncol, m_nlay,
-        p_lay, t_lay, p_lev, t_lev,
-        m_gas_concs,
-        sfc_alb_dir, sfc_alb_dif, mu0,
-        lwp, iwp, rel, rei, cldfrac_tot,
-        aero_tau_sw, aero_ssa_sw, aero_g_sw, aero_tau_lw,
-        cld_tau_sw_gpt, cld_tau_lw_gpt,
-        sw_flux_up       , sw_flux_dn       , sw_flux_dn_dir       , lw_flux_up       , lw_flux_dn,
-        sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dn_dir, lw_clrsky_flux_up, lw_clrsky_flux_dn,
-        sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
-        eccf, m_atm_logger
-      );
-
-      // Update heating tendency
-      auto sw_heating  = m_buffer.sw_heating;
-      auto lw_heating  = m_buffer.lw_heating;
-      rrtmgp::compute_heating_rate(
-        sw_flux_up, sw_flux_dn, p_del, sw_heating
-      );
-      rrtmgp::compute_heating_rate(
-        lw_flux_up, lw_flux_dn, p_del, lw_heating
-      );
-      {
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-          const int idx = team.league_rank();
-          const int icol = idx+beg;
-          Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
-            // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
-            // Note that for YAKL arrays i and k start with index 1
-            d_rad_heating_pdel(icol,ilay) = sw_heating(idx+1,ilay+1) + lw_heating(idx+1,ilay+1);
-          });
-        });
-      }
+    // Loop over each chunk of columns
+    if (m_pipeline_chunks) {
+      // While chunk ic is being solved, copy in chunk ic+1 on a separate
+      // execution space instance, using the other buffer.
+      copy_in_chunk(0,m_buffers[0],ExeSpace());
       Kokkos::fence();
+      for (int ic=0; ic<m_num_col_chunks; ++ic) {
+        const auto& buf = m_buffers[ic % 2];
+        prepare_chunk(ic,buf,gas_concs);
+        if (ic+1<m_num_col_chunks) {
+          copy_in_chunk(ic+1,m_buffers[(ic+1) % 2],m_pipe_space);
+        }
+        solve_chunk(ic,buf,eccf);
 
-      // Index to surface (bottom of model); used to get surface fluxes below
-      const int kbot = nlay+1;
-
-      // Compute diffuse flux as difference between total and direct
-      Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
-                           KOKKOS_LAMBDA (const int idx) {
-        // CAREFUL: these are YAKL arrays, with "LayoutLeft". So make the indices stride accordingly, and add 1.
-        const int ibnd = (idx / ncol) / (nlay+1) + 1;
-        const int ilev = (idx / ncol) % (nlay+1) + 1;
-        const int icol =  idx % ncol + 1;
-        sw_bnd_flux_dif(icol,ilev,ibnd) = sw_bnd_flux_dn(icol,ilev,ibnd) - sw_bnd_flux_dir(icol,ilev,ibnd);
-      });
-      // Compute surface fluxes
-      rrtmgp::compute_broadband_surface_fluxes(
-          ncol, kbot, nswbands,
-          sw_bnd_flux_dir, sw_bnd_flux_dif,
-          sfc_flux_dir_vis, sfc_flux_dir_nir,
-          sfc_flux_dif_vis, sfc_flux_dif_nir
-      );
-
-      // Compute diagnostic total cloud area (vertically-projected cloud cover)
-      auto cldlow = real1d("cldlow", ncol);
-      auto cldmed = real1d("cldmed", ncol);
-      auto cldhgh = real1d("cldhgh", ncol);
-      auto cldtot = real1d("cldtot", ncol);
-      // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
-      // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
-      // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
-      // does not matter in practice, as clouds probably should not be produced above 50 hPa and we
-      // should not be encountering surface pressure above 1200 hPa, but in the event that things go off
-      // the rails we might want to look at these still.
-      rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts, 700e2, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldlow);
-      rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts, 400e2,                            700e2, p_lay, cld_tau_lw_gpt, cldmed);
-      rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0,                            400e2, p_lay, cld_tau_lw_gpt, cldhgh);
-      rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldtot);
-
-      // Copy output data back to FieldManager
-      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-        const int i = team.league_rank();
-        const int icol = i + beg;
-        d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir(i+1);
-        d_sfc_flux_dir_vis(icol) = sfc_flux_dir_vis(i+1);
-        d_sfc_flux_dif_nir(icol) = sfc_flux_dif_nir(i+1);
-        d_sfc_flux_dif_vis(icol) = sfc_flux_dif_vis(i+1);
-        d_sfc_flux_sw_net(icol)  = sw_flux_dn(i+1,kbot) - sw_flux_up(i+1,kbot);
-        d_sfc_flux_lw_dn(icol)   = lw_flux_dn(i+1,kbot);
-        d_cldlow(icol) = cldlow(i+1);
-        d_cldmed(icol) = cldmed(i+1);
-        d_cldhgh(icol) = cldhgh(i+1);
-        d_cldtot(icol) = cldtot(i+1);
-        Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay+1), [&] (const int& k) {
-          d_sw_flux_up(icol,k)            = sw_flux_up(i+1,k+1);
-          d_sw_flux_dn(icol,k)            = sw_flux_dn(i+1,k+1);
-          d_sw_flux_dn_dir(icol,k)        = sw_flux_dn_dir(i+1,k+1);
-          d_lw_flux_up(icol,k)            = lw_flux_up(i+1,k+1);
-          d_lw_flux_dn(icol,k)            = lw_flux_dn(i+1,k+1);
-          d_sw_clrsky_flux_up(icol,k)     = sw_clrsky_flux_up(i+1,k+1);
-          d_sw_clrsky_flux_dn(icol,k)     = sw_clrsky_flux_dn(i+1,k+1);
-          d_sw_clrsky_flux_dn_dir(icol,k) = sw_clrsky_flux_dn_dir(i+1,k+1);
-          d_lw_clrsky_flux_up(icol,k)     = lw_clrsky_flux_up(i+1,k+1);
-          d_lw_clrsky_flux_dn(icol,k)     = lw_clrsky_flux_dn(i+1,k+1);
-        });
-      });
-    } // loop over chunk
+        // Before moving on, the solve must be done with its buffer (which will be used
+        // by the copy-in of chunk ic+2), and the copy-in of chunk ic+1 must be complete.
+        Kokkos::fence();
+      }
+    } else {
+      for (int ic=0; ic<m_num_col_chunks; ++ic) {
+        copy_in_chunk(ic,m_buffers[0],ExeSpace());
+        Kokkos::fence();
+        prepare_chunk(ic,m_buffers[0],gas_concs);
+        solve_chunk(ic,m_buffers[0],eccf);
+      }
+    }
 
     // Restore the refCounted array.
     m_gas_concs.concs = gas_concs;
 
+    if (tuning) {
+      Kokkos::fence();
+      const auto finish = std::chrono::steady_clock::now();
+      // The step is as slow as the slowest rank, and all ranks must pick the same size
+      const double my_time = std::chrono::duration<double>(finish-start).count();
+      double max_time;
+      m_comm.all_reduce(&my_time,&max_time,1,MPI_MAX);
+      m_tuning_times.push_back(max_time);
+      ++m_tuning_idx;
+      if (m_tuning_idx<static_cast<int>(m_tuning_chunk_sizes.size())) {
+        set_col_chunk_size(m_tuning_chunk_sizes[m_tuning_idx]);
+      } else {
+        // Done tuning: pick the fastest chunk size
+        const auto best = std::distance(m_tuning_times.begin(),
+            std::min_element(m_tuning_times.begin(),m_tuning_times.end()));
+        set_col_chunk_size(m_tuning_chunk_sizes[best]);
+        std::string msg = "[RRTMGP::run_impl] Col chunk size tuning:\n";
+        for (size_t i=0; i<m_tuning_times.size(); ++i) {
+          msg += "  - Chunk size " + std::to_string(m_tuning_chunk_sizes[i]) + ": "
+               + std::to_string(m_tuning_times[i]) + " s\n";
+        }
+        msg += "  - Selected chunk size: " + std::to_string(m_col_chunk_size) + "\n";
+        this->log(LogLevel::debug,msg);
+      }
+    }
   } // update_rad
 
+
   // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
@@ -929,6 +672,457 @@ void RRTMGPRadiation::run_impl (const double dt) {
 }
 // =========================================================================================
 
+void RRTMGPRadiation::set_col_chunk_size (const int chunk_size) {
+  EKAT_REQUIRE_MSG (chunk_size>0 && chunk_size<=m_max_col_chunk_size,
+      "Error! Invalid RRTMGP column chunk size.\n"
+      "  - Chunk size: " + std::to_string(chunk_size) + "\n"
+      "  - Max chunk size: " + std::to_string(m_max_col_chunk_size) + "\n");
+
+  m_col_chunk_size = chunk_size;
+  m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
+  m_col_chunk_beg.assign(m_num_col_chunks+1,0);
+  for (int i=0; i<m_num_col_chunks; ++i) {
+    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
+  }
+}
+
+// =========================================================================================
+
+void RRTMGPRadiation::copy_in_chunk (const int ic, const Buffer& buf, const ExeSpace& space) {
+  using PF = scream::PhysicsFunctions<DefaultDevice>;
+  using PC = scream::physics::Constants<Real>;
+  using CO = scream::ColumnOps<DefaultDevice,Real>;
+
+  const int beg  = m_col_chunk_beg[ic];
+  const int ncol = m_col_chunk_beg[ic+1] - beg;
+  this->log(LogLevel::debug,
+            "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) + "\n");
+
+  // Get data from the FieldManager
+  auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
+  auto d_pint = get_field_in("p_int").get_view<const Real**>();
+  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto d_qv = get_field_in("qv").get_view<const Real**>();
+  auto d_qc = get_field_in("qc").get_view<const Real**>();
+  auto d_qi = get_field_in("qi").get_view<const Real**>();
+  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
+  auto d_rel = get_field_in("eff_radius_qc").get_view<const Real**>();
+  auto d_rei = get_field_in("eff_radius_qi").get_view<const Real**>();
+  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_tmid = get_field_out("T_mid").get_view<const Real**>();
+  auto d_mu0 = m_mu0;
+  auto d_aero_tau_sw = m_aero_tau_sw;
+  auto d_aero_ssa_sw = m_aero_ssa_sw;
+  auto d_aero_g_sw   = m_aero_g_sw;
+  auto d_aero_tau_lw = m_aero_tau_lw;
+
+  constexpr auto stebol = PC::stebol;
+  const auto nlay = m_nlay;
+  const auto nlwbands = m_nlwbands;
+  const auto nswbands = m_nswbands;
+  const auto do_subcol_sampling = m_do_subcol_sampling;
+
+  // Create YAKL arrays. RRTMGP expects YAKL arrays with styleFortran, i.e., data has ncol
+  // as the fastest index. For this reason we must copy the data.
+  auto subview_1d = [&](const real1d v) -> real1d {
+    return real1d(v.label(),v.myData,ncol);
+  };
+  auto subview_2d = [&](const real2d v) -> real2d {
+    return real2d(v.label(),v.myData,ncol,v.dimension[1]);
+  };
+  auto subview_3d = [&](const real3d v) -> real3d {
+    return real3d(v.label(),v.myData,ncol,v.dimension[1],v.dimension[2]);
+  };
+
+  auto p_lay           = subview_2d(buf.p_lay);
+  auto t_lay           = subview_2d(buf.t_lay);
+  auto p_lev           = subview_2d(buf.p_lev);
+  auto p_del           = subview_2d(buf.p_del);
+  auto t_lev           = subview_2d(buf.t_lev);
+  auto mu0             = subview_1d(buf.mu0);
+  auto sfc_alb_dir_vis = subview_1d(buf.sfc_alb_dir_vis);
+  auto sfc_alb_dir_nir = subview_1d(buf.sfc_alb_dir_nir);
+  auto sfc_alb_dif_vis = subview_1d(buf.sfc_alb_dif_vis);
+  auto sfc_alb_dif_nir = subview_1d(buf.sfc_alb_dif_nir);
+  auto qc              = subview_2d(buf.qc);
+  auto qi              = subview_2d(buf.qi);
+  auto cldfrac_tot     = subview_2d(buf.cldfrac_tot);
+  auto rel             = subview_2d(buf.eff_radius_qc);
+  auto rei             = subview_2d(buf.eff_radius_qi);
+  auto aero_tau_sw     = subview_3d(buf.aero_tau_sw);
+  auto aero_ssa_sw     = subview_3d(buf.aero_ssa_sw);
+  auto aero_g_sw       = subview_3d(buf.aero_g_sw);
+  auto aero_tau_lw     = subview_3d(buf.aero_tau_lw);
+
+  // dz and T_int will need to be computed
+  view_2d_real d_tint(Kokkos::view_alloc(space,"T_int"), ncol, m_nlay+1);
+  view_2d_real d_dz  (Kokkos::view_alloc(space,"dz"),    ncol, m_nlay);
+
+  // Use the default team size, but launch on the given instance
+  const auto default_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+  const KT::TeamPolicy policy(space, ncol, default_policy.team_size(), default_policy.impl_vector_length());
+
+  // Copy data from the FieldManager to the YAKL arrays
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+    const int icol = i+beg;
+
+    // Calculate dz
+    const auto pseudo_density = ekat::subview(d_pdel, icol);
+    const auto p_mid          = ekat::subview(d_pmid, icol);
+    const auto T_mid          = ekat::subview(d_tmid, icol);
+    const auto qv             = ekat::subview(d_qv,   icol);
+    const auto dz             = ekat::subview(d_dz,   i);
+    PF::calculate_dz<Real>(team, pseudo_density, p_mid, T_mid, qv, dz);
+    team.team_barrier();
+
+    // Calculate T_int from longwave flux up from the surface, assuming
+    // blackbody emission with emissivity of 1.
+    // TODO: Does land model assume something other than emissivity of 1? If so
+    // we should use that here rather than assuming perfect blackbody emission.
+    // NOTE: RRTMGP can accept vertical ordering surface to toa, or toa to
+    // surface. The input data for the standalone test is ordered surface to
+    // toa, but SCREAM in general assumes data is toa to surface. We account
+    // for this here by swapping bc_top and bc_bot in the case that the input
+    // data is ordered surface to toa.
+    const auto T_int = ekat::subview(d_tint, i);
+    const auto P_mid = ekat::subview(d_pmid, icol);
+    const int itop = (P_mid(0) < P_mid(nlay-1)) ? 0 : nlay-1;
+    const Real bc_top = T_mid(itop);
+    const Real bc_bot = sqrt(sqrt(d_surf_lw_flux_up(icol)/stebol));
+    if (itop == 0) {
+        CO::compute_interface_values_linear(team, nlay, T_mid, dz, bc_top, bc_bot, T_int);
+    } else {
+        CO::compute_interface_values_linear(team, nlay, T_mid, dz, bc_bot, bc_top, T_int);
+    }
+    team.team_barrier();
+
+    mu0(i+1) = d_mu0(icol);
+    sfc_alb_dir_vis(i+1) = d_sfc_alb_dir_vis(icol);
+    sfc_alb_dir_nir(i+1) = d_sfc_alb_dir_nir(icol);
+    sfc_alb_dif_vis(i+1) = d_sfc_alb_dif_vis(icol);
+    sfc_alb_dif_nir(i+1) = d_sfc_alb_dif_nir(icol);
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+      p_lay(i+1,k+1)       = d_pmid(icol,k);
+      t_lay(i+1,k+1)       = d_tmid(icol,k);
+      p_del(i+1,k+1)       = d_pdel(icol,k);
+      qc(i+1,k+1)          = d_qc(icol,k);
+      qi(i+1,k+1)          = d_qi(icol,k);
+      rel(i+1,k+1)         = d_rel(icol,k);
+      rei(i+1,k+1)         = d_rei(icol,k);
+      p_lev(i+1,k+1)       = d_pint(icol,k);
+      t_lev(i+1,k+1)       = d_tint(i,k);
+
+      // Set layer cloud fraction.
+      //
+      // If not doing subcolumn sampling for mcica, we want to make sure we use grid-mean
+      // condensate for computing cloud optical properties, because we are assuming the
+      // entire column is completely clear or cloudy. Thus, in this case we want to set
+      // cloud fraction to 0 or 1. Note that we could choose an alternative threshold
+      // criteria here, like qc + qi > 1e-5 or something.
+      //
+      // If we *are* doing subcolumn sampling for MCICA, then keep cloud fraction as input
+      // from cloud fraction parameterization, wherever that is computed.
+      if (not do_subcol_sampling) {
+        cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k) > 0 ? 1 : 0;
+      } else {
+        cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k);
+      }
+    });
+
+    p_lev(i+1,nlay+1) = d_pint(icol,nlay);
+    t_lev(i+1,nlay+1) = d_tint(i,nlay);
+
+    // Note that RRTMGP expects ordering (col,lay,bnd) but the FM keeps things in (col,bnd,lay) order
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nswbands*nlay), [&] (const int&idx) {
+        auto b = idx / nlay;
+        auto k = idx % nlay;
+        aero_tau_sw(i+1,k+1,b+1) = d_aero_tau_sw(icol,b,k);
+        aero_ssa_sw(i+1,k+1,b+1) = d_aero_ssa_sw(icol,b,k);
+        aero_g_sw  (i+1,k+1,b+1) = d_aero_g_sw  (icol,b,k);
+    });
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlwbands*nlay), [&] (const int&idx) {
+        auto b = idx / nlay;
+        auto k = idx % nlay;
+        aero_tau_lw(i+1,k+1,b+1) = d_aero_tau_lw(icol,b,k);
+    });
+  });
+}
+
+// =========================================================================================
+
+void RRTMGPRadiation::prepare_chunk (const int ic, const Buffer& buf, const real3d& gas_concs) {
+  const int beg  = m_col_chunk_beg[ic];
+  const int ncol = m_col_chunk_beg[ic+1] - beg;
+  const auto nlay = m_nlay;
+  const auto nswbands = m_nswbands;
+
+  auto subview_1d = [&](const real1d v) -> real1d {
+    return real1d(v.label(),v.myData,ncol);
+  };
+  auto subview_2d = [&](const real2d v) -> real2d {
+    return real2d(v.label(),v.myData,ncol,v.dimension[1]);
+  };
+  auto subview_3d = [&](const real3d v) -> real3d {
+    return real3d(v.label(),v.myData,ncol,v.dimension[1],v.dimension[2]);
+  };
+
+  auto p_del           = subview_2d(buf.p_del);
+  auto sfc_alb_dir     = subview_2d(buf.sfc_alb_dir);
+  auto sfc_alb_dif     = subview_2d(buf.sfc_alb_dif);
+  auto sfc_alb_dir_vis = subview_1d(buf.sfc_alb_dir_vis);
+  auto sfc_alb_dir_nir = subview_1d(buf.sfc_alb_dir_nir);
+  auto sfc_alb_dif_vis = subview_1d(buf.sfc_alb_dif_vis);
+  auto sfc_alb_dif_nir = subview_1d(buf.sfc_alb_dif_nir);
+  auto qc              = subview_2d(buf.qc);
+  auto qi              = subview_2d(buf.qi);
+  auto cldfrac_tot     = subview_2d(buf.cldfrac_tot);
+
+  // Set gas concs to "view" only the first ncol columns
+  m_gas_concs.ncol = ncol;
+  m_gas_concs.concs = subview_3d(gas_concs);
+
+  // Populate GasConcs object to pass to RRTMGP driver
+  // set_vmr requires the input array size to have the correct size,
+  // and the last chunk may have less columns, so create a temp of
+  // correct size that uses buf.tmp2d's pointer
+  real2d tmp2d = subview_2d(buf.tmp2d);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+  for (int igas = 0; igas < m_ngas; igas++) {
+    auto name = m_gas_names[igas];
+    auto d_vmr = get_field_out(name + "_volume_mix_ratio").get_view<const Real**>();
+
+    // Copy to YAKL
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int i = team.league_rank();
+      const int icol = i + beg;
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+        tmp2d(i+1,k+1) = d_vmr(icol,k); // Note that for YAKL arrays i and k start with index 1
+      });
+    });
+    Kokkos::fence();
+
+    // Populate GasConcs object
+    m_gas_concs.set_vmr(name, tmp2d);
+  }
+
+  // Compute layer cloud mass (per unit area)
+  auto lwp = buf.lwp;
+  auto iwp = buf.iwp;
+  scream::rrtmgp::mixing_ratio_to_cloud_mass(qc, cldfrac_tot, p_del, lwp);
+  scream::rrtmgp::mixing_ratio_to_cloud_mass(qi, cldfrac_tot, p_del, iwp);
+  // Convert to g/m2 (needed by RRTMGP)
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+      // Note that for YAKL arrays i and k start with index 1
+      lwp(i+1,k+1) *= 1e3;
+      iwp(i+1,k+1) *= 1e3;
+    });
+  });
+  Kokkos::fence();
+
+  // Compute band-by-band surface_albedos. This is needed since
+  // the AD passes broadband albedos, but rrtmgp require band-by-band.
+  rrtmgp::compute_band_by_band_surface_albedos(
+    ncol, nswbands,
+    sfc_alb_dir_vis, sfc_alb_dir_nir,
+    sfc_alb_dif_vis, sfc_alb_dif_nir,
+    sfc_alb_dir, sfc_alb_dif);
+}
+
+// =========================================================================================
+
+void RRTMGPRadiation::solve_chunk (const int ic, const Buffer& buf, const double eccf) {
+  const int beg  = m_col_chunk_beg[ic];
+  const int ncol = m_col_chunk_beg[ic+1] - beg;
+  const auto nlay = m_nlay;
+  const auto nswbands = m_nswbands;
+  const auto nlwgpts = m_nlwgpts;
+
+  // Output fields
+  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
+  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
+  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+  auto d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
+  auto d_sw_clrsky_flux_up = get_field_out("SW_clrsky_flux_up").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn = get_field_out("SW_clrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn_dir = get_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
+  auto d_lw_clrsky_flux_up = get_field_out("LW_clrsky_flux_up").get_view<Real**>();
+  auto d_lw_clrsky_flux_dn = get_field_out("LW_clrsky_flux_dn").get_view<Real**>();
+  auto d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
+  auto d_sfc_flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
+  auto d_sfc_flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
+  auto d_sfc_flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
+  auto d_sfc_flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
+  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto d_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  auto d_cldlow = get_field_out("cldlow").get_view<Real*>();
+  auto d_cldmed = get_field_out("cldmed").get_view<Real*>();
+  auto d_cldhgh = get_field_out("cldhgh").get_view<Real*>();
+  auto d_cldtot = get_field_out("cldtot").get_view<Real*>();
+
+  auto subview_1d = [&](const real1d v) -> real1d {
+    return real1d(v.label(),v.myData,ncol);
+  };
+  auto subview_2d = [&](const real2d v) -> real2d {
+    return real2d(v.label(),v.myData,ncol,v.dimension[1]);
+  };
+  auto subview_3d = [&](const real3d v) -> real3d {
+    return real3d(v.label(),v.myData,ncol,v.dimension[1],v.dimension[2]);
+  };
+
+  auto p_lay           = subview_2d(buf.p_lay);
+  auto t_lay           = subview_2d(buf.t_lay);
+  auto p_lev           = subview_2d(buf.p_lev);
+  auto p_del           = subview_2d(buf.p_del);
+  auto t_lev           = subview_2d(buf.t_lev);
+  auto mu0             = subview_1d(buf.mu0);
+  auto sfc_alb_dir     = subview_2d(buf.sfc_alb_dir);
+  auto sfc_alb_dif     = subview_2d(buf.sfc_alb_dif);
+  auto cldfrac_tot     = subview_2d(buf.cldfrac_tot);
+  auto rel             = subview_2d(buf.eff_radius_qc);
+  auto rei             = subview_2d(buf.eff_radius_qi);
+  auto sw_flux_up      = subview_2d(buf.sw_flux_up);
+  auto sw_flux_dn      = subview_2d(buf.sw_flux_dn);
+  auto sw_flux_dn_dir  = subview_2d(buf.sw_flux_dn_dir);
+  auto lw_flux_up      = subview_2d(buf.lw_flux_up);
+  auto lw_flux_dn      = subview_2d(buf.lw_flux_dn);
+  auto sw_clrsky_flux_up      = subview_2d(buf.sw_clrsky_flux_up);
+  auto sw_clrsky_flux_dn      = subview_2d(buf.sw_clrsky_flux_dn);
+  auto sw_clrsky_flux_dn_dir  = subview_2d(buf.sw_clrsky_flux_dn_dir);
+  auto lw_clrsky_flux_up      = subview_2d(buf.lw_clrsky_flux_up);
+  auto lw_clrsky_flux_dn      = subview_2d(buf.lw_clrsky_flux_dn);
+  auto sw_bnd_flux_up  = subview_3d(buf.sw_bnd_flux_up);
+  auto sw_bnd_flux_dn  = subview_3d(buf.sw_bnd_flux_dn);
+  auto sw_bnd_flux_dir = subview_3d(buf.sw_bnd_flux_dir);
+  auto sw_bnd_flux_dif = subview_3d(buf.sw_bnd_flux_dif);
+  auto lw_bnd_flux_up  = subview_3d(buf.lw_bnd_flux_up);
+  auto lw_bnd_flux_dn  = subview_3d(buf.lw_bnd_flux_dn);
+  auto sfc_flux_dir_vis = subview_1d(buf.sfc_flux_dir_vis);
+  auto sfc_flux_dir_nir = subview_1d(buf.sfc_flux_dir_nir);
+  auto sfc_flux_dif_vis = subview_1d(buf.sfc_flux_dif_vis);
+  auto sfc_flux_dif_nir = subview_1d(buf.sfc_flux_dif_nir);
+  auto aero_tau_sw     = subview_3d(buf.aero_tau_sw);
+  auto aero_ssa_sw     = subview_3d(buf.aero_ssa_sw);
+  auto aero_g_sw       = subview_3d(buf.aero_g_sw);
+  auto aero_tau_lw     = subview_3d(buf.aero_tau_lw);
+  auto cld_tau_sw_gpt  = subview_3d(buf.cld_tau_sw_gpt);
+  auto cld_tau_lw_gpt  = subview_3d(buf.cld_tau_lw_gpt);
+  auto lwp             = buf.lwp;
+  auto iwp             = buf.iwp;
+
+  // Run RRTMGP driver
+  rrtmgp::rrtmgp_main(
+    ncol, m_nlay,
+    p_lay, t_lay, p_lev, t_lev,
+    m_gas_concs,
+    sfc_alb_dir, sfc_alb_dif, mu0,
+    lwp, iwp, rel, rei, cldfrac_tot,
+    aero_tau_sw, aero_ssa_sw, aero_g_sw, aero_tau_lw,
+    cld_tau_sw_gpt, cld_tau_lw_gpt,
+    sw_flux_up       , sw_flux_dn       , sw_flux_dn_dir       , lw_flux_up       , lw_flux_dn,
+    sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dn_dir, lw_clrsky_flux_up, lw_clrsky_flux_dn,
+    sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
+    eccf, m_atm_logger
+  );
+
+  // Update heating tendency
+  auto sw_heating  = buf.sw_heating;
+  auto lw_heating  = buf.lw_heating;
+  rrtmgp::compute_heating_rate(
+    sw_flux_up, sw_flux_dn, p_del, sw_heating
+  );
+  rrtmgp::compute_heating_rate(
+    lw_flux_up, lw_flux_dn, p_del, lw_heating
+  );
+  {
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int idx = team.league_rank();
+      const int icol = idx+beg;
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
+        // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
+        // Note that for YAKL arrays i and k start with index 1
+        d_rad_heating_pdel(icol,ilay) = sw_heating(idx+1,ilay+1) + lw_heating(idx+1,ilay+1);
+      });
+    });
+  }
+  Kokkos::fence();
+
+  // Index to surface (bottom of model); used to get surface fluxes below
+  const int kbot = nlay+1;
+
+  // Compute diffuse flux as difference between total and direct
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
+                       KOKKOS_LAMBDA (const int idx) {
+    // CAREFUL: these are YAKL arrays, with "LayoutLeft". So make the indices stride accordingly, and add 1.
+    const int ibnd = (idx / ncol) / (nlay+1) + 1;
+    const int ilev = (idx / ncol) % (nlay+1) + 1;
+    const int icol =  idx % ncol + 1;
+    sw_bnd_flux_dif(icol,ilev,ibnd) = sw_bnd_flux_dn(icol,ilev,ibnd) - sw_bnd_flux_dir(icol,ilev,ibnd);
+  });
+  // Compute surface fluxes
+  rrtmgp::compute_broadband_surface_fluxes(
+      ncol, kbot, nswbands,
+      sw_bnd_flux_dir, sw_bnd_flux_dif,
+      sfc_flux_dir_vis, sfc_flux_dir_nir,
+      sfc_flux_dif_vis, sfc_flux_dif_nir
+  );
+
+  // Compute diagnostic total cloud area (vertically-projected cloud cover)
+  auto cldlow = real1d("cldlow", ncol);
+  auto cldmed = real1d("cldmed", ncol);
+  auto cldhgh = real1d("cldhgh", ncol);
+  auto cldtot = real1d("cldtot", ncol);
+  // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
+  // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
+  // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
+  // does not matter in practice, as clouds probably should not be produced above 50 hPa and we
+  // should not be encountering surface pressure above 1200 hPa, but in the event that things go off
+  // the rails we might want to look at these still.
+  rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts, 700e2, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldlow);
+  rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts, 400e2,                            700e2, p_lay, cld_tau_lw_gpt, cldmed);
+  rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0,                            400e2, p_lay, cld_tau_lw_gpt, cldhgh);
+  rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldtot);
+
+  // Copy output data back to FieldManager
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+    const int icol = i + beg;
+    d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir(i+1);
+    d_sfc_flux_dir_vis(icol) = sfc_flux_dir_vis(i+1);
+    d_sfc_flux_dif_nir(icol) = sfc_flux_dif_nir(i+1);
+    d_sfc_flux_dif_vis(icol) = sfc_flux_dif_vis(i+1);
+    d_sfc_flux_sw_net(icol)  = sw_flux_dn(i+1,kbot) - sw_flux_up(i+1,kbot);
+    d_sfc_flux_lw_dn(icol)   = lw_flux_dn(i+1,kbot);
+    d_cldlow(icol) = cldlow(i+1);
+    d_cldmed(icol) = cldmed(i+1);
+    d_cldhgh(icol) = cldhgh(i+1);
+    d_cldtot(icol) = cldtot(i+1);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay+1), [&] (const int& k) {
+      d_sw_flux_up(icol,k)            = sw_flux_up(i+1,k+1);
+      d_sw_flux_dn(icol,k)            = sw_flux_dn(i+1,k+1);
+      d_sw_flux_dn_dir(icol,k)        = sw_flux_dn_dir(i+1,k+1);
+      d_lw_flux_up(icol,k)            = lw_flux_up(i+1,k+1);
+      d_lw_flux_dn(icol,k)            = lw_flux_dn(i+1,k+1);
+      d_sw_clrsky_flux_up(icol,k)     = sw_clrsky_flux_up(i+1,k+1);
+      d_sw_clrsky_flux_dn(icol,k)     = sw_clrsky_flux_dn(i+1,k+1);
+      d_sw_clrsky_flux_dn_dir(icol,k) = sw_clrsky_flux_dn_dir(i+1,k+1);
+      d_lw_clrsky_flux_up(icol,k)     = lw_clrsky_flux_up(i+1,k+1);
+      d_lw_clrsky_flux_dn(icol,k)     = lw_clrsky_flux_dn(i+1,k+1);
+    });
+  });
+}
+// =========================================================================================
+
 void RRTMGPRadiation::finalize_impl  () {
   m_gas_concs.reset();
   rrtmgp::rrtmgp_finalize();
@@ -50,6 +50,24 @@ public:
   int m_num_col_chunks;
   int m_col_chunk_size;
   std::vector<int> m_col_chunk_beg;
+
+  // The largest chunk size, used to size the buffers. It is the user-provided
+  // chunk size, possibly reduced to fit in column_chunk_max_buffer_mb.
+  int m_max_col_chunk_size;
+
+  // If true, the copy-in of chunk N+1 runs on a separate execution space instance,
+  // overlapping the radiative transfer solve of chunk N. Requires two buffers.
+  bool m_pipeline_chunks;
+  int  m_num_buffers;
+  KT::ExeSpace m_pipe_space;
+
+  // If true, the first few radiation steps try different chunk sizes (all fitting
+  // in the buffers), and the fastest one is then used for the rest of the run
+  bool m_tune_chunk_size;
+  int  m_tuning_idx;
+  std::vector<int>    m_tuning_chunk_sizes;
+  std::vector<double> m_tuning_times;
+
   int m_nlay;
   Field m_lat;
   Field m_lon;
@@ -57,6 +75,13 @@ public:
   // Whether we use aerosol forcing in radiation
   bool m_do_aerosol_rad;
 
+  // Inputs needed by all chunks, computed once per radiation step
+  view_1d_real m_mu0;
+  view_3d_real m_aero_tau_sw;
+  view_3d_real m_aero_ssa_sw;
+  view_3d_real m_aero_g_sw;
+  view_3d_real m_aero_tau_lw;
+
   // The orbital year, used for zenith angle calculations:
   // If > 0, use constant orbital year for duration of simulation
   // If < 0, use year from timestamp for orbital parameters
@@ -102,7 +127,7 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-    static constexpr int num_1d_ncol        = 10;
+    static constexpr int num_1d_ncol        = 9;
     static constexpr int num_2d_nlay        = 13;
     static constexpr int num_2d_nlay_p1     = 12;
     static constexpr int num_2d_nswbands    = 2;
@@ -119,7 +144,6 @@ public:
     real1d sfc_alb_dir_nir;
     real1d sfc_alb_dif_vis;
     real1d sfc_alb_dif_nir;
-    uview_1d<Real> cosine_zenith;
     real1d sfc_flux_dir_vis;
     real1d sfc_flux_dir_nir;
     real1d sfc_flux_dif_vis;
@@ -179,19 +203,35 @@ public:
     real3d cld_tau_lw_gpt;
   };
 
+  // The stages of the radiation computation for a single column chunk:
+  //  - copy_in_chunk: copy inputs from the FieldManager into the buffer (Kokkos only,
+  //    so it can be launched on any execution space instance)
+  //  - prepare_chunk: set gas concentrations, cloud mass, and band albedos
+  //  - solve_chunk: run RRTMGP, compute heating/fluxes, and copy outputs back
+  void copy_in_chunk (const int ic, const Buffer& buf, const KT::ExeSpace& space);
+  void prepare_chunk (const int ic, const Buffer& buf, const real3d& gas_concs);
+  void solve_chunk   (const int ic, const Buffer& buf, const double eccf);
+
+  // Set chunk size, and recompute the chunks boundaries
+  void set_col_chunk_size (const int chunk_size);
+
 protected:
 
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes() const;
 
+  // Number of bytes needed by a single Buffer, for each column of the chunk
+  size_t buffer_size_per_col_in_bytes() const;
+
   // Set local variables using memory provided by
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
   std::shared_ptr<const AbstractGrid>   m_grid;
 
-  // Struct which contains local variables
-  Buffer m_buffer;
+  // Structs which contain local variables. The second one is only set up
+  // if chunks are pipelined.
+  Buffer m_buffers[2];
 };  // class RRTMGPRadiation
 
 }  // namespace scream
@@ -16,6 +16,7 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+  m_column_batched_solve = m_params.get<bool>("column_batched_solve",false);
 }
 
 // =========================================================================================
@@ -137,9 +138,8 @@ size_t SHOCMacrophysics::requested_buffer_size_in_bytes() const
 
   // Number of Reals needed by the WorkspaceManager passed to shoc_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-  const int n_wind_slots  = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots  = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const size_t wsm_request= WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  const int wsm_blocks    = SHF::shoc_main_num_workspace_blocks(m_num_tracers, m_column_batched_solve);
+  const size_t wsm_request= WSM::get_total_bytes_needed(nlevi_packs, wsm_blocks, policy);
 
   return interface_request + wsm_request;
 }
@@ -213,9 +213,8 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   // Compute workspace manager size to check used memory
   // vs. requested memory
   const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-  const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
+  const int wsm_blocks   = SHF::shoc_main_num_workspace_blocks(m_num_tracers, m_column_batched_solve);
+  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, wsm_blocks, policy)/sizeof(Spack);
   s_mem += wsm_size;
 
   size_t used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -416,10 +415,9 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   // Setup WSM for internal local variables
   const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
   const auto nlevi_packs = ekat::npack<Spack>(m_num_levs+1);
-  const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
+  const int wsm_blocks   = SHF::shoc_main_num_workspace_blocks(m_num_tracers, m_column_batched_solve);
   const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-  workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, 13+(n_wind_slots+n_trac_slots), default_policy);
+  workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, wsm_blocks, default_policy);
 
   // Calculate pref_mid, and use that to calculate
   // maximum number of levels in pbl from surface
@@ -468,7 +466,8 @@ void SHOCMacrophysics::run_impl (const double dt)
 
   // Run shoc main
   SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,input,input_output,output,history_output
+                 workspace_mgr,input,input_output,output,history_output,
+                 m_column_batched_solve
 #ifdef SCREAM_SMALL_KERNELS
                  , temporaries
 #endif
@@ -548,6 +548,9 @@ protected:
   Int m_num_tracers;
   Int hdtime;
 
+  // Solve the implicit diffusion of Spack::n columns at once
+  bool m_column_batched_solve;
+
   KokkosTypes<DefaultDevice>::view_1d<const Real> m_cell_area;
   KokkosTypes<DefaultDevice>::view_1d<const Real> m_cell_lat;
 
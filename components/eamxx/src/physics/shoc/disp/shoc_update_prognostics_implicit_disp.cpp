@@ -31,12 +31,71 @@ void Functions<Real,DefaultDevice>
   const view_3d<Spack>&        tracer,
   const view_2d<Spack>&        tke,
   const view_2d<Spack>&        u_wind,
-  const view_2d<Spack>&        v_wind)
+  const view_2d<Spack>&        v_wind,
+  const bool&                  column_batched_solve)
 {
   using ExeSpace = typename KT::ExeSpace;
 
   const auto nlev_packs = ekat::npack<Spack>(nlev);
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+
+  if (column_batched_solve) {
+    // One team per batch of Spack::n columns. The systems of the batch are
+    // solved at once, which fills all the pack lanes even though the solve
+    // is serial in the vertical.
+    const Int num_batches = ekat::npack<Spack>(shcol);
+    const auto batch_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_batches, nlev_packs);
+    Kokkos::parallel_for(batch_policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int icol0 = team.league_rank()*Spack::n;
+      const Int ncols = shcol-icol0 < Spack::n ? shcol-icol0 : Spack::n;
+
+      auto workspace = workspace_mgr.get_workspace(team);
+
+      const auto batch = take_implicit_batch(team, nlev, num_tracer, workspace);
+      for (Int s = 0; s < ncols; ++s) {
+        const Int i = icol0+s;
+        update_prognostics_implicit_gather(team, nlev, nlevi, num_tracer, dtime, s,
+                                           ekat::subview(dz_zt, i),
+                                           ekat::subview(dz_zi, i),
+                                           ekat::subview(rho_zt, i),
+                                           ekat::subview(zt_grid, i),
+                                           ekat::subview(zi_grid, i),
+                                           ekat::subview(tk, i),
+                                           ekat::subview(tkh, i),
+                                           uw_sfc(i),
+                                           vw_sfc(i),
+                                           wthl_sfc(i),
+                                           wqw_sfc(i),
+                                           ekat::subview(wtracer_sfc, i),
+                                           workspace,
+                                           ekat::subview(thetal, i),
+                                           ekat::subview(qw, i),
+                                           ekat::subview(tracer, i),
+                                           ekat::subview(tke, i),
+                                           ekat::subview(u_wind, i),
+                                           ekat::subview(v_wind, i),
+                                           batch);
+      }
+
+      update_prognostics_implicit_solve(team, nlev, batch);
+
+      for (Int s = 0; s < ncols; ++s) {
+        const Int i = icol0+s;
+        update_prognostics_implicit_scatter(team, nlev, num_tracer, s, batch,
+                                            ekat::subview(thetal, i),
+                                            ekat::subview(qw, i),
+                                            ekat::subview(tracer, i),
+                                            ekat::subview(tke, i),
+                                            ekat::subview(u_wind, i),
+                                            ekat::subview(v_wind, i));
+      }
+
+      team.team_barrier();
+      release_implicit_batch(num_tracer, workspace, batch);
+    });
+    return;
+  }
+
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
 
@@ -5,6 +5,7 @@
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
+#include <algorithm>
 #include <iomanip>
 
 namespace scream {
@@ -287,6 +288,288 @@ void Functions<S,D>::shoc_main_internal(
   workspace.template release_many_contiguous<5>(
     {&rho_zt, &shoc_qv, &dz_zt, &dz_zi, &tkh});
 }
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::shoc_main_internal_batched(
+  const MemberType&        team,
+  const Int&               nlev,         // Number of levels
+  const Int&               nlevi,        // Number of levels on interface grid
+  const Int&               npbl,         // Maximum number of levels in pbl from surface
+  const Int&               nadv,         // Number of times to loop SHOC
+  const Int&               num_qtracers, // Number of tracers
+  const Scalar&            dtime,        // SHOC timestep [s]
+  const Int&               icol0,        // First column of the batch
+  const Int&               ncols,        // Number of columns in the batch
+  const SHOCInput&         shoc_input,
+  const SHOCInputOutput&   shoc_input_output,
+  const SHOCOutput&        shoc_output,
+  const SHOCHistoryOutput& shoc_history_output,
+  const Workspace&         workspace)
+{
+  // The steps are those of shoc_main_internal, so the temporaries that live
+  // across the implicit diffusion are needed for all the columns of the batch
+  uview_1d<Spack> rho_zt[Spack::n], shoc_qv[Spack::n], dz_zt[Spack::n], dz_zi[Spack::n], tkh[Spack::n];
+  for (Int s=0; s<ncols; ++s) {
+    workspace.template take_many_and_reset<5>(
+      {"rho_zt", "shoc_qv", "dz_zt", "dz_zi", "tkh"},
+      {&rho_zt[s], &shoc_qv[s], &dz_zt[s], &dz_zi[s], &tkh[s]});
+  }
+
+  // Local scalars
+  Scalar se_b[Spack::n], ke_b[Spack::n], wv_b[Spack::n], wl_b[Spack::n],
+         ustar2[Spack::n], wstar[Spack::n], pblh[Spack::n];
+  for (Int s=0; s<ncols; ++s) {
+    ustar2[s] = 0;
+    wstar[s]  = 0;
+    pblh[s]   = 0;
+  }
+
+  const auto& horiz_wind = shoc_input_output.horiz_wind;
+
+  // Energy integrals before SHOC is called (see shoc_main_internal)
+  for (Int s=0; s<ncols; ++s) {
+    const Int i = icol0+s;
+    shoc_energy_integrals(team,nlev,ekat::subview(shoc_input_output.host_dse, i),  // Input
+                          ekat::subview(shoc_input.pdel, i),                       // Input
+                          ekat::subview(shoc_input_output.qw, i),                  // Input
+                          ekat::subview(shoc_input_output.shoc_ql, i),             // Input
+                          Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL()),        // Input
+                          Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL()),        // Input
+                          se_b[s],ke_b[s],wv_b[s],wl_b[s]);                        // Output
+  }
+
+  for (Int t=0; t<nadv; ++t) {
+    // Everything up to the TKE equation
+    for (Int s=0; s<ncols; ++s) {
+      const Int i = icol0+s;
+      const auto zt_grid      = ekat::subview(shoc_input.zt_grid, i);
+      const auto zi_grid      = ekat::subview(shoc_input.zi_grid, i);
+      const auto pres         = ekat::subview(shoc_input.pres, i);
+      const auto pdel         = ekat::subview(shoc_input.pdel, i);
+      const auto thv          = ekat::subview(shoc_input.thv, i);
+      const auto tke          = ekat::subview(shoc_input_output.tke, i);
+      const auto thetal       = ekat::subview(shoc_input_output.thetal, i);
+      const auto qw           = ekat::subview(shoc_input_output.qw, i);
+      const auto wthv_sec     = ekat::subview(shoc_input_output.wthv_sec, i);
+      const auto tk           = ekat::subview(shoc_input_output.tk, i);
+      const auto shoc_cldfrac = ekat::subview(shoc_input_output.shoc_cldfrac, i);
+      const auto shoc_ql      = ekat::subview(shoc_input_output.shoc_ql, i);
+      const auto shoc_mix     = ekat::subview(shoc_history_output.shoc_mix, i);
+      const auto brunt        = ekat::subview(shoc_history_output.brunt, i);
+      const auto isotropy     = ekat::subview(shoc_history_output.isotropy, i);
+      const auto u_wind       = Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL());
+      const auto v_wind       = Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL());
+
+      const auto s_thetal  = ekat::scalarize(thetal);
+      const auto s_shoc_ql = ekat::scalarize(shoc_ql);
+      const auto s_shoc_qv = ekat::scalarize(shoc_qv[s]);
+
+      Scalar ustar{0}, kbfs{0}, obklen{0};
+
+      check_tke(team,nlev,tke);
+
+      shoc_grid(team,nlev,nlevi,                   // Input
+                zt_grid,zi_grid,pdel,              // Input
+                dz_zt[s],dz_zi[s],rho_zt[s]);      // Output
+
+      compute_shoc_vapor(team,nlev,qw,shoc_ql, // Input
+                         shoc_qv[s]);          // Output
+
+      team.team_barrier();
+      shoc_diag_obklen(shoc_input.uw_sfc(i),shoc_input.vw_sfc(i),     // Input
+                       shoc_input.wthl_sfc(i),shoc_input.wqw_sfc(i), // Input
+                       s_thetal(nlev-1),                              // Input
+                       s_shoc_ql(nlev-1),                             // Input
+                       s_shoc_qv(nlev-1),                             // Input
+                       ustar,kbfs,obklen);                            // Output
+
+      pblintd(team,nlev,nlevi,npbl,         // Input
+              zt_grid,zi_grid,thetal,       // Input
+              shoc_ql,shoc_qv[s],u_wind,    // Input
+              v_wind,ustar,obklen,kbfs,     // Input
+              shoc_cldfrac,                 // Input
+              workspace,                    // Workspace
+              pblh[s]);                     // Output
+
+      shoc_length(team,nlev,nlevi,shoc_input.dx(i),shoc_input.dy(i), // Input
+                  zt_grid,zi_grid,dz_zt[s],                          // Input
+                  tke,thv,                                           // Input
+                  workspace,                                         // Workspace
+                  brunt,shoc_mix);                                   // Output
+
+      shoc_tke(team,nlev,nlevi,dtime,wthv_sec,       // Input
+               shoc_mix,dz_zi[s],dz_zt[s],pres,u_wind, // Input
+               v_wind,brunt,obklen,zt_grid,          // Input
+               zi_grid,pblh[s],                      // Input
+               workspace,                            // Workspace
+               tke,tk,tkh[s],                        // Input/Output
+               isotropy);                            // Output
+    }
+
+    // Update SHOC prognostic variables of all the columns of the batch at
+    // once via implicit diffusion solver
+    team.team_barrier();
+    const auto batch = take_implicit_batch(team, nlev, num_qtracers, workspace);
+    for (Int s=0; s<ncols; ++s) {
+      const Int i = icol0+s;
+      update_prognostics_implicit_gather(team,nlev,nlevi,num_qtracers,dtime,s,                       // Input
+                                         dz_zt[s],dz_zi[s],rho_zt[s],                                // Input
+                                         ekat::subview(shoc_input.zt_grid, i),                       // Input
+                                         ekat::subview(shoc_input.zi_grid, i),                       // Input
+                                         ekat::subview(shoc_input_output.tk, i),tkh[s],              // Input
+                                         shoc_input.uw_sfc(i),shoc_input.vw_sfc(i),                  // Input
+                                         shoc_input.wthl_sfc(i),shoc_input.wqw_sfc(i),               // Input
+                                         ekat::subview(shoc_input.wtracer_sfc, i),                   // Input
+                                         workspace,                                                  // Workspace
+                                         ekat::subview(shoc_input_output.thetal, i),                 // Input/Output
+                                         ekat::subview(shoc_input_output.qw, i),                     // Input/Output
+                                         Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL()),
+                                         ekat::subview(shoc_input_output.tke, i),                    // Input/Output
+                                         Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL()),           // Input/Output
+                                         Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL()),           // Input/Output
+                                         batch);                                                     // Output
+    }
+    update_prognostics_implicit_solve(team, nlev, batch);
+    for (Int s=0; s<ncols; ++s) {
+      const Int i = icol0+s;
+      update_prognostics_implicit_scatter(team,nlev,num_qtracers,s,batch,                                    // Input
+                                          ekat::subview(shoc_input_output.thetal, i),                        // Output
+                                          ekat::subview(shoc_input_output.qw, i),                            // Output
+                                          Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL()),
+                                          ekat::subview(shoc_input_output.tke, i),                           // Output
+                                          Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL()),                  // Output
+                                          Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL()));                 // Output
+    }
+    team.team_barrier();
+    release_implicit_batch(num_qtracers, workspace, batch);
+
+    // Everything after the implicit diffusion
+    for (Int s=0; s<ncols; ++s) {
+      const Int i = icol0+s;
+      const auto zt_grid      = ekat::subview(shoc_input.zt_grid, i);
+      const auto zi_grid      = ekat::subview(shoc_input.zi_grid, i);
+      const auto pres         = ekat::subview(shoc_input.pres, i);
+      const auto w_field      = ekat::subview(shoc_input.w_field, i);
+      const auto tke          = ekat::subview(shoc_input_output.tke, i);
+      const auto thetal       = ekat::subview(shoc_input_output.thetal, i);
+      const auto qw           = ekat::subview(shoc_input_output.qw, i);
+      const auto wthv_sec     = ekat::subview(shoc_input_output.wthv_sec, i);
+      const auto tk           = ekat::subview(shoc_input_output.tk, i);
+      const auto shoc_cldfrac = ekat::subview(shoc_input_output.shoc_cldfrac, i);
+      const auto shoc_ql      = ekat::subview(shoc_input_output.shoc_ql, i);
+      const auto shoc_ql2     = ekat::subview(shoc_output.shoc_ql2, i);
+      const auto shoc_mix     = ekat::subview(shoc_history_output.shoc_mix, i);
+      const auto w_sec        = ekat::subview(shoc_history_output.w_sec, i);
+      const auto thl_sec      = ekat::subview(shoc_history_output.thl_sec, i);
+      const auto qw_sec       = ekat::subview(shoc_history_output.qw_sec, i);
+      const auto qwthl_sec    = ekat::subview(shoc_history_output.qwthl_sec, i);
+      const auto wthl_sec     = ekat::subview(shoc_history_output.wthl_sec, i);
+      const auto wqw_sec      = ekat::subview(shoc_history_output.wqw_sec, i);
+      const auto wtke_sec     = ekat::subview(shoc_history_output.wtke_sec, i);
+      const auto uw_sec       = ekat::subview(shoc_history_output.uw_sec, i);
+      const auto vw_sec       = ekat::subview(shoc_history_output.vw_sec, i);
+      const auto w3           = ekat::subview(shoc_history_output.w3, i);
+      const auto wqls_sec     = ekat::subview(shoc_history_output.wqls_sec, i);
+      const auto brunt        = ekat::subview(shoc_history_output.brunt, i);
+      const auto isotropy     = ekat::subview(shoc_history_output.isotropy, i);
+      const auto u_wind       = Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL());
+      const auto v_wind       = Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL());
+
+      diag_second_shoc_moments(team,nlev,nlevi,thetal,qw,u_wind,v_wind,      // Input
+                               tke,isotropy,tkh[s],tk,dz_zi[s],zt_grid,      // Input
+                               zi_grid,shoc_mix,                             // Input
+                               shoc_input.wthl_sfc(i),shoc_input.wqw_sfc(i), // Input
+                               shoc_input.uw_sfc(i),shoc_input.vw_sfc(i),    // Input
+                               ustar2[s],wstar[s],                           // Input/Output
+                               workspace,                                    // Workspace
+                               thl_sec,qw_sec,wthl_sec,wqw_sec,qwthl_sec,    // Output
+                               uw_sec,vw_sec,wtke_sec,w_sec);                // Output
+
+      diag_third_shoc_moments(team,nlev,nlevi,w_sec,thl_sec,wthl_sec,       // Input
+                              isotropy,brunt,thetal,tke,dz_zt[s],dz_zi[s],  // Input
+                              zt_grid,zi_grid,                              // Input
+                              workspace,                                    // Workspace
+                              w3);                                          // Output
+
+      team.team_barrier();
+      shoc_assumed_pdf(team,nlev,nlevi,thetal,qw,w_field,thl_sec,qw_sec, // Input
+                       wthl_sec,w_sec,wqw_sec,qwthl_sec,w3,pres,         // Input
+                       zt_grid, zi_grid,                                 // Input
+                       workspace,                                        // Workspace
+                       shoc_cldfrac,shoc_ql,wqls_sec,wthv_sec,shoc_ql2); // Ouptut
+
+      check_tke(team,nlev,tke);
+    }
+  }
+
+  // End SHOC parameterization, and diagnose the PBL quantities
+  for (Int s=0; s<ncols; ++s) {
+    const Int i = icol0+s;
+    const auto zt_grid      = ekat::subview(shoc_input.zt_grid, i);
+    const auto zi_grid      = ekat::subview(shoc_input.zi_grid, i);
+    const auto presi        = ekat::subview(shoc_input.presi, i);
+    const auto pdel         = ekat::subview(shoc_input.pdel, i);
+    const auto inv_exner    = ekat::subview(shoc_input.inv_exner, i);
+    const auto host_dse     = ekat::subview(shoc_input_output.host_dse, i);
+    const auto tke          = ekat::subview(shoc_input_output.tke, i);
+    const auto thetal       = ekat::subview(shoc_input_output.thetal, i);
+    const auto qw           = ekat::subview(shoc_input_output.qw, i);
+    const auto shoc_cldfrac = ekat::subview(shoc_input_output.shoc_cldfrac, i);
+    const auto shoc_ql      = ekat::subview(shoc_input_output.shoc_ql, i);
+    const auto u_wind       = Kokkos::subview(horiz_wind, i, 0, Kokkos::ALL());
+    const auto v_wind       = Kokkos::subview(horiz_wind, i, 1, Kokkos::ALL());
+
+    const auto s_thetal  = ekat::scalarize(thetal);
+    const auto s_shoc_ql = ekat::scalarize(shoc_ql);
+    const auto s_shoc_qv = ekat::scalarize(shoc_qv[s]);
+
+    Scalar se_a{0}, ke_a{0}, wv_a{0}, wl_a{0},
+           ustar{0}, kbfs{0}, obklen{0};
+
+    update_host_dse(team,nlev,thetal,shoc_ql,              // Input
+                    inv_exner,zt_grid,shoc_input.phis(i),  // Input
+                    host_dse);                             // Output
+
+    team.team_barrier();
+    shoc_energy_integrals(team,nlev,host_dse,pdel,  // Input
+                          qw,shoc_ql,u_wind,v_wind, // Input
+                          se_a,ke_a,wv_a,wl_a);     // Output
+
+    shoc_energy_fixer(team,nlev,nlevi,dtime,nadv,zt_grid,zi_grid,        // Input
+                      se_b[s],ke_b[s],wv_b[s],wl_b[s],se_a,ke_a,wv_a,wl_a, // Input
+                      shoc_input.wthl_sfc(i),shoc_input.wqw_sfc(i),      // Input
+                      rho_zt[s],tke,presi,                               // Input
+                      workspace,                                         // Workspace
+                      host_dse);                                         // Output
+
+    compute_shoc_vapor(team,nlev,qw,shoc_ql, // Input
+                       shoc_qv[s]);          // Output
+
+    team.team_barrier();
+    shoc_diag_obklen(shoc_input.uw_sfc(i),shoc_input.vw_sfc(i),     // Input
+                     shoc_input.wthl_sfc(i),shoc_input.wqw_sfc(i), // Input
+                     s_thetal(nlev-1),                              // Input
+                     s_shoc_ql(nlev-1),                             // Input
+                     s_shoc_qv(nlev-1),                             // Input
+                     ustar,kbfs,obklen);                            // Output
+
+    pblintd(team,nlev,nlevi,npbl,zt_grid,      // Input
+            zi_grid,thetal,shoc_ql,shoc_qv[s], // Input
+            u_wind,v_wind,ustar,obklen,        // Input
+            kbfs,shoc_cldfrac,                 // Input
+            workspace,                         // Workspace
+            pblh[s]);                          // Output
+
+    shoc_output.pblh(i) = pblh[s];
+  }
+
+  // Release temporary variables from the workspace
+  for (Int s=ncols-1; s>=0; --s) {
+    workspace.template release_many_contiguous<5>(
+      {&rho_zt[s], &shoc_qv[s], &dz_zt[s], &dz_zi[s], &tkh[s]});
+  }
+}
 #else
 template<typename S, typename D>
 void Functions<S,D>::shoc_main_internal(
@@ -364,7 +647,9 @@ void Functions<S,D>::shoc_main_internal(
   const view_2d<Spack>& shoc_qv,
   const view_2d<Spack>& dz_zt,
   const view_2d<Spack>& dz_zi,
-  const view_2d<Spack>& tkh)
+  const view_2d<Spack>& tkh,
+  // Options
+  const bool& column_batched_solve)
 {
   // Scalarize some views for single entry access
   const auto s_thetal  = ekat::scalarize(thetal);
@@ -437,7 +722,8 @@ void Functions<S,D>::shoc_main_internal(
                                      dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
                                      vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                      workspace_mgr,                              // Workspace mgr
-                                     thetal,qw,qtracers,tke,u_wind,v_wind);      // Input/Output
+                                     thetal,qw,qtracers,tke,u_wind,v_wind,       // Input/Output
+                                     column_batched_solve);                      // Option
 
     // Diagnose the second order moments
     diag_second_shoc_moments_disp(shcol,nlev,nlevi,thetal,qw,u_wind,v_wind,  // Input
@@ -526,7 +812,8 @@ Int Functions<S,D>::shoc_main(
   const SHOCInput&         shoc_input,          // Input
   const SHOCInputOutput&   shoc_input_output,   // Input/Output
   const SHOCOutput&        shoc_output,         // Output
-  const SHOCHistoryOutput& shoc_history_output  // Output (diagnostic)
+  const SHOCHistoryOutput& shoc_history_output, // Output (diagnostic)
+  const bool&              column_batched_solve // Solve the implicit diffusion of Spack::n columns at once
 #ifdef SCREAM_SMALL_KERNELS
   , const SHOCTemporaries& shoc_temporaries     // Temporaries for small kernels
 #endif
@@ -540,6 +827,27 @@ Int Functions<S,D>::shoc_main(
 
   // SHOC main loop
   const auto nlev_packs = ekat::npack<Spack>(nlev);
+  if (column_batched_solve) {
+    const Int num_batches = ekat::npack<Spack>(shcol);
+    const auto batch_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_batches, nlev_packs);
+    Kokkos::parallel_for(batch_policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int icol0 = team.league_rank()*Spack::n;
+      const Int ncols = shcol-icol0 < Spack::n ? shcol-icol0 : Spack::n;
+
+      auto workspace = workspace_mgr.get_workspace(team);
+
+      shoc_main_internal_batched(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+                                 icol0, ncols,
+                                 shoc_input, shoc_input_output, shoc_output, shoc_history_output,
+                                 workspace);
+    });
+    Kokkos::fence();
+
+    auto finish = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(finish - start);
+    return duration.count();
+  }
+
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -631,7 +939,9 @@ Int Functions<S,D>::shoc_main(
     shoc_temporaries.se_a, shoc_temporaries.ke_a, shoc_temporaries.wv_a, shoc_temporaries.wl_a,
     shoc_temporaries.ustar, shoc_temporaries.kbfs, shoc_temporaries.obklen, shoc_temporaries.ustar2,
     shoc_temporaries.wstar, shoc_temporaries.rho_zt, shoc_temporaries.shoc_qv, shoc_temporaries.dz_zt,
-    shoc_temporaries.dz_zi, shoc_temporaries.tkh);
+    shoc_temporaries.dz_zi, shoc_temporaries.tkh,
+    // Options
+    column_batched_solve);
 #endif
 
   auto finish = std::chrono::steady_clock::now();
@@ -639,6 +949,26 @@ Int Functions<S,D>::shoc_main(
   return duration.count();
 }
 
+template<typename S, typename D>
+Int Functions<S,D>::shoc_main_num_workspace_blocks(
+  const Int&  num_qtracers,
+  const bool& column_batched_solve)
+{
+  // Peak usage of update_prognostics_implicit, on top of the 5 temporaries
+  // of shoc_main_internal
+  const Int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
+  const Int n_trac_slots = ekat::npack<Spack>(num_qtracers+3)*Spack::n;
+  Int num_blocks = 13+(n_wind_slots+n_trac_slots);
+
+  if (column_batched_solve) {
+    // The batch keeps the 5 temporaries of each of its columns, and the
+    // ImplicitBatch on top of the 8 temporaries of the gather step
+    const Int num_batched_blocks = 5*Spack::n + 8 + implicit_batch_num_blocks(num_qtracers);
+    num_blocks = std::max(num_blocks, num_batched_blocks);
+  }
+  return num_blocks;
+}
+
 } // namespace shoc
 } // namespace scream
 
@@ -95,6 +95,39 @@ void Functions<S,D>::vd_shoc_solve(
 #endif
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_interleaved(
+  const MemberType&      team,
+  const Int&             nlev,
+  const uview_1d<Spack>& du,
+  const uview_1d<Spack>& dl,
+  const uview_1d<Spack>& d,
+  const uview_2d<Spack>& var)
+{
+  // Factorize
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    for (Int k = 1; k < nlev; ++k) {
+      dl(k) /= d(k-1);
+      d(k)  -= dl(k)*du(k-1);
+    }
+  });
+  team.team_barrier();
+
+  // Forward and backward substitution, one rhs per thread
+  const Int num_rhs = var.extent_int(0);
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, num_rhs), [&] (const Int& r) {
+    const auto x = ekat::subview(var, r);
+    for (Int k = 1; k < nlev; ++k) {
+      x(k) -= dl(k)*x(k-1);
+    }
+    x(nlev-1) /= d(nlev-1);
+    for (Int k = nlev-2; k >= 0; --k) {
+      x(k) = (x(k) - du(k)*x(k+1)) / d(k);
+    }
+  });
+}
+
 } // namespace shoc
 } // namespace scream
 
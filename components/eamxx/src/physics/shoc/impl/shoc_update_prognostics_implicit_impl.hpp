@@ -13,7 +13,7 @@ namespace shoc {
 
 template<typename S, typename D>
 KOKKOS_FUNCTION
-void Functions<S,D>::update_prognostics_implicit(
+void Functions<S,D>::update_prognostics_implicit_setup(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -31,60 +31,27 @@ void Functions<S,D>::update_prognostics_implicit(
   const Scalar&                wthl_sfc,
   const Scalar&                wqw_sfc,
   const uview_1d<const Spack>& wtracer_sfc,
-  const Workspace&             workspace,
+  const uview_1d<Spack>&       tmpi,
+  const uview_1d<Spack>&       tkh_zi,
+  const uview_1d<Spack>&       tk_zi,
+  const uview_1d<Spack>&       rho_zi,
+  const uview_1d<Spack>&       rdp_zt,
   const uview_1d<Spack>&       thetal,
   const uview_1d<Spack>&       qw,
   const uview_2d<Spack>&       qtracers,
   const uview_1d<Spack>&       tke,
-  const uview_1d<Spack>&       u_wind,
-  const uview_1d<Spack>&       v_wind)
+  const uview_1d<const Spack>& u_wind,
+  const uview_1d<const Spack>& v_wind,
+  Scalar&                      ksrf)
 {
-  // Define temporary variables via the WorkspaceManager
-
-  // 1d allocations
-  uview_1d<Spack> tmpi, tkh_zi,
-                  tk_zi, rho_zi,
-                  rdp_zt;
-  uview_1d<Scalar> du_workspace, dl_workspace, d_workspace;
-
-  workspace.template take_many_contiguous_unsafe<5>(
-    {"tmpi", "tkh_zi", "tk_zi", "rho_zi", "rdp_zt"},
-    {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
-
-  workspace.template take_many_contiguous_unsafe<3, Scalar>(
-    {"du_workspace", "dl_workspace", "d_workspace"},
-    {&du_workspace, &dl_workspace, &d_workspace});
-  auto du = Kokkos::subview(du_workspace, Kokkos::make_pair(0,nlev));
-  auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
-  auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
-
-  // 2d allocations for solver RHS
-  const int num_wind_transpose_packs = ekat::npack<Spack>(2);
-  const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
-
-  const int n_wind_slots = num_wind_transpose_packs*Spack::n;
-  const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
-
-  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
-  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
-
-  // Reshape 2d views
-  const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
-                                            nlev, num_wind_transpose_packs);
-  const auto qtracers_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(tracers_slot.data()),
-                                            nlev, num_qtracers_transpose_packs);
-
-  // scalarized versions of some views will be needed
   const auto rdp_zt_s       = ekat::scalarize(rdp_zt);
   const auto rho_zi_s       = ekat::scalarize(rho_zi);
   const auto u_wind_s       = ekat::scalarize(u_wind);
   const auto v_wind_s       = ekat::scalarize(v_wind);
-  const auto wind_rhs_s     = ekat::scalarize(wind_rhs);
   const auto thetal_s       = ekat::scalarize(thetal);
   const auto qw_s           = ekat::scalarize(qw);
   const auto tke_s          = ekat::scalarize(tke);
   const auto qtracers_s     = ekat::scalarize(qtracers);
-  const auto qtracers_rhs_s = ekat::scalarize(qtracers_rhs);
   const auto wtracer_sfc_s  = ekat::scalarize(wtracer_sfc);
 
   // linearly interpolate tkh, tk, and air density onto the interface grids
@@ -107,7 +74,7 @@ void Functions<S,D>::update_prognostics_implicit(
 
   // compute terms needed for the implicit surface stress (ksrf)
   // and tke flux calc (wtke_sfc)
-  Scalar ksrf, wtke_sfc;
+  Scalar wtke_sfc;
   {
     const Scalar wsmin = 1;
     const Scalar ksrfmin = 1e-4;
@@ -144,6 +111,87 @@ void Functions<S,D>::update_prognostics_implicit(
       qtracers_s(q, nlev-1) += cmnfac*wtracer_sfc_s(q);
     });
   }
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::update_prognostics_implicit(
+  const MemberType&            team,
+  const Int&                   nlev,
+  const Int&                   nlevi,
+  const Int&                   num_qtracers,
+  const Scalar&                dtime,
+  const uview_1d<const Spack>& dz_zt,
+  const uview_1d<const Spack>& dz_zi,
+  const uview_1d<const Spack>& rho_zt,
+  const uview_1d<const Spack>& zt_grid,
+  const uview_1d<const Spack>& zi_grid,
+  const uview_1d<const Spack>& tk,
+  const uview_1d<const Spack>& tkh,
+  const Scalar&                uw_sfc,
+  const Scalar&                vw_sfc,
+  const Scalar&                wthl_sfc,
+  const Scalar&                wqw_sfc,
+  const uview_1d<const Spack>& wtracer_sfc,
+  const Workspace&             workspace,
+  const uview_1d<Spack>&       thetal,
+  const uview_1d<Spack>&       qw,
+  const uview_2d<Spack>&       qtracers,
+  const uview_1d<Spack>&       tke,
+  const uview_1d<Spack>&       u_wind,
+  const uview_1d<Spack>&       v_wind)
+{
+  // Define temporary variables via the WorkspaceManager
+
+  // 1d allocations
+  uview_1d<Spack> tmpi, tkh_zi,
+                  tk_zi, rho_zi,
+                  rdp_zt;
+  uview_1d<Scalar> du_workspace, dl_workspace, d_workspace;
+
+  workspace.template take_many_contiguous_unsafe<5>(
+    {"tmpi", "tkh_zi", "tk_zi", "rho_zi", "rdp_zt"},
+    {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
+
+  workspace.template take_many_contiguous_unsafe<3, Scalar>(
+    {"du_workspace", "dl_workspace", "d_workspace"},
+    {&du_workspace, &dl_workspace, &d_workspace});
+  auto du = Kokkos::subview(du_workspace, Kokkos::make_pair(0,nlev));
+  auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
+  auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
+
+  // 2d allocations for solver RHS
+  const int num_wind_transpose_packs = ekat::npack<Spack>(2);
+  const int num_qtracers_transpose_packs = ekat::npack<Spack>(num_qtracers+3);
+
+  const int n_wind_slots = num_wind_transpose_packs*Spack::n;
+  const int n_trac_slots = num_qtracers_transpose_packs*Spack::n;
+
+  const auto wind_slot    = workspace.template take_macro_block<Scalar>("wind_slot",n_wind_slots);
+  const auto tracers_slot = workspace.template take_macro_block<Scalar>("tracers_slot",n_trac_slots);
+
+  // Reshape 2d views
+  const auto wind_rhs     = uview_2d<Spack>(reinterpret_cast<Spack*>(wind_slot.data()),
+                                            nlev, num_wind_transpose_packs);
+  const auto qtracers_rhs  = uview_2d<Spack>(reinterpret_cast<Spack*>(tracers_slot.data()),
+                                            nlev, num_qtracers_transpose_packs);
+
+  // scalarized versions of some views will be needed
+  const auto u_wind_s       = ekat::scalarize(u_wind);
+  const auto v_wind_s       = ekat::scalarize(v_wind);
+  const auto wind_rhs_s     = ekat::scalarize(wind_rhs);
+  const auto thetal_s       = ekat::scalarize(thetal);
+  const auto qw_s           = ekat::scalarize(qw);
+  const auto tke_s          = ekat::scalarize(tke);
+  const auto qtracers_s     = ekat::scalarize(qtracers);
+  const auto qtracers_rhs_s = ekat::scalarize(qtracers_rhs);
+
+  // Interface coefficients, and explicit surface fluxes
+  Scalar ksrf;
+  update_prognostics_implicit_setup(team, nlev, nlevi, num_qtracers, dtime, dz_zt, dz_zi, rho_zt,
+                                    zt_grid, zi_grid, tk, tkh, uw_sfc, vw_sfc, wthl_sfc, wqw_sfc,
+                                    wtracer_sfc, tmpi, tkh_zi, tk_zi, rho_zi, rdp_zt,
+                                    thetal, qw, qtracers, tke, u_wind, v_wind, ksrf);
 
   // Store RHS values in wind_rhs and qtracers_rhs for 1st and 2nd solve respectively
   team.team_barrier();
@@ -208,6 +256,208 @@ void Functions<S,D>::update_prognostics_implicit(
     {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::ImplicitBatch
+Functions<S,D>::take_implicit_batch(
+  const MemberType& team,
+  const Int&        nlev,
+  const Int&        num_qtracers,
+  const Workspace&  workspace)
+{
+  const Int num_wind_rhs   = 2;
+  const Int num_thermo_rhs = num_qtracers+3;
+
+  ImplicitBatch batch;
+  batch.slot = workspace.template take_macro_block<Scalar>("implicit_batch_slot",
+                                                           implicit_batch_num_blocks(num_qtracers));
+
+  // Carve the diagonals and the rhs out of the macro block
+  Spack* data = reinterpret_cast<Spack*>(batch.slot.data());
+  batch.du_wind    = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.dl_wind    = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.d_wind     = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.du_thermo  = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.dl_thermo  = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.d_thermo   = uview_1d<Spack>(data, nlev); data += nlev;
+  batch.wind_rhs   = uview_2d<Spack>(data, num_wind_rhs, nlev); data += num_wind_rhs*nlev;
+  batch.thermo_rhs = uview_2d<Spack>(data, num_thermo_rhs, nlev);
+
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    batch.du_wind(k)   = 0;
+    batch.dl_wind(k)   = 0;
+    batch.d_wind(k)    = 1;
+    batch.du_thermo(k) = 0;
+    batch.dl_thermo(k) = 0;
+    batch.d_thermo(k)  = 1;
+    for (Int r = 0; r < num_wind_rhs; ++r) {
+      batch.wind_rhs(r, k) = 0;
+    }
+    for (Int r = 0; r < num_thermo_rhs; ++r) {
+      batch.thermo_rhs(r, k) = 0;
+    }
+  });
+  team.team_barrier();
+
+  return batch;
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::release_implicit_batch(
+  const Int&           num_qtracers,
+  const Workspace&     workspace,
+  const ImplicitBatch& batch)
+{
+  workspace.template release_macro_block<Scalar>(batch.slot, implicit_batch_num_blocks(num_qtracers));
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::update_prognostics_implicit_gather(
+  const MemberType&            team,
+  const Int&                   nlev,
+  const Int&                   nlevi,
+  const Int&                   num_qtracers,
+  const Scalar&                dtime,
+  const Int&                   s,
+  const uview_1d<const Spack>& dz_zt,
+  const uview_1d<const Spack>& dz_zi,
+  const uview_1d<const Spack>& rho_zt,
+  const uview_1d<const Spack>& zt_grid,
+  const uview_1d<const Spack>& zi_grid,
+  const uview_1d<const Spack>& tk,
+  const uview_1d<const Spack>& tkh,
+  const Scalar&                uw_sfc,
+  const Scalar&                vw_sfc,
+  const Scalar&                wthl_sfc,
+  const Scalar&                wqw_sfc,
+  const uview_1d<const Spack>& wtracer_sfc,
+  const Workspace&             workspace,
+  const uview_1d<Spack>&       thetal,
+  const uview_1d<Spack>&       qw,
+  const uview_2d<Spack>&       qtracers,
+  const uview_1d<Spack>&       tke,
+  const uview_1d<Spack>&       u_wind,
+  const uview_1d<Spack>&       v_wind,
+  const ImplicitBatch&         batch)
+{
+  // Define temporary variables via the WorkspaceManager
+  uview_1d<Spack> tmpi, tkh_zi,
+                  tk_zi, rho_zi,
+                  rdp_zt;
+  uview_1d<Scalar> du_workspace, dl_workspace, d_workspace;
+
+  workspace.template take_many_contiguous_unsafe<5>(
+    {"tmpi", "tkh_zi", "tk_zi", "rho_zi", "rdp_zt"},
+    {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
+
+  workspace.template take_many_contiguous_unsafe<3, Scalar>(
+    {"du_workspace", "dl_workspace", "d_workspace"},
+    {&du_workspace, &dl_workspace, &d_workspace});
+  auto du = Kokkos::subview(du_workspace, Kokkos::make_pair(0,nlev));
+  auto dl = Kokkos::subview(dl_workspace, Kokkos::make_pair(0,nlev));
+  auto d  = Kokkos::subview(d_workspace,  Kokkos::make_pair(0,nlev));
+
+  // scalarized versions of some views will be needed
+  const auto u_wind_s   = ekat::scalarize(u_wind);
+  const auto v_wind_s   = ekat::scalarize(v_wind);
+  const auto thetal_s   = ekat::scalarize(thetal);
+  const auto qw_s       = ekat::scalarize(qw);
+  const auto tke_s      = ekat::scalarize(tke);
+  const auto qtracers_s = ekat::scalarize(qtracers);
+
+  // Interface coefficients, and explicit surface fluxes
+  Scalar ksrf;
+  update_prognostics_implicit_setup(team, nlev, nlevi, num_qtracers, dtime, dz_zt, dz_zi, rho_zt,
+                                    zt_grid, zi_grid, tk, tkh, uw_sfc, vw_sfc, wthl_sfc, wqw_sfc,
+                                    wtracer_sfc, tmpi, tkh_zi, tk_zi, rho_zi, rdp_zt,
+                                    thetal, qw, qtracers, tke, u_wind, v_wind, ksrf);
+
+  // Momentum system
+  team.team_barrier();
+  vd_shoc_decomp(team, nlev, tk_zi, tmpi, rdp_zt, dtime, ksrf, du, dl, d);
+  team.team_barrier();
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+    batch.du_wind(k)[s]     = du(k);
+    batch.dl_wind(k)[s]     = dl(k);
+    batch.d_wind(k)[s]      = d(k);
+    batch.wind_rhs(0, k)[s] = u_wind_s(k);
+    batch.wind_rhs(1, k)[s] = v_wind_s(k);
+  });
+
+  // Thermo system. Fluxes applied explicitly, so zero fluxes out for
+  // implicit solver decomposition.
+  team.team_barrier();
+  vd_shoc_decomp(team, nlev, tkh_zi, tmpi, rdp_zt, dtime, 0, du, dl, d);
+  team.team_barrier();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+    batch.du_thermo(k)[s] = du(k);
+    batch.dl_thermo(k)[s] = dl(k);
+    batch.d_thermo(k)[s]  = d(k);
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
+      batch.thermo_rhs(q, k)[s] = qtracers_s(q, k);
+    });
+    batch.thermo_rhs(num_qtracers,   k)[s] = thetal_s(k);
+    batch.thermo_rhs(num_qtracers+1, k)[s] = qw_s(k);
+    batch.thermo_rhs(num_qtracers+2, k)[s] = tke_s(k);
+  });
+
+  // Release temporary variables from the workspace
+  team.team_barrier();
+  workspace.template release_many_contiguous<3,Scalar>(
+    {&du_workspace, &dl_workspace, &d_workspace});
+  workspace.template release_many_contiguous<5>(
+    {&tmpi, &tkh_zi, &tk_zi, &rho_zi, &rdp_zt});
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::update_prognostics_implicit_solve(
+  const MemberType&    team,
+  const Int&           nlev,
+  const ImplicitBatch& batch)
+{
+  vd_shoc_solve_interleaved(team, nlev, batch.du_wind, batch.dl_wind, batch.d_wind, batch.wind_rhs);
+  team.team_barrier();
+  vd_shoc_solve_interleaved(team, nlev, batch.du_thermo, batch.dl_thermo, batch.d_thermo, batch.thermo_rhs);
+  team.team_barrier();
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::update_prognostics_implicit_scatter(
+  const MemberType&      team,
+  const Int&             nlev,
+  const Int&             num_qtracers,
+  const Int&             s,
+  const ImplicitBatch&   batch,
+  const uview_1d<Spack>& thetal,
+  const uview_1d<Spack>& qw,
+  const uview_2d<Spack>& qtracers,
+  const uview_1d<Spack>& tke,
+  const uview_1d<Spack>& u_wind,
+  const uview_1d<Spack>& v_wind)
+{
+  const auto u_wind_s   = ekat::scalarize(u_wind);
+  const auto v_wind_s   = ekat::scalarize(v_wind);
+  const auto thetal_s   = ekat::scalarize(thetal);
+  const auto qw_s       = ekat::scalarize(qw);
+  const auto tke_s      = ekat::scalarize(tke);
+  const auto qtracers_s = ekat::scalarize(qtracers);
+
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&] (const Int& k) {
+    u_wind_s(k) = batch.wind_rhs(0, k)[s];
+    v_wind_s(k) = batch.wind_rhs(1, k)[s];
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, num_qtracers), [&] (const Int& q) {
+      qtracers_s(q, k) = batch.thermo_rhs(q, k)[s];
+    });
+    thetal_s(k) = batch.thermo_rhs(num_qtracers,   k)[s];
+    qw_s(k)     = batch.thermo_rhs(num_qtracers+1, k)[s];
+    tke_s(k)    = batch.thermo_rhs(num_qtracers+2, k)[s];
+  });
+}
+
 } // namespace shoc
 } // namespace scream
 
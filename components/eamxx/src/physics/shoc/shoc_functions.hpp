@@ -205,6 +205,24 @@ struct Functions
   };
 #endif
 
+  // Implicit diffusion systems of a batch of up to Spack::n columns, stored
+  // column-interleaved: lane s of each pack belongs to the s-th column of the
+  // batch. The storage is a macro block of the SHOC workspace.
+  struct ImplicitBatch {
+    uview_1d<Scalar> slot;
+
+    uview_1d<Spack> du_wind;
+    uview_1d<Spack> dl_wind;
+    uview_1d<Spack> d_wind;
+    uview_1d<Spack> du_thermo;
+    uview_1d<Spack> dl_thermo;
+    uview_1d<Spack> d_thermo;
+
+    // rhs/solution of the systems: (u,v) and (tracers,thetal,qw,tke)
+    uview_2d<Spack> wind_rhs;
+    uview_2d<Spack> thermo_rhs;
+  };
+
   //
   // --------- Functions ---------
   //
@@ -573,6 +591,40 @@ struct Functions
     const view_2d<Spack>&       qv);
 #endif
 
+  // Computes the interface coefficients needed by the implicit diffusion
+  // solves, and applies the surface fluxes explicitly
+  KOKKOS_FUNCTION
+  static void update_prognostics_implicit_setup(
+    const MemberType&            team,
+    const Int&                   nlev,
+    const Int&                   nlevi,
+    const Int&                   num_tracer,
+    const Scalar&                dtime,
+    const uview_1d<const Spack>& dz_zt,
+    const uview_1d<const Spack>& dz_zi,
+    const uview_1d<const Spack>& rho_zt,
+    const uview_1d<const Spack>& zt_grid,
+    const uview_1d<const Spack>& zi_grid,
+    const uview_1d<const Spack>& tk,
+    const uview_1d<const Spack>& tkh,
+    const Scalar&                uw_sfc,
+    const Scalar&                vw_sfc,
+    const Scalar&                wthl_sfc,
+    const Scalar&                wqw_sfc,
+    const uview_1d<const Spack>& wtracer_sfc,
+    const uview_1d<Spack>&       tmpi,
+    const uview_1d<Spack>&       tkh_zi,
+    const uview_1d<Spack>&       tk_zi,
+    const uview_1d<Spack>&       rho_zi,
+    const uview_1d<Spack>&       rdp_zt,
+    const uview_1d<Spack>&       thetal,
+    const uview_1d<Spack>&       qw,
+    const uview_2d<Spack>&       tracer,
+    const uview_1d<Spack>&       tke,
+    const uview_1d<const Spack>& u_wind,
+    const uview_1d<const Spack>& v_wind,
+    Scalar&                      ksrf);
+
   KOKKOS_FUNCTION
   static void update_prognostics_implicit(
     const MemberType&            team,
@@ -599,6 +651,81 @@ struct Functions
     const uview_1d<Spack>&       tke,
     const uview_1d<Spack>&       u_wind,
     const uview_1d<Spack>&       v_wind);
+
+  // Number of workspace sub-blocks used by the storage of an ImplicitBatch
+  KOKKOS_INLINE_FUNCTION
+  static Int implicit_batch_num_blocks(const Int& num_tracer) {
+    return (num_tracer+11)*Spack::n;
+  }
+
+  // Takes the storage of an ImplicitBatch from the workspace, and sets all
+  // its systems to the identity, so that the lanes past the last column of
+  // the batch are harmless
+  KOKKOS_FUNCTION
+  static ImplicitBatch take_implicit_batch(
+    const MemberType& team,
+    const Int&        nlev,
+    const Int&        num_tracer,
+    const Workspace&  workspace);
+
+  KOKKOS_FUNCTION
+  static void release_implicit_batch(
+    const Int&           num_tracer,
+    const Workspace&     workspace,
+    const ImplicitBatch& batch);
+
+  // Same as the first half of update_prognostics_implicit, but the systems
+  // are stored in lane s of the batch rather than solved
+  KOKKOS_FUNCTION
+  static void update_prognostics_implicit_gather(
+    const MemberType&            team,
+    const Int&                   nlev,
+    const Int&                   nlevi,
+    const Int&                   num_tracer,
+    const Scalar&                dtime,
+    const Int&                   s,
+    const uview_1d<const Spack>& dz_zt,
+    const uview_1d<const Spack>& dz_zi,
+    const uview_1d<const Spack>& rho_zt,
+    const uview_1d<const Spack>& zt_grid,
+    const uview_1d<const Spack>& zi_grid,
+    const uview_1d<const Spack>& tk,
+    const uview_1d<const Spack>& tkh,
+    const Scalar&                uw_sfc,
+    const Scalar&                vw_sfc,
+    const Scalar&                wthl_sfc,
+    const Scalar&                wqw_sfc,
+    const uview_1d<const Spack>& wtracer_sfc,
+    const Workspace&             workspace,
+    const uview_1d<Spack>&       thetal,
+    const uview_1d<Spack>&       qw,
+    const uview_2d<Spack>&       tracer,
+    const uview_1d<Spack>&       tke,
+    const uview_1d<Spack>&       u_wind,
+    const uview_1d<Spack>&       v_wind,
+    const ImplicitBatch&         batch);
+
+  // Solves all the systems of the batch (see vd_shoc_solve_interleaved)
+  KOKKOS_FUNCTION
+  static void update_prognostics_implicit_solve(
+    const MemberType&    team,
+    const Int&           nlev,
+    const ImplicitBatch& batch);
+
+  // Copies the solutions in lane s of the batch back to the column
+  KOKKOS_FUNCTION
+  static void update_prognostics_implicit_scatter(
+    const MemberType&      team,
+    const Int&             nlev,
+    const Int&             num_tracer,
+    const Int&             s,
+    const ImplicitBatch&   batch,
+    const uview_1d<Spack>& thetal,
+    const uview_1d<Spack>& qw,
+    const uview_2d<Spack>& tracer,
+    const uview_1d<Spack>& tke,
+    const uview_1d<Spack>& u_wind,
+    const uview_1d<Spack>& v_wind);
 #ifdef SCREAM_SMALL_KERNELS
   static void update_prognostics_implicit_disp(
     const Int&                   shcol,
@@ -624,7 +751,8 @@ struct Functions
     const view_3d<Spack>&        tracer,
     const view_2d<Spack>&        tke,
     const view_2d<Spack>&        u_wind,
-    const view_2d<Spack>&        v_wind);
+    const view_2d<Spack>&        v_wind,
+    const bool&                  column_batched_solve);
 #endif
 
   KOKKOS_FUNCTION
@@ -837,6 +965,26 @@ struct Functions
     const uview_1d<Spack>&       wqls_sec,
     const uview_1d<Spack>&       brunt,
     const uview_1d<Spack>&       isotropy);
+
+  // Same as shoc_main_internal, but the team handles the ncols (<= Spack::n)
+  // columns starting at icol0, so that their implicit diffusion systems are
+  // solved at once (see ImplicitBatch). The other steps loop over the columns.
+  KOKKOS_FUNCTION
+  static void shoc_main_internal_batched(
+    const MemberType&        team,
+    const Int&               nlev,         // Number of levels
+    const Int&               nlevi,        // Number of levels on interface grid
+    const Int&               npbl,         // Maximum number of levels in pbl from surface
+    const Int&               nadv,         // Number of times to loop SHOC
+    const Int&               num_qtracers, // Number of tracers
+    const Scalar&            dtime,        // SHOC timestep [s]
+    const Int&               icol0,        // First column of the batch
+    const Int&               ncols,        // Number of columns in the batch
+    const SHOCInput&         shoc_input,
+    const SHOCInputOutput&   shoc_input_output,
+    const SHOCOutput&        shoc_output,
+    const SHOCHistoryOutput& shoc_history_output,
+    const Workspace&         workspace);
 #else
   static void shoc_main_internal(
     const Int&                   shcol,        // Number of columns
@@ -913,7 +1061,9 @@ struct Functions
     const view_2d<Spack>& shoc_qv,
     const view_2d<Spack>& dz_zt,
     const view_2d<Spack>& dz_zi,
-    const view_2d<Spack>& tkh);
+    const view_2d<Spack>& tkh,
+    // Options
+    const bool& column_batched_solve);
 #endif
 
   // Return microseconds elapsed
@@ -929,12 +1079,18 @@ struct Functions
     const SHOCInput&         shoc_input,           // Input
     const SHOCInputOutput&   shoc_input_output,    // Input/Output
     const SHOCOutput&        shoc_output,          // Output
-    const SHOCHistoryOutput& shoc_history_output   // Output (diagnostic)
+    const SHOCHistoryOutput& shoc_history_output,  // Output (diagnostic)
+    const bool&              column_batched_solve  // Solve the implicit diffusion of Spack::n columns at once
 #ifdef SCREAM_SMALL_KERNELS
     , const SHOCTemporaries& shoc_temporaries      // Temporaries for small kernels
 #endif
                        );
 
+  // Number of sub-blocks per slot of the WorkspaceManager passed to shoc_main
+  static Int shoc_main_num_workspace_blocks(
+    const Int&  num_qtracers,
+    const bool& column_batched_solve);
+
   KOKKOS_FUNCTION
   static void pblintd_height(
     const MemberType& team,
@@ -971,6 +1127,20 @@ struct Functions
     const uview_1d<Scalar>& d,
     const uview_2d<Spack>&  var);
 
+  // Solves the systems of Spack::n columns at once, in column-interleaved
+  // layout: lane s of du(k), dl(k), d(k) and var(r,k) belongs to the s-th
+  // column of the batch. Same algorithm as ekat::tridiag::thomas, but every
+  // pack operation works on Spack::n columns, and the rhs are spread over the
+  // team. The diagonals are overwritten with their factorization.
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_interleaved(
+    const MemberType&      team,
+    const Int&             nlev,
+    const uview_1d<Spack>& du,
+    const uview_1d<Spack>& dl,
+    const uview_1d<Spack>& d,
+    const uview_2d<Spack>& var);
+
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
       const uview_1d<const Spack>& z, const Scalar& ustar,
@@ -472,6 +472,100 @@ struct UnitWrap::UnitTest<D>::TestShocMain {
       }
     }
   } // run_bfb
+
+  // Run shoc_main with the column-batched implicit solve, and compare against the
+  // default per-column solve. The two solvers differ by roundoff, so use a tolerance.
+  static void run_column_batched()
+  {
+    auto engine = setup_random_test();
+
+    ShocMainData ref_data[] = {
+      //           shcol, nlev, nlevi, num_qtracers, dtime, nadv, nbot_shoc, ntop_shoc(C++ indexing)
+      ShocMainData(12,      72,    73,            5,   300,   15,        72, 0),
+      ShocMainData(13,     128,   129,            3,   300,    2,       128, 0),
+      ShocMainData(7,       16,    17,            3,   300,    1,        12, 0)
+    };
+
+    for (auto& d : ref_data) {
+      d.randomize(engine,
+                  {
+                    {d.presi, {700e2,1000e2}},
+                    {d.tkh, {3,50}},
+                    {d.tke, {0.1,0.3}},
+                    {d.zi_grid, {0, 3000}},
+                    {d.wthl_sfc, {0,1e-4}},
+                    {d.wqw_sfc, {0,1e-6}},
+                    {d.uw_sfc, {0,1e-2}},
+                    {d.vw_sfc, {0,1e-4}},
+                    {d.host_dx, {3000, 3000}},
+                    {d.host_dy, {3000, 3000}},
+                    {d.phis, {0, 500}},
+                    {d.wthv_sec, {-0.02, 0.03}},
+                    {d.qw, {1e-4, 5e-2}},
+                    {d.u_wind, {-10, 0}},
+                    {d.v_wind, {-10, 0}},
+                    {d.shoc_ql, {0, 1e-3}},
+                  });
+    }
+
+    ShocMainData batched_data[] = {
+      ShocMainData(ref_data[0]),
+      ShocMainData(ref_data[1]),
+      ShocMainData(ref_data[2])
+    };
+
+    const auto run = [] (ShocMainData& d, const bool column_batched_solve) {
+      d.transpose<ekat::TransposeDirection::c2f>(); // _f expects data in fortran layout
+      const int npbl = shoc_init_f(d.nlev, d.pref_mid, d.nbot_shoc, d.ntop_shoc);
+      shoc_main_f(d.shcol, d.nlev, d.nlevi, d.dtime, d.nadv, npbl, d.host_dx, d.host_dy,
+                  d.thv, d.zt_grid, d.zi_grid, d.pres, d.presi, d.pdel, d.wthl_sfc,
+                  d.wqw_sfc, d.uw_sfc, d.vw_sfc, d.wtracer_sfc, d.num_qtracers,
+                  d.w_field, d.inv_exner, d.phis, d.host_dse, d.tke, d.thetal, d.qw,
+                  d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql,
+                  d.shoc_cldfrac, d.pblh, d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec,
+                  d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec, d.wtke_sec, d.uw_sec,
+                  d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, column_batched_solve);
+      d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
+    };
+
+    // Compare relative to the largest value of each field
+    const Real tol = std::is_same<Real,double>::value ? 1e-9 : 1e-3;
+    const auto check = [&] (const Real* ref, const Real* val, const Int n) {
+      Real max_abs = 0;
+      for (Int k = 0; k < n; ++k) {
+        max_abs = std::max(max_abs, std::abs(ref[k]));
+      }
+      for (Int k = 0; k < n; ++k) {
+        REQUIRE(std::abs(val[k]-ref[k]) <= tol*std::max<Real>(1, max_abs));
+      }
+    };
+
+    static constexpr Int num_runs = sizeof(ref_data) / sizeof(ShocMainData);
+    for (Int i = 0; i < num_runs; ++i) {
+      ShocMainData& d_ref = ref_data[i];
+      ShocMainData& d_bat = batched_data[i];
+      run(d_ref, false);
+      run(d_bat, true);
+
+      const Int n2 = d_ref.total(d_ref.host_dse);
+      for (auto fields : {std::make_pair(d_ref.host_dse, d_bat.host_dse), std::make_pair(d_ref.tke, d_bat.tke),
+                          std::make_pair(d_ref.thetal, d_bat.thetal), std::make_pair(d_ref.qw, d_bat.qw),
+                          std::make_pair(d_ref.u_wind, d_bat.u_wind), std::make_pair(d_ref.v_wind, d_bat.v_wind),
+                          std::make_pair(d_ref.tk, d_bat.tk), std::make_pair(d_ref.shoc_ql, d_bat.shoc_ql),
+                          std::make_pair(d_ref.shoc_mix, d_bat.shoc_mix), std::make_pair(d_ref.w_sec, d_bat.w_sec)}) {
+        check(fields.first, fields.second, n2);
+      }
+      check(d_ref.qtracers, d_bat.qtracers, d_ref.total(d_ref.qtracers));
+      check(d_ref.pblh, d_bat.pblh, d_ref.total(d_ref.pblh));
+
+      const Int ni = d_ref.total(d_ref.thl_sec);
+      for (auto fields : {std::make_pair(d_ref.thl_sec, d_bat.thl_sec), std::make_pair(d_ref.qw_sec, d_bat.qw_sec),
+                          std::make_pair(d_ref.wthl_sec, d_bat.wthl_sec), std::make_pair(d_ref.wqw_sec, d_bat.wqw_sec),
+                          std::make_pair(d_ref.uw_sec, d_bat.uw_sec), std::make_pair(d_ref.vw_sec, d_bat.vw_sec)}) {
+        check(fields.first, fields.second, ni);
+      }
+    }
+  } // run_column_batched
 };
 
 } // namespace unit_test
@@ -494,4 +588,11 @@ TEST_CASE("shoc_main_bfb", "shoc")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("shoc_main_column_batched", "shoc")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestShocMain;
+
+  TestStruct::run_column_batched();
+}
+
 } // empty namespace
@@ -9,6 +9,12 @@
 
 #include "shoc_unit_tests_common.hpp"
 
+#include "ekat/util/ekat_tridiag.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
 namespace scream {
 namespace shoc {
 namespace unit_test {
@@ -79,6 +85,194 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
     }
   } // run_bfb
 
+  // Compare vd_shoc_solve_interleaved against the per-column solver on
+  // random diagonally dominant systems.
+  static void run_interleaved()
+  {
+    auto engine = setup_random_test();
+    std::uniform_real_distribution<Real> off_diag_dist(-1, 0), rhs_dist(-1, 1);
+
+    // ncol is not a multiple of Spack::n, to exercise a partial last batch
+    const Int ncol = 37, num_rhs = 13;
+    const Int num_batches = ekat::npack<Spack>(ncol);
+    const Int num_rhs_pack = ekat::npack<Spack>(num_rhs);
+
+    for (const Int nlev : {72, 128}) {
+      // Random systems with d = 1 - du - dl, as built by vd_shoc_decomp
+      view_2d<Scalar> du("du", ncol, nlev), dl("dl", ncol, nlev), d("d", ncol, nlev);
+      view_3d<Spack> var("var", ncol, nlev, num_rhs_pack);
+      const auto du_h  = Kokkos::create_mirror_view(du);
+      const auto dl_h  = Kokkos::create_mirror_view(dl);
+      const auto d_h   = Kokkos::create_mirror_view(d);
+      const auto var_h = Kokkos::create_mirror_view(var);
+      for (Int i = 0; i < ncol; ++i) {
+        for (Int k = 0; k < nlev; ++k) {
+          du_h(i,k) = k==nlev-1 ? 0 : off_diag_dist(engine);
+          dl_h(i,k) = k==0      ? 0 : off_diag_dist(engine);
+          d_h(i,k)  = 1 - du_h(i,k) - dl_h(i,k);
+          for (Int r = 0; r < num_rhs; ++r) {
+            var_h(i,k,r/Spack::n)[r%Spack::n] = rhs_dist(engine);
+          }
+        }
+      }
+      Kokkos::deep_copy(du, du_h);
+      Kokkos::deep_copy(dl, dl_h);
+      Kokkos::deep_copy(d, d_h);
+      Kokkos::deep_copy(var, var_h);
+
+      // Interleaved copy of the systems. Lanes past the last column solve the identity.
+      view_2d<Spack> du_i("du_i", num_batches, nlev), dl_i("dl_i", num_batches, nlev), d_i("d_i", num_batches, nlev);
+      view_3d<Spack> var_i("var_i", num_batches, num_rhs, nlev);
+      Kokkos::deep_copy(d_i, Spack(1));
+      Kokkos::parallel_for(RangePolicy(0, ncol*nlev), KOKKOS_LAMBDA(const Int& idx) {
+        const Int i = idx/nlev, k = idx%nlev;
+        const Int b = i/Spack::n, s = i%Spack::n;
+        du_i(b,k)[s] = du(i,k);
+        dl_i(b,k)[s] = dl(i,k);
+        d_i(b,k)[s]  = d(i,k);
+        for (Int r = 0; r < num_rhs; ++r) {
+          var_i(b,r,k)[s] = var(i,k,r/Spack::n)[r%Spack::n];
+        }
+      });
+
+      // Per-column solve
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, ekat::npack<Spack>(nlev));
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const Int i = team.league_rank();
+        Functions::vd_shoc_solve(team, ekat::subview(du, i), ekat::subview(dl, i), ekat::subview(d, i),
+                                 Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL()));
+      });
+
+      // Interleaved solve
+      const auto batch_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_batches, ekat::npack<Spack>(nlev));
+      Kokkos::parallel_for(batch_policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const Int b = team.league_rank();
+        Functions::vd_shoc_solve_interleaved(team, nlev, ekat::subview(du_i, b), ekat::subview(dl_i, b),
+                                             ekat::subview(d_i, b), ekat::subview(var_i, b));
+      });
+      Kokkos::fence();
+
+      // Both use the same elimination order on CPU, but the GPU per-column
+      // solver is cyclic reduction, so allow for roundoff.
+      Kokkos::deep_copy(var_h, var);
+      const auto var_i_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), var_i);
+      const Scalar tol = 1000*std::numeric_limits<Scalar>::epsilon();
+      for (Int i = 0; i < ncol; ++i) {
+        for (Int k = 0; k < nlev; ++k) {
+          for (Int r = 0; r < num_rhs; ++r) {
+            const Scalar ref = var_h(i,k,r/Spack::n)[r%Spack::n];
+            const Scalar val = var_i_h(i/Spack::n,r,k)[i%Spack::n];
+            REQUIRE(std::abs(val-ref) <= tol*std::max<Scalar>(1, std::abs(ref)));
+          }
+        }
+      }
+    }
+  } // run_interleaved
+
+  // Time the interleaved solve (including the gather/scatter that the caller
+  // pays for) against the per-column Thomas and cyclic reduction solvers.
+  static void run_perf()
+  {
+    auto engine = setup_random_test();
+    std::uniform_real_distribution<Real> off_diag_dist(-1, 0), rhs_dist(-1, 1);
+
+    const Int ncol = 1024, num_rhs = 13, num_reps = 20;
+    const Int num_batches = ekat::npack<Spack>(ncol);
+    const Int num_rhs_pack = ekat::npack<Spack>(num_rhs);
+
+    for (const Int nlev : {72, 128}) {
+      // Random systems with d = 1 - du - dl, as built by vd_shoc_decomp
+      view_2d<Scalar> du0("du0", ncol, nlev), dl0("dl0", ncol, nlev), d0("d0", ncol, nlev);
+      view_3d<Spack> var0("var0", ncol, nlev, num_rhs_pack);
+      const auto du0_h  = Kokkos::create_mirror_view(du0);
+      const auto dl0_h  = Kokkos::create_mirror_view(dl0);
+      const auto d0_h   = Kokkos::create_mirror_view(d0);
+      const auto var0_h = Kokkos::create_mirror_view(var0);
+      for (Int i = 0; i < ncol; ++i) {
+        for (Int k = 0; k < nlev; ++k) {
+          du0_h(i,k) = k==nlev-1 ? 0 : off_diag_dist(engine);
+          dl0_h(i,k) = k==0      ? 0 : off_diag_dist(engine);
+          d0_h(i,k)  = 1 - du0_h(i,k) - dl0_h(i,k);
+          for (Int r = 0; r < num_rhs; ++r) {
+            var0_h(i,k,r/Spack::n)[r%Spack::n] = rhs_dist(engine);
+          }
+        }
+      }
+      Kokkos::deep_copy(du0, du0_h);
+      Kokkos::deep_copy(dl0, dl0_h);
+      Kokkos::deep_copy(d0, d0_h);
+      Kokkos::deep_copy(var0, var0_h);
+
+      // The solvers work in place, so each rep starts from a fresh copy (not timed)
+      view_2d<Scalar> du("du", ncol, nlev), dl("dl", ncol, nlev), d("d", ncol, nlev);
+      view_3d<Spack> var("var", ncol, nlev, num_rhs_pack);
+      view_2d<Spack> du_i("du_i", num_batches, nlev), dl_i("dl_i", num_batches, nlev), d_i("d_i", num_batches, nlev);
+      view_3d<Spack> var_i("var_i", num_batches, num_rhs, nlev);
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, ekat::npack<Spack>(nlev));
+      const auto batch_policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_batches, ekat::npack<Spack>(nlev));
+
+      // 0: thomas, 1: cyclic reduction, 2: interleaved
+      double times[3] = {0, 0, 0};
+      for (Int solver = 0; solver < 3; ++solver) {
+        for (Int n = 0; n < num_reps; ++n) {
+          Kokkos::deep_copy(du, du0);
+          Kokkos::deep_copy(dl, dl0);
+          Kokkos::deep_copy(d, d0);
+          Kokkos::deep_copy(var, var0);
+          Kokkos::fence();
+          const auto start = std::chrono::steady_clock::now();
+          if (solver == 0) {
+            Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+              const Int i = team.league_rank();
+              const auto dl_c = ekat::subview(dl, i), d_c = ekat::subview(d, i), du_c = ekat::subview(du, i);
+              const auto var_c = Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL());
+              Kokkos::single(Kokkos::PerTeam(team), [&] () { ekat::tridiag::thomas(dl_c, d_c, du_c, var_c); });
+            });
+          } else if (solver == 1) {
+            Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+              const Int i = team.league_rank();
+              ekat::tridiag::cr(team, ekat::subview(dl, i), ekat::subview(d, i), ekat::subview(du, i),
+                                ekat::scalarize(Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL())));
+            });
+          } else {
+            // Gather/scatter are timed too, since the caller pays for them
+            Kokkos::parallel_for(RangePolicy(0, ncol*nlev), KOKKOS_LAMBDA(const Int& idx) {
+              const Int i = idx/nlev, k = idx%nlev;
+              const Int b = i/Spack::n, s = i%Spack::n;
+              du_i(b,k)[s] = du(i,k);
+              dl_i(b,k)[s] = dl(i,k);
+              d_i(b,k)[s]  = d(i,k);
+              for (Int r = 0; r < num_rhs; ++r) {
+                var_i(b,r,k)[s] = var(i,k,r/Spack::n)[r%Spack::n];
+              }
+            });
+            Kokkos::parallel_for(batch_policy, KOKKOS_LAMBDA(const MemberType& team) {
+              const Int b = team.league_rank();
+              Functions::vd_shoc_solve_interleaved(team, nlev, ekat::subview(du_i, b), ekat::subview(dl_i, b),
+                                                   ekat::subview(d_i, b), ekat::subview(var_i, b));
+            });
+            Kokkos::parallel_for(RangePolicy(0, ncol*nlev), KOKKOS_LAMBDA(const Int& idx) {
+              const Int i = idx/nlev, k = idx%nlev;
+              for (Int r = 0; r < num_rhs; ++r) {
+                var(i,k,r/Spack::n)[r%Spack::n] = var_i(i/Spack::n,r,k)[i%Spack::n];
+              }
+            });
+          }
+          Kokkos::fence();
+          times[solver] += std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+        }
+        times[solver] *= 1e6/num_reps;
+      }
+
+      std::stringstream ss;
+      ss << "vd_shoc_solve, ncol=" << ncol << ", nlev=" << nlev << ", num_rhs=" << num_rhs
+         << std::fixed << std::setprecision(1)
+         << ": thomas " << times[0] << " us, cr " << times[1] << " us"
+         << ", interleaved " << times[2] << " us";
+      WARN (ss.str());
+    }
+  } // run_perf
+
 };
 
 } // namespace unit_test
@@ -94,4 +288,20 @@ TEST_CASE("vd_shoc_solve_bfb", "[shoc]")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("vd_shoc_solve_interleaved", "[shoc]")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
+
+  TestStruct::run_interleaved();
+}
+
+// Timing of the interleaved solve against the per-column solvers. This test is
+// hidden, so it does not run as part of ctest. Run it with './shoc_tests [perf]'.
+TEST_CASE("vd_shoc_solve_interleaved_perf", "[.][perf]")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
+
+  TestStruct::run_perf();
+}
+
 } // empty namespace
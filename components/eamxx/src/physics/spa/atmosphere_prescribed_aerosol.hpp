@@ -98,6 +98,7 @@ protected:
   SPAFunc::SPAHorizInterp   SPAHorizInterp;
   SPAFunc::SPAInput         SPAData_start;
   SPAFunc::SPAInput         SPAData_end;
+  SPAFunc::SPAPrefetch      SPAData_next;
   SPAFunc::SPAOutput        SPAData_out;
 
   std::shared_ptr<const AbstractGrid>   m_grid;
@@ -11,6 +11,9 @@
 #include "ekat/ekat_workspace.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <atomic>
+#include <memory>
+
 namespace scream {
 namespace spa {
 
@@ -58,6 +61,10 @@ struct SPAFunctions
 
   template <typename S>
   using view_1d_host = view_Nd_host<S,1>;
+  template <typename S>
+  using view_2d_host = view_Nd_host<S,2>;
+  template <typename S>
+  using view_3d_host = view_Nd_host<S,3>;
   /* ------------------------------------------------------------------------------------------- */
   // SPA structures to help manage all of the variables:
   struct SPATimeState {
@@ -137,6 +144,74 @@ struct SPAFunctions
     SPAData         data;         // All spa fields
   }; // SPAInput
 
+  struct SPASourceData {
+    // The SPA data as it is stored in the file, that is, on the source grid
+    // and without padding. It lives on host, so that it can be filled
+    // without touching device memory (e.g., from the scorpio worker thread).
+    SPASourceData() = default;
+    SPASourceData(const int ncols_, const int nlevs_, const int nswbands_, const int nlwbands_)
+    {
+      init(ncols_,nlevs_,nswbands_,nlwbands_);
+    }
+
+    void init(const int ncols_, const int nlevs_, const int nswbands_, const int nlwbands_)
+    {
+      ncols = ncols_;
+      nlevs = nlevs_;
+      nswbands = nswbands_;
+      nlwbands = nlwbands_;
+
+      hyam       = view_1d_host<Real>("hyam",nlevs);
+      hybm       = view_1d_host<Real>("hybm",nlevs);
+      PS         = view_1d_host<Real>("PS",ncols);
+      CCN3       = view_2d_host<Real>("CCN3",ncols,nlevs);
+      AER_G_SW   = view_3d_host<Real>("AER_G_SW",ncols,nswbands,nlevs);
+      AER_SSA_SW = view_3d_host<Real>("AER_SSA_SW",ncols,nswbands,nlevs);
+      AER_TAU_SW = view_3d_host<Real>("AER_TAU_SW",ncols,nswbands,nlevs);
+      AER_TAU_LW = view_3d_host<Real>("AER_TAU_LW",ncols,nlwbands,nlevs);
+    }
+
+    int ncols;
+    int nlevs;
+    int nswbands;
+    int nlwbands;
+
+    view_1d_host<Real> hyam, hybm;
+    view_1d_host<Real> PS;
+    view_2d_host<Real> CCN3;
+    view_3d_host<Real> AER_G_SW;
+    view_3d_host<Real> AER_SSA_SW;
+    view_3d_host<Real> AER_TAU_SW;
+    view_3d_host<Real> AER_TAU_LW;
+  }; // SPASourceData
+
+  struct SPAPrefetch {
+    // Holds the month after next, which is read in the background while the
+    // current month is running, so that a month change only swaps buffers.
+    // The file read is enqueued on the scorpio worker thread, while the
+    // horizontal remap is done by the main thread once the read is over.
+    SPAPrefetch() = default;
+    SPAPrefetch(const int ncols_, const int nlevs_, const int nswbands_, const int nlwbands_)
+    {
+      data.init(ncols_,nlevs_,nswbands_,nlwbands_);
+    }
+
+    // Zero-based index of the requested time slice (-1 if none)
+    int time_index = -1;
+    // Zero-based index of the time slice to request at the next step (-1 if none).
+    // Without a worker thread the read runs inline, so it is not requested on
+    // the step that crosses the month boundary.
+    int pending_time_index = -1;
+    // Whether the read data has already been remapped into 'data'
+    bool remapped = false;
+    // Set by the reader task once the source data is in 'src'
+    std::shared_ptr<std::atomic<bool>> read_done;
+
+    std::shared_ptr<const AbstractGrid> src_grid;
+    SPASourceData   src;
+    SPAInput        data;
+  }; // SPAPrefetch
+
   // The output is really just SPAData, but for clarity it might
   // help to see a SPAOutput along a SPAInput in functions signatures
   using SPAOutput = SPAData;
@@ -190,6 +265,33 @@ struct SPAFunctions
           SPAHorizInterp& spa_horiz_interp,
           SPAInput&       spa_data);
 
+  // Reads one time slice of the source data. Only host memory is accessed.
+  static void read_spa_data_from_file(
+    const std::string&                         spa_data_file_name,
+    const int                                  time_index,
+    const std::shared_ptr<const AbstractGrid>& src_grid,
+    const SPASourceData&                       spa_src);
+
+  // Applies the horizontal remap to the source data, and pads it in the vertical
+  static void remap_spa_data(
+    const SPASourceData&  spa_src,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAInput&       spa_data);
+
+  // Enqueue the read of a time slice on the scorpio worker thread
+  static void start_spa_prefetch(
+    const std::string&    spa_data_file_name,
+    const int             time_index,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAPrefetch&    prefetch);
+
+  // Remap the prefetched data, if the read is over. If block=true, wait for
+  // the read to complete. Returns true if prefetch.data is ready to be used.
+  static bool finish_spa_prefetch(
+          SPAHorizInterp& spa_horiz_interp,
+          SPAPrefetch&    prefetch,
+    const bool            block);
+
   static void update_spa_timestate(
     const std::string&     spa_data_file_name,
     const int              nswbands,
@@ -200,6 +302,19 @@ struct SPAFunctions
           SPAInput&        spa_beg,
           SPAInput&        spa_end);
 
+  // Same as above, but the data for the following month is prefetched
+  // in the background, so that month changes do not stall on file reads.
+  static void update_spa_timestate(
+    const std::string&     spa_data_file_name,
+    const int              nswbands,
+    const int              nlwbands,
+    const util::TimeStamp& ts,
+          SPAHorizInterp&  spa_horiz_interp,
+          SPATimeState&    time_state,
+          SPAInput&        spa_beg,
+          SPAInput&        spa_end,
+          SPAPrefetch&     prefetch);
+
   // The following three are called during spa_main
   static void perform_time_interpolation (
       const SPATimeState& time_state,
@@ -4,6 +4,7 @@
 #include "share/scream_types.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/grid/point_grid.hpp"
 #include "physics/share/physics_constants.hpp"
 
@@ -416,21 +417,6 @@ void SPAFunctions<S,D>
   scorpio::register_file(spa_data_file_name,scorpio::Read);
   const int source_data_nlevs = scorpio::get_dimlen(spa_data_file_name,"lev");
 
-  // Construct local arrays to read data into
-  // Note, all of the views being created here are meant to hold the source resolution
-  // data that will need to be horizontally interpolated to the simulation grid using the remap
-  // data.  For example, 
-  //   We will first define the data surface pressure PS_v and read that from file.
-  //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
-  //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
-  //   and so on for the other variables.
-  start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
-  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
-  ekat::ParameterList spa_data_in_params;
-  spa_data_in_params.set("Field Names",fnames);
-  spa_data_in_params.set("Filename",spa_data_file_name);
-  spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
-  
   // Construct the grid needed for input:
   auto grid = std::make_shared<PointGrid>("grid",num_local_cols,source_data_nlevs,comm);
   Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
@@ -443,71 +429,116 @@ void SPAFunctions<S,D>
   EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),
       "ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
 
-  // Constuct views to read source data in from file
-  typename view_1d<Real>::HostMirror hyam_v_h("hyam",source_data_nlevs);
-  typename view_1d<Real>::HostMirror hybm_v_h("hybm",source_data_nlevs);
-  view_1d<Real> PS_v("PS",num_local_cols);
-  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
+  // Construct local arrays to read data into
+  // Note, all of the views being created here are meant to hold the source resolution
+  // data that will need to be horizontally interpolated to the simulation grid using the remap
+  // data.  For example, 
+  //   We will first define the data surface pressure PS and read that from file.
+  //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
+  //   interpolate PS onto the simulation grid: spa_src.PS -> spa_data.PS
+  //   and so on for the other variables.
+  SPASourceData spa_src(num_local_cols,source_data_nlevs,nswbands,nlwbands);
 
-  auto PS_v_h         = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h       = Kokkos::create_mirror_view(CCN3_v);      
-  auto AER_G_SW_v_h   = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h = Kokkos::create_mirror_view(AER_TAU_LW_v);
+  start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+  read_spa_data_from_file(spa_data_file_name,time_index,grid,spa_src);
+  scorpio::eam_pio_closefile(spa_data_file_name);
+  stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+
+  remap_spa_data(spa_src,spa_horiz_interp,spa_data);
+  stop_timer("EAMxx::SPA::update_spa_data_from_file");
+
+} // END update_spa_data_from_file
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::read_spa_data_from_file(
+    const std::string&                         spa_data_file_name,
+    const int                                  time_index, // zero-based
+    const std::shared_ptr<const AbstractGrid>& src_grid,
+    const SPASourceData&                       spa_src)
+{
+  // NOTE: this routine must not touch device memory, nor use timers,
+  //       since it can be executed by the scorpio worker thread.
+  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
+  ekat::ParameterList spa_data_in_params;
+  spa_data_in_params.set("Field Names",fnames);
+  spa_data_in_params.set("Filename",spa_data_file_name);
+  spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
+
+  const int ncols = spa_src.ncols;
+  const int nlevs = spa_src.nlevs;
+  const int nswbands = spa_src.nswbands;
+  const int nlwbands = spa_src.nlwbands;
 
   // Set up input structure to read data from file.
   using namespace ShortFieldTagsNames;
-  FieldLayout scalar1d_layout { {LEV}, {source_data_nlevs} };
-  FieldLayout scalar2d_layout_mid { {COL}, {num_local_cols} };
-  FieldLayout scalar3d_layout_mid { {COL,LEV}, {num_local_cols, source_data_nlevs} };
-  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {num_local_cols, nswbands, source_data_nlevs} }; 
-  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {num_local_cols, nlwbands, source_data_nlevs} };
+  FieldLayout scalar1d_layout { {LEV}, {nlevs} };
+  FieldLayout scalar2d_layout_mid { {COL}, {ncols} };
+  FieldLayout scalar3d_layout_mid { {COL,LEV}, {ncols, nlevs} };
+  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {ncols, nswbands, nlevs} }; 
+  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {ncols, nlwbands, nlevs} };
   std::map<std::string,view_1d_host<Real>> host_views;
   std::map<std::string,FieldLayout>  layouts;
   // Define each input variable we need
-  host_views["hyam"] = view_1d_host<Real>(hyam_v_h.data(),hyam_v_h.size());
+  host_views["hyam"] = view_1d_host<Real>(spa_src.hyam.data(),spa_src.hyam.size());
   layouts.emplace("hyam", scalar1d_layout);
-  host_views["hybm"] = view_1d_host<Real>(hybm_v_h.data(),hybm_v_h.size());
+  host_views["hybm"] = view_1d_host<Real>(spa_src.hybm.data(),spa_src.hybm.size());
   layouts.emplace("hybm", scalar1d_layout);
   //
-  host_views["PS"] = view_1d_host<Real>(PS_v_h.data(),PS_v_h.size());
+  host_views["PS"] = view_1d_host<Real>(spa_src.PS.data(),spa_src.PS.size());
   layouts.emplace("PS", scalar2d_layout_mid);
   //
-  host_views["CCN3"] = view_1d_host<Real>(CCN3_v_h.data(),CCN3_v_h.size());
+  host_views["CCN3"] = view_1d_host<Real>(spa_src.CCN3.data(),spa_src.CCN3.size());
   layouts.emplace("CCN3",scalar3d_layout_mid);
   //
-  host_views["AER_G_SW"] = view_1d_host<Real>(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
+  host_views["AER_G_SW"] = view_1d_host<Real>(spa_src.AER_G_SW.data(),spa_src.AER_G_SW.size());
   layouts.emplace("AER_G_SW",scalar3d_swband_layout);
   //
-  host_views["AER_SSA_SW"] = view_1d_host<Real>(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
+  host_views["AER_SSA_SW"] = view_1d_host<Real>(spa_src.AER_SSA_SW.data(),spa_src.AER_SSA_SW.size());
   layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_SW"] = view_1d_host<Real>(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
+  host_views["AER_TAU_SW"] = view_1d_host<Real>(spa_src.AER_TAU_SW.data(),spa_src.AER_TAU_SW.size());
   layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
   //
-  host_views["AER_TAU_LW"] = view_1d_host<Real>(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
+  host_views["AER_TAU_LW"] = view_1d_host<Real>(spa_src.AER_TAU_LW.data(),spa_src.AER_TAU_LW.size());
   layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
   //
   
   // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
-  AtmosphereInput spa_data_input(spa_data_in_params,grid,host_views,layouts);
+  AtmosphereInput spa_data_input(spa_data_in_params,src_grid,host_views,layouts);
   spa_data_input.read_variables(time_index);
   spa_data_input.finalize();
-  scorpio::eam_pio_closefile(spa_data_file_name);
-  stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+} // END read_spa_data_from_file
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::remap_spa_data(
+    const SPASourceData&  spa_src,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAInput&       spa_data)
+{
   start_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
+  auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  const int num_local_cols = spa_src.ncols;
+  const int source_data_nlevs = spa_src.nlevs;
+  const int nswbands = spa_src.nswbands;
+  const int nlwbands = spa_src.nlwbands;
+
   // Copy data from host back to the device views.
-  Kokkos::deep_copy(PS_v,PS_v_h);
-  Kokkos::deep_copy(CCN3_v      , CCN3_v_h);      
-  Kokkos::deep_copy(AER_G_SW_v  , AER_G_SW_v_h);
-  Kokkos::deep_copy(AER_SSA_SW_v, AER_SSA_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_SW_v, AER_TAU_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_LW_v, AER_TAU_LW_v_h);
+  view_1d<Real> PS_v("PS",num_local_cols);
+  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
+  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
+  Kokkos::deep_copy(PS_v,spa_src.PS);
+  Kokkos::deep_copy(CCN3_v      , spa_src.CCN3);
+  Kokkos::deep_copy(AER_G_SW_v  , spa_src.AER_G_SW);
+  Kokkos::deep_copy(AER_SSA_SW_v, spa_src.AER_SSA_SW);
+  Kokkos::deep_copy(AER_TAU_SW_v, spa_src.AER_TAU_SW);
+  Kokkos::deep_copy(AER_TAU_LW_v, spa_src.AER_TAU_LW);
 
   // Apply the remap to this data
   spa_horiz_map.apply_remap(PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
@@ -598,8 +629,8 @@ void SPAFunctions<S,D>
   for (int kk=0; kk<source_data_nlevs; kk++) {
     int pack = (kk+1) / Spack::n; 
     int kidx = (kk+1) % Spack::n;
-    hyam_h(pack)[kidx] = hyam_v_h(kk);
-    hybm_h(pack)[kidx] = hybm_v_h(kk);
+    hyam_h(pack)[kidx] = spa_src.hyam(kk);
+    hybm_h(pack)[kidx] = spa_src.hybm(kk);
   }
   const int pack = (source_data_nlevs+1) / Spack::n;
   const int kidx = (source_data_nlevs+1) % Spack::n;
@@ -607,9 +638,7 @@ void SPAFunctions<S,D>
   hybm_h(pack)[kidx] = 0.0;
   Kokkos::deep_copy(spa_data.hyam,hyam_h);
   Kokkos::deep_copy(spa_data.hybm,hybm_h);
-  stop_timer("EAMxx::SPA::update_spa_data_from_file");
-
-} // END update_spa_data_from_file
+} // END remap_spa_data
 
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
@@ -650,6 +679,139 @@ void SPAFunctions<S,D>
 
 } // END updata_spa_timestate
 
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::start_spa_prefetch(
+  const std::string&    spa_data_file_name,
+  const int             time_index, // zero-based
+        SPAHorizInterp& spa_horiz_interp,
+        SPAPrefetch&    prefetch)
+{
+  auto& worker = scorpio::AsyncIOWorker::instance();
+
+  // A previous request may still be filling the source buffers
+  if (prefetch.read_done and not *prefetch.read_done) {
+    worker.wait();
+  }
+
+  if (not prefetch.src_grid) {
+    // The grid is only needed to set the dofs in the input class, but building it
+    // requires device views, so we must do it here, rather than in the reader task.
+    auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+    auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
+    const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
+    const int source_data_nlevs = prefetch.data.data.nlevs-2; // Remove padding
+    auto grid = std::make_shared<PointGrid>("grid",num_local_cols,source_data_nlevs,spa_horiz_interp.m_comm);
+    Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
+    grid->get_dofs_gids().sync_to_host();
+
+    prefetch.src_grid = grid;
+    prefetch.src.init(num_local_cols,source_data_nlevs,prefetch.data.data.nswbands,prefetch.data.data.nlwbands);
+  }
+
+  prefetch.time_index = time_index;
+  prefetch.remapped = false;
+  prefetch.read_done = std::make_shared<std::atomic<bool>>(false);
+
+  // Note: capture by value, so that the task does not depend on the lifetime of 'prefetch'
+  auto done = prefetch.read_done;
+  auto grid = prefetch.src_grid;
+  auto src  = prefetch.src;
+  worker.enqueue([=]() {
+    scorpio::register_file(spa_data_file_name,scorpio::Read);
+    read_spa_data_from_file(spa_data_file_name,time_index,grid,src);
+    scorpio::eam_pio_closefile(spa_data_file_name);
+    *done = true;
+  });
+} // END start_spa_prefetch
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+bool SPAFunctions<S,D>
+::finish_spa_prefetch(
+        SPAHorizInterp& spa_horiz_interp,
+        SPAPrefetch&    prefetch,
+  const bool            block)
+{
+  if (prefetch.time_index<0) {
+    return false;
+  }
+
+  if (not prefetch.remapped) {
+    if (not *prefetch.read_done) {
+      if (not block) {
+        return false;
+      }
+      // If the read failed, this will rethrow the exception
+      scorpio::AsyncIOWorker::instance().wait();
+    }
+    remap_spa_data(prefetch.src,spa_horiz_interp,prefetch.data);
+    prefetch.remapped = true;
+  }
+  return true;
+} // END finish_spa_prefetch
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_timestate(
+  const std::string&     spa_data_file_name,
+  const int              nswbands,
+  const int              nlwbands,
+  const util::TimeStamp& ts,
+        SPAHorizInterp&  spa_horiz_interp,
+        SPATimeState&    time_state, 
+        SPAInput&        spa_beg,
+        SPAInput&        spa_end,
+        SPAPrefetch&     prefetch)
+{
+  auto next_month_of = [](const int m) { return m==12 ? 1 : m+1; };
+
+  const auto month = ts.get_month();
+  if (month != time_state.current_month or !time_state.inited) {
+    const bool consecutive = time_state.inited and month==next_month_of(time_state.current_month);
+
+    // Update the SPA time state information
+    time_state.current_month = month;
+    time_state.t_beg_month = util::TimeStamp({ts.get_year(),month,1}, {0,0,0}).frac_of_year_in_days();
+    time_state.days_this_month = util::days_in_month(ts.get_year(),month);
+
+    // NOTE: we use zero-based time indexing here.
+    const int next_month = next_month_of(time_state.current_month);
+    if (consecutive and prefetch.time_index==next_month-1) {
+      // This month's data is already in spa_end, and next month's data has been
+      // read in the background during the previous month. Only swap buffers.
+      std::swap(spa_beg,spa_end);
+      finish_spa_prefetch(spa_horiz_interp,prefetch,true);
+      std::swap(spa_end,prefetch.data);
+    } else {
+      // First call, or we skipped one or more months: read synchronously.
+      update_spa_data_from_file(spa_data_file_name,time_state.current_month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
+      update_spa_data_from_file(spa_data_file_name,next_month-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    }
+    // If time state was not initialized it is now:
+    time_state.inited = true;
+
+    // Start reading the month after next, which is needed at the next month change
+    if (scorpio::AsyncIOWorker::instance().is_threaded()) {
+      start_spa_prefetch(spa_data_file_name,next_month_of(next_month)-1,spa_horiz_interp,prefetch);
+    } else {
+      prefetch.time_index = -1;
+      prefetch.pending_time_index = next_month_of(next_month)-1;
+    }
+  } else {
+    if (prefetch.pending_time_index>=0) {
+      start_spa_prefetch(spa_data_file_name,prefetch.pending_time_index,spa_horiz_interp,prefetch);
+      prefetch.pending_time_index = -1;
+    }
+    // Remap the prefetched data as soon as it is available, so that it is not
+    // done during the step that crosses the month boundary.
+    finish_spa_prefetch(spa_horiz_interp,prefetch,false);
+  }
+
+} // END updata_spa_timestate
+
 template<typename S,typename D>
 KOKKOS_INLINE_FUNCTION
 auto SPAFunctions<S,D>::
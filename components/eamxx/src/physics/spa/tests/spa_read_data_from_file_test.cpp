@@ -111,7 +111,36 @@ TEST_CASE("spa_read_data","spa")
       }
     }
   }
-  
+
+
+  // The prefetched data must match what is read synchronously
+  SPAFunc::SPAPrefetch spa_next(dofs_gids.size(), nlevs+2, nswbands, nlwbands);
+  REQUIRE (not SPAFunc::finish_spa_prefetch(spa_horiz_interp,spa_next,false));
+  for (int time_index = 0;time_index<max_time; time_index++) {
+    SPAFunc::start_spa_prefetch(spa_data_file, time_index, spa_horiz_interp, spa_next);
+    SPAFunc::update_spa_data_from_file(spa_data_file, time_index, nswbands, nlwbands,
+                                       spa_horiz_interp, spa_data);
+    REQUIRE (SPAFunc::finish_spa_prefetch(spa_horiz_interp,spa_next,true));
+
+    auto ps_next_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),spa_next.data.PS);
+    auto ccn3_next_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),spa_next.data.data.CCN3);
+    auto tau_lw_next_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),spa_next.data.data.AER_TAU_LW);
+    Kokkos::deep_copy(ps_h,spa_data.PS);
+    Kokkos::deep_copy(ccn3_h,spa_data.data.CCN3);
+    Kokkos::deep_copy(aer_tau_lw_h,spa_data.data.AER_TAU_LW);
+    for (size_t dof_i=0;dof_i<dofs_gids_h.size();dof_i++) {
+      REQUIRE(ps_next_h(dof_i) == ps_h(dof_i));
+      for (int kk=0;kk<nlevs+2;kk++) {
+        int kpack = kk / Spack::n;
+        int kidx  = kk % Spack::n;
+        REQUIRE(ccn3_next_h(dof_i,kpack)[kidx] == ccn3_h(dof_i,kpack)[kidx]);
+        for (int n=0;n<nlwbands;n++) {
+          REQUIRE(tau_lw_next_h(dof_i,n,kpack)[kidx] == aer_tau_lw_h(dof_i,n,kpack)[kidx]);
+        }
+      }
+    }
+  }
+
   // All Done 
   scorpio::eam_pio_finalize();
 } // run_property
@@ -343,10 +343,17 @@ add_nodes (const group_type& atm_procs)
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, all procs see the same input state, so each proc
+  // must find its providers among the nodes *preceding* this group.
+  // The outputs of all the procs become available only after the group.
+  const auto providers_in = m_fid_to_last_provider;
+  auto providers_out = providers_in;
 
   int id = m_nodes.size();
   for (int i=0; i<num_procs; ++i) {
+    if (not sequential) {
+      m_fid_to_last_provider = providers_in;
+    }
     const auto proc = atm_procs.get_process(i);
     const bool is_group = (proc->type()==AtmosphereProcessType::Group);
     if (is_group) {
@@ -461,7 +468,63 @@ add_nodes (const group_type& atm_procs)
       }
       ++id;
     }
+
+    if (not sequential) {
+      for (const auto& it : m_fid_to_last_provider) {
+        auto it_in = providers_in.find(it.first);
+        if (it_in==providers_in.end() || it_in->second!=it.second) {
+          providers_out[it.first] = it.second;
+        }
+      }
+    }
+  }
+
+  if (not sequential) {
+    m_fid_to_last_provider = providers_out;
+  }
+}
+
+AtmProcDAG::parallel_deps_t AtmProcDAG::
+get_parallel_deps (const group_type& atm_procs)
+{
+  EKAT_REQUIRE_MSG (atm_procs.get_schedule_type()==ScheduleType::Parallel,
+      "Error! Parallel dependencies requested for a sequential atm proc group.\n"
+      "   atm proc group: " + atm_procs.name() + "\n");
+
+  const int num_procs = atm_procs.get_num_processes();
+  parallel_deps_t deps;
+
+  // Providers first, so that procs updating a field are not listed as consumers
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    for (const auto& req : proc->get_computed_field_requests()) {
+      auto& providers = deps[std::make_pair(req.fid.name(),req.fid.get_grid_name())].providers;
+      if (not ekat::contains(providers,i)) {
+        providers.push_back(i);
+      }
+    }
+  }
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    for (const auto& req : proc->get_required_field_requests()) {
+      auto it = deps.find(std::make_pair(req.fid.name(),req.fid.get_grid_name()));
+      if (it!=deps.end() && not ekat::contains(it->second.providers,i) &&
+                            not ekat::contains(it->second.consumers,i)) {
+        it->second.consumers.push_back(i);
+      }
+    }
   }
+
+  // A field computed by a single proc, and not used by any other, creates no dependency
+  for (auto it=deps.begin(); it!=deps.end(); ) {
+    if (it->second.providers.size()==1 && it->second.consumers.size()==0) {
+      it = deps.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  return deps;
 }
 
 int AtmProcDAG::add_fid (const FieldIdentifier& fid) {
@@ -1,13 +1,18 @@
 #ifndef SCREAM_ATMOSPHERE_PROCESS_DAG_HPP
 #define SCREAM_ATMOSPHERE_PROCESS_DAG_HPP
 
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
-#include "share/atm_process/atmosphere_process_group.hpp"
+#include <vector>
 #include "share/field/field_group.hpp"
 
 namespace scream {
 
+// Forward declaration (the group stores the dependencies of its processes)
+class AtmosphereProcessGroup;
+
 class AtmProcDAG {
 public:
 
@@ -21,6 +26,18 @@ public:
 
   void write_dag (const std::string& fname, const int verbosity = VERB_MAX) const;
 
+  // Dependencies among the processes of a parallel group. For each field that
+  // is computed by a process of the group and used by another, list the indices
+  // of the processes computing it, and of the ones only requiring it. Fields are
+  // keyed by (name, grid name). This relies on the field requests only, so it
+  // can be used before the fields are set in the processes.
+  struct ParallelDeps {
+    std::vector<int>  providers;
+    std::vector<int>  consumers;
+  };
+  using parallel_deps_t = std::map<std::pair<std::string,std::string>,ParallelDeps>;
+  static parallel_deps_t get_parallel_deps (const group_type& atm_procs);
+
   bool has_unmet_dependencies () const { return m_has_unmet_deps; }
   const std::map<int,std::set<int>>& unmet_deps () const {
     return m_unmet_deps;
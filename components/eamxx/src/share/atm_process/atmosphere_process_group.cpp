@@ -27,7 +27,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -49,25 +48,11 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (int i=0; i<m_group_size; ++i) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as the comm
+    // of this APG. In parallel scheduling, the processes are still run one at a time.
+    // NOTE: running them concurrently would require each process to launch all its
+    //       kernels on its own execution space instance, which no process does yet.
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      ekat::error::runtime_abort("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Check if the i-th entry is a "named" atm proc or a group defined on the fly.
     // In the first case, the i-th entry of the string list is just a string,
@@ -391,8 +376,125 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // Reset snapshots and private copies of shared fields to the input state
+  for (auto& it : m_parallel_fields) {
+    auto& pf = it.second;
+    EKAT_REQUIRE_MSG (not pf.field.is_read_only(),
+        "Error! Shared field in parallel atm proc group was never set as computed.\n"
+        "   field id: " + it.first + "\n"
+        "   atm process: " + this->name() + "\n"
+        "Something is wrong up the call stack. Please, contact developers.\n");
+
+    const auto& ts = pf.field.get_header().get_tracking().get_time_stamp();
+    pf.snapshot.deep_copy(pf.field);
+    pf.snapshot.get_header().get_tracking().update_time_stamp(ts);
+    for (auto& c : pf.copies) {
+      c.second.deep_copy(pf.field);
+      c.second.get_header().get_tracking().update_time_stamp(ts);
+    }
+  }
+
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->set_update_time_stamps(do_update);
+    atm_proc->run(dt);
+  }
+
+  // Add the increments of all the private copies to the original fields:
+  //   f = f + sum_i (f_i - f_0)
+  // where f_0 is the input state, and f already holds the result of the first writer.
+  for (auto& it : m_parallel_fields) {
+    auto& pf = it.second;
+    for (const auto& c : pf.copies) {
+      pf.field.update(c.second,Real(1),Real(1));
+      pf.field.update(pf.snapshot,Real(-1),Real(1));
+    }
+  }
+}
+
+Field AtmosphereProcessGroup::
+get_field_for_proc (const Field& f, const int iproc)
+{
+  if (m_group_schedule_type==ScheduleType::Sequential) {
+    return f;
+  }
+
+  const auto& fid = f.get_header().get_identifier();
+  const auto key = fid.get_id_string();
+  auto it = m_parallel_fields.find(key);
+  if (it==m_parallel_fields.end()) {
+    if (not m_parallel_deps_set) {
+      // All field requests (including tendencies) are known by the time fields are set
+      m_parallel_deps = AtmProcDAG::get_parallel_deps(*this);
+      m_parallel_deps_set = true;
+    }
+    auto it_deps = m_parallel_deps.find(std::make_pair(fid.name(),fid.get_grid_name()));
+    if (it_deps==m_parallel_deps.end()) {
+      // Nobody else can see this process' updates: no need for copies
+      return f;
+    }
+    const auto& writers = it_deps->second.providers;
+
+    EKAT_REQUIRE_MSG (writers.size()==1 || fid.data_type()==get_data_type<Real>(),
+        "Error! Fields computed by more than one process in a parallel group must have Real data type.\n"
+        "   field id: " + key + "\n"
+        "   atm process: " + this->name() + "\n");
+
+    auto& pf = m_parallel_fields[key];
+    pf.field = f;
+    pf.snapshot = f.clone();
+    pf.first_writer = writers[0];
+    for (size_t k=1; k<writers.size(); ++k) {
+      pf.copies[writers[k]] = f.clone();
+    }
+    it = m_parallel_fields.find(key);
+  }
+
+  auto& pf = it->second;
+  if (not f.is_read_only()) {
+    // We may have been called with the read-only version first
+    pf.field = f;
+  }
+
+  if (iproc==pf.first_writer) {
+    return f;
+  } else if (pf.copies.count(iproc)==1) {
+    return f.is_read_only() ? pf.copies.at(iproc).get_const() : pf.copies.at(iproc);
+  }
+  return pf.snapshot.get_const();
+}
+
+void AtmosphereProcessGroup::
+check_parallel_group (const FieldGroup& group) const
+{
+  const auto& gname = group.m_info->m_group_name;
+  const auto& grid  = group.grid_name();
+
+  std::vector<std::string> users;
+  bool computed = false;
+  for (const auto& atm_proc : m_atm_processes) {
+    bool computes = atm_proc->has_computed_group(gname,grid);
+    bool uses = computes || atm_proc->has_required_group(gname,grid);
+    for (const auto& it : group.m_fields) {
+      const auto& fid = it.second->get_header().get_identifier();
+      computes |= atm_proc->has_computed_field(fid);
+      uses |= atm_proc->has_computed_field(fid) || atm_proc->has_required_field(fid);
+    }
+    if (uses) {
+      users.push_back(atm_proc->name());
+    }
+    computed |= computes;
+  }
+
+  EKAT_REQUIRE_MSG (not computed || users.size()<=1,
+      "Error! A field group computed by an atm proc in a parallel group cannot be\n"
+      "       used by other atm procs in the same group.\n"
+      "   group name: " + gname + "\n"
+      "   grid name : " + grid + "\n"
+      "   atm procs : " + ekat::join(users,", ") + "\n"
+      "   atm process group: " + this->name() + "\n");
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -413,6 +515,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -481,6 +584,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -556,6 +660,9 @@ endloop:
 void AtmosphereProcessGroup::
 set_required_group_impl (const FieldGroup& group)
 {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    check_parallel_group(group);
+  }
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_required_group(group.m_info->m_group_name,group.grid_name())) {
       atm_proc->set_required_group(group);
@@ -566,6 +673,9 @@ set_required_group_impl (const FieldGroup& group)
 void AtmosphereProcessGroup::
 set_computed_group_impl (const FieldGroup& group)
 {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    check_parallel_group(group);
+  }
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_computed_group(group.m_info->m_group_name,group.grid_name())) {
       atm_proc->set_computed_group(group);
@@ -582,25 +692,28 @@ set_computed_group_impl (const FieldGroup& group)
 
 void AtmosphereProcessGroup::set_required_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
-  for (auto atm_proc : m_atm_processes) {
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
     if (atm_proc->has_required_field(fid)) {
-      atm_proc->set_required_field(f);
+      atm_proc->set_required_field(get_field_for_proc(f,iproc));
     }
   }
 }
 
 void AtmosphereProcessGroup::set_computed_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
-  for (auto atm_proc : m_atm_processes) {
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
+    const auto f_proc = get_field_for_proc(f,iproc);
     if (atm_proc->has_computed_field(fid)) {
-      atm_proc->set_computed_field(f);
+      atm_proc->set_computed_field(f_proc);
     }
     // In sequential scheduling, some fields may be computed by
     // a process and used by the next one. In this case, the field
     // does not figure as 'input' for the group, but we still
     // need to set it in the processes that need it.
     if (atm_proc->has_required_field(fid)) {
-      atm_proc->set_required_field(f.get_const());
+      atm_proc->set_required_field(f_proc.get_const());
     }
   }
 }
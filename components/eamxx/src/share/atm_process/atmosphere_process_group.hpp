@@ -2,6 +2,7 @@
 #define SCREAM_ATMOSPHERE_PROCESS_GROUP_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 #include "control/surface_coupling_utils.hpp"
 
@@ -9,6 +10,7 @@
 
 #include <string>
 #include <list>
+#include <map>
 
 namespace scream
 {
@@ -24,6 +26,12 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all processes in the group see the same input state.
+ *  If a field is computed by more than one process, or computed by one process
+ *  and required by another, each process works on its own copy of the field,
+ *  and the increments of all processes are summed up once they have all run.
+ *  The processes are still run one at a time.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -110,6 +118,14 @@ protected:
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
 
+  // In parallel scheduling, returns the version of f that the iproc-th process
+  // should use (see m_parallel_fields). In sequential scheduling, returns f.
+  Field get_field_for_proc (const Field& f, const int iproc);
+
+  // In parallel scheduling, groups cannot be shared among processes
+  // if at least one of them computes (part of) the group.
+  void check_parallel_group (const FieldGroup& group) const;
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -126,6 +142,24 @@ protected:
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
 
+  // Dependencies among the processes of a parallel group (see AtmProcDAG)
+  AtmProcDAG::parallel_deps_t  m_parallel_deps;
+  bool                         m_parallel_deps_set = false;
+
+  // A field that is used by more than one process in a parallel group, with at
+  // least one of them computing it. The first process computing it works on the
+  // original field, while other processes computing it get a private copy, and
+  // processes that only require it get a snapshot of the input state.
+  struct ParallelField {
+    Field               field;
+    Field               snapshot;
+    int                 first_writer;
+    std::map<int,Field> copies;
+  };
+
+  // Shared fields in parallel scheduling, indexed by field identifier string
+  std::map<std::string,ParallelField>  m_parallel_fields;
+
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
 };
@@ -167,4 +167,38 @@ void Field::allocate_view ()
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
+void Field::allocate_view (const view_dev_t<char*>&  dev_buf,
+                           const view_host_t<char*>& host_buf,
+                           const long long offset)
+{
+  // See the other allocate_view for why we prohibit this
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+
+  // Short names
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout_ptr();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  // Check the identifier has all the dimensions set
+  EKAT_REQUIRE_MSG(layout->are_dimensions_set(),
+      "Error! Cannot allocate the view until all the field's dimensions are set.\n");
+
+  // Commit the allocation properties
+  alloc_prop.commit(layout);
+
+  const long long view_dim = alloc_prop.get_alloc_size();
+  EKAT_REQUIRE_MSG (offset>=0 && offset+view_dim<=static_cast<long long>(dev_buf.size()),
+      "Error! Input buffer is too small to hold the field at the requested offset.\n"
+      "  - field name : " + id.name() + "\n"
+      "  - field size : " + std::to_string(view_dim) + "\n"
+      "  - offset     : " + std::to_string(offset) + "\n"
+      "  - buffer size: " + std::to_string(dev_buf.size()) + "\n");
+  EKAT_REQUIRE_MSG (host_buf.size()==dev_buf.size(),
+      "Error! Host and device buffers have different sizes.\n");
+
+  const auto range = Kokkos::make_pair<size_t,size_t>(offset,offset+view_dim);
+  m_data.d_view = Kokkos::subview(dev_buf,range);
+  m_data.h_view = Kokkos::subview(host_buf,range);
+}
+
 } // namespace scream
@@ -260,6 +260,13 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Like the above, but the data is a slice of the input (already allocated)
+  // buffers, starting at byte 'offset'. The field holds a reference to the
+  // buffers, so they stay alive as long as the field does.
+  void allocate_view (const view_dev_t<char*>&  dev_buf,
+                      const view_host_t<char*>& host_buf,
+                      const long long offset);
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
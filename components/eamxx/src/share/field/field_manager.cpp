@@ -1,5 +1,8 @@
 #include "share/field/field_manager.hpp"
 
+#include <algorithm>
+#include <functional>
+
 namespace scream
 {
 
@@ -331,6 +334,11 @@ void FieldManager::registration_ends ()
     }
   }
 
+  // If we use an arena, fields that are part of a bundled field are not allocated
+  // on their own: they will be subfields of the bundled field.
+  std::set<ci_string> bundled_fields;
+  std::vector<std::function<void()>> deferred_setups;
+
   // Do all the bundling stuff only if there are groups do bundle at all.
   if (groups_to_bundle.size()>0) {
     using namespace ShortFieldTagsNames;
@@ -551,67 +559,79 @@ void FieldManager::registration_ends ()
         }
       }
 
-      // Allocate
-      C->allocate_view();
+      // Create all subfields of C, and update the info of the groups in the cluster.
+      // This requires C to be allocated. If we use an arena, C is allocated once
+      // all fields have been sized, so this step must be deferred until then.
+      auto setup_cluster = [this,C,cluster,cluster_ordered_fields] () mutable {
+        // Note: as of 02/2021, idim should *always* be 1, but we store it just in case,
+        //       to avoid bugs in the future.
+        const auto& C_tags = C->get_header().get_identifier().get_layout().tags();
+        const int idim = std::distance(C_tags.begin(),ekat::find(C_tags,CMP));
+
+        if (ekat::contains(cluster,"__qv__")) {
+          // Erase the 'fake group' we added (to guarantee qv would be first/last in the tracers)
+          m_field_groups.erase(m_field_groups.find("__qv__"));
+          cluster.erase(ekat::find(cluster,"__qv__"));
+        }
 
-      // Note: as of 02/2021, idim should *always* be 1, but we store it just in case,
-      //       to avoid bugs in the future.
-      const auto& C_tags = C->get_header().get_identifier().get_layout().tags();
-      const int idim = std::distance(C_tags.begin(),ekat::find(C_tags,CMP));
+        // Create all individual subfields
+        for (const auto& fn : cluster_ordered_fields) {
+          const auto pos = ekat::find(cluster_ordered_fields,fn);
+          const auto idx = std::distance(cluster_ordered_fields.begin(),pos);
 
-      if (ekat::contains(cluster,"__qv__")) {
-        // Erase the 'fake group' we added (to guarantee qv would be first/last in the tracers)
-        m_field_groups.erase(m_field_groups.find("__qv__"));
-        cluster.erase(ekat::find(cluster,"__qv__"));
-      }
+          const auto& f = m_fields.at(fn);
+          const auto& fid = f->get_header().get_identifier();
+          EKAT_REQUIRE_MSG (fid.get_units()!=ekat::units::Units::invalid(),
+              "Error! A field was registered without providing valid units.\n"
+              "  - field id: " + fid.get_id_string() + "\n");
+          auto fi = C->subfield(fn,fid.get_units(),idim,idx);
 
-      // Create all individual subfields
-      for (const auto& fn : cluster_ordered_fields) {
-        const auto pos = ekat::find(cluster_ordered_fields,fn);
-        const auto idx = std::distance(cluster_ordered_fields.begin(),pos);
+          // Overwrite existing field with subfield
+          *f = fi;
+        }
 
-        const auto& f = m_fields.at(fn);
-        const auto& fid = f->get_header().get_identifier();
-        EKAT_REQUIRE_MSG (fid.get_units()!=ekat::units::Units::invalid(),
-            "Error! A field was registered without providing valid units.\n"
-            "  - field id: " + fid.get_id_string() + "\n");
-        auto fi = C->subfield(fn,fid.get_units(),idim,idx);
-
-        // Overwrite existing field with subfield
-        *f = fi;
-      }
+        // Now, update the group info of all the field groups in the cluster
+        for (const auto& gn : cluster) {
+          auto& info = *m_field_groups.at(gn);
+          const auto n = info.size();
+
+          // Find the first field of this group in the ordered cluster names.
+          auto first = std::find_first_of(cluster_ordered_fields.begin(),cluster_ordered_fields.end(),
+                                          info.m_fields_names.begin(),info.m_fields_names.end());
+          auto last = std::next(first,n);
+
+          // Some sanity checks: info.m_fields_names should be a rearrangement of what is
+          // in cluster_odered_fields[first,last)
+          EKAT_REQUIRE_MSG(first!=cluster_ordered_fields.end(),
+              "Error! Could not find any field of this group in the ordered cluster.\n"
+              "       Group name: " + gn + "\n");
+          EKAT_REQUIRE_MSG(std::distance(last,cluster_ordered_fields.end())>=0,
+              "Error! Something went wrong while looking for fields of this group in the ordered cluster.\n"
+              "       Group name: " + gn + "\n");
+          EKAT_REQUIRE_MSG(std::is_permutation(first,last,info.m_fields_names.begin(),info.m_fields_names.end()),
+              "Error! Something went wrong while looking for fields of this group in the ordered cluster.\n"
+              "       Group name: " + gn + "\n");
+
+          // Update the list of fields in the group info, mark it as bundled,
+          // and update the subfield indices too.
+          info.m_fields_names.clear();
+          for (auto it=first; it!=last; ++it) {
+            info.m_fields_names.push_back(*it);
+            info.m_subview_dim = idim;
+            info.m_subview_idx [*it] = std::distance(cluster_ordered_fields.begin(),it);
+          }
+          info.m_bundled = true;
+        }
+      };
 
-      // Now, update the group info of all the field groups in the cluster
-      for (const auto& gn : cluster) {
-        auto& info = *m_field_groups.at(gn);
-        const auto n = info.size();
-
-        // Find the first field of this group in the ordered cluster names.
-        auto first = std::find_first_of(cluster_ordered_fields.begin(),cluster_ordered_fields.end(),
-                                        info.m_fields_names.begin(),info.m_fields_names.end());
-        auto last = std::next(first,n);
-
-        // Some sanity checks: info.m_fields_names should be a rearrangement of what is
-        // in cluster_odered_fields[first,last)
-        EKAT_REQUIRE_MSG(first!=cluster_ordered_fields.end(),
-            "Error! Could not find any field of this group in the ordered cluster.\n"
-            "       Group name: " + gn + "\n");
-        EKAT_REQUIRE_MSG(std::distance(last,cluster_ordered_fields.end())>=0,
-            "Error! Something went wrong while looking for fields of this group in the ordered cluster.\n"
-            "       Group name: " + gn + "\n");
-        EKAT_REQUIRE_MSG(std::is_permutation(first,last,info.m_fields_names.begin(),info.m_fields_names.end()),
-            "Error! Something went wrong while looking for fields of this group in the ordered cluster.\n"
-            "       Group name: " + gn + "\n");
-
-        // Update the list of fields in the group info, mark it as bundled,
-        // and update the subfield indices too.
-        info.m_fields_names.clear();
-        for (auto it=first; it!=last; ++it) {
-          info.m_fields_names.push_back(*it);
-          info.m_subview_dim = idim;
-          info.m_subview_idx [*it] = std::distance(cluster_ordered_fields.begin(),it);
+      if (m_use_arena) {
+        deferred_setups.push_back(setup_cluster);
+        for (const auto& fn : cluster_ordered_fields) {
+          bundled_fields.insert(fn);
         }
-        info.m_bundled = true;
+      } else {
+        C->allocate_view();
+        setup_cluster();
       }
     }
   }
@@ -652,7 +672,9 @@ void FieldManager::registration_ends ()
     for (const auto& req : m_group_requests.at(gname)) {
       G_ap.request_allocation(req.pack_size);
     }
-    G->allocate_view();
+    if (not m_use_arena) {
+      G->allocate_view();
+    }
 
     // Now, update the group info of the copied group, by setting the
     // correct subview_idx, in case the user wants to extract the
@@ -672,6 +694,23 @@ void FieldManager::registration_ends ()
     info.m_bundled = true;
   }
 
+  if (m_use_arena) {
+    // Carve all fields out of a single allocation. Fields that will become
+    // subfields of a bundled field must not get their own slice.
+    std::vector<std::shared_ptr<Field>> fields;
+    for (auto& it : m_fields) {
+      if (not it.second->is_allocated() && bundled_fields.count(it.first)==0) {
+        fields.push_back(it.second);
+      }
+    }
+    allocate_arena (fields);
+
+    // Now that bundled fields are allocated, we can create their subfields
+    for (auto& setup : deferred_setups) {
+      setup();
+    }
+  }
+
   for (auto& it : m_fields) {
     if (it.second->is_allocated()) {
       // If the field has been already allocated, then it was in a bunlded group, so skip it.
@@ -700,11 +739,76 @@ void FieldManager::registration_ends ()
   m_repo_state = RepoState::Closed;
 }
 
+void FieldManager::set_arena_allocation (const bool use_arena)
+{
+  EKAT_REQUIRE_MSG (m_repo_state!=RepoState::Closed,
+      "Error! Cannot change the allocation strategy after registration_ends() was called.\n");
+
+  m_use_arena = use_arena;
+}
+
+void FieldManager::allocate_arena (std::vector<std::shared_ptr<Field>>& fields)
+{
+  // Place fields with the same layout next to each other, so that loops over
+  // fields with a given layout walk contiguous memory.
+  // Note: the sort is stable, so the order is deterministic on all ranks
+  auto layout_less = [](const std::shared_ptr<Field>& lhs, const std::shared_ptr<Field>& rhs) {
+    const auto& l1 = lhs->get_header().get_identifier().get_layout();
+    const auto& l2 = rhs->get_header().get_identifier().get_layout();
+    if (l1.tags()!=l2.tags()) {
+      return l1.tags()<l2.tags();
+    }
+    return l1.dims()<l2.dims();
+  };
+  std::stable_sort(fields.begin(),fields.end(),layout_less);
+
+  // Compute the offset of each field in the arena. Each field starts at
+  // a multiple of the alignment, as it would with separate allocations.
+  constexpr long long alignment = 64;
+  std::vector<long long> offsets;
+  long long arena_size = 0;
+  for (auto& f : fields) {
+    const auto& id = f->get_header().get_identifier();
+    auto& ap = f->get_header().get_alloc_properties();
+    ap.commit(id.get_layout_ptr());
+
+    offsets.push_back(arena_size);
+    arena_size += (ap.get_alloc_size() + alignment - 1) / alignment * alignment;
+  }
+
+  m_arena_dev  = decltype(m_arena_dev)("FieldManager arena on " + m_grid->name(),arena_size);
+  m_arena_host = Kokkos::create_mirror_view(m_arena_dev);
+
+  for (size_t i=0; i<fields.size(); ++i) {
+    fields[i]->allocate_view(m_arena_dev,m_arena_host,offsets[i]);
+  }
+}
+
+void FieldManager::sync_to_host () const
+{
+  EKAT_REQUIRE_MSG (m_use_arena && m_repo_state==RepoState::Closed,
+      "Error! FieldManager::sync_to_host is only available for arena-allocated fields,\n"
+      "       after registration_ends() was called.\n");
+  Kokkos::deep_copy(m_arena_host,m_arena_dev);
+}
+
+void FieldManager::sync_to_dev () const
+{
+  EKAT_REQUIRE_MSG (m_use_arena && m_repo_state==RepoState::Closed,
+      "Error! FieldManager::sync_to_dev is only available for arena-allocated fields,\n"
+      "       after registration_ends() was called.\n");
+  Kokkos::deep_copy(m_arena_dev,m_arena_host);
+}
+
 void FieldManager::clean_up() {
   // Clear the maps
   m_fields.clear();
   m_field_groups.clear();
 
+  // Release the arena (if any)
+  m_arena_dev  = decltype(m_arena_dev)();
+  m_arena_host = decltype(m_arena_host)();
+
   // Reset repo state
   m_repo_state = RepoState::Clean;
 }
@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace scream
 {
@@ -56,6 +57,20 @@ public:
   void registration_ends ();
   void clean_up ();
 
+  // If true, all fields allocated by this FieldManager are carved out of
+  // a single contiguous allocation (the "arena"), with fields of the same
+  // layout placed next to each other. Must be called before registration_ends.
+  // Note: fields added later via add_field are *not* part of the arena.
+  void set_arena_allocation (const bool use_arena);
+  bool uses_arena_allocation () const { return m_use_arena; }
+
+  // If the arena is used, these sync all fields host<->device with a single transfer
+  void sync_to_host () const;
+  void sync_to_dev () const;
+
+  // Size in bytes of the arena (0 if not used)
+  long long get_arena_size () const { return m_arena_dev.size(); }
+
   // Adds an externally-constructed field to the FieldManager. Allows the FM
   // to make the field available as if it had been built with the usual
   // registration procedures.
@@ -107,6 +122,8 @@ protected:
 
   void pre_process_group_requests ();
 
+  void allocate_arena (std::vector<std::shared_ptr<Field>>& fields);
+
   // The state of the repository
   RepoState           m_repo_state;
 
@@ -130,6 +147,11 @@ protected:
 
   // The grid where the fields in this FM live
   std::shared_ptr<const AbstractGrid> m_grid;
+
+  // If m_use_arena=true, the single allocation holding all the fields
+  bool                                  m_use_arena = false;
+  Field::view_dev_t<char*>              m_arena_dev;
+  Field::view_host_t<char*>             m_arena_host;
 };
 
 } // namespace scream
@@ -102,15 +102,12 @@ registration_ends () {
 }
 
 void AbstractRemapper::remap (const bool forward) {
-  EKAT_REQUIRE_MSG(m_state!=RepoState::Open,
-                     "Error! Cannot perform remapping at this time.\n"
-                     "       Did you forget to call 'registration_ends'?\n");
+  check_can_remap();
 
-  EKAT_REQUIRE_MSG(m_num_bound_fields==m_num_fields,
-                     "Error! Not all fields have been set in the remapper.\n"
-                     "       In particular, field " +
-                     std::to_string(std::distance(m_fields_are_bound.begin(),std::find(m_fields_are_bound.begin(),m_fields_are_bound.end(),false))) +
-                     " has not been bound.\n");
+  EKAT_REQUIRE_MSG(not m_fwd_pending,
+                     "Error! Cannot perform remapping at this time.\n"
+                     "       A split-phase forward remap is still in progress.\n"
+                     "       Did you forget to call 'remap_fwd_end'?\n");
 
   if (m_state!=RepoState::Clean) {
     if (forward) {
@@ -127,6 +124,45 @@ void AbstractRemapper::remap (const bool forward) {
   }
 }
 
+void AbstractRemapper::remap_fwd_begin () {
+  check_can_remap();
+
+  EKAT_REQUIRE_MSG(not m_fwd_pending,
+                     "Error! Cannot start a forward remap at this time.\n"
+                     "       Did you forget to call 'remap_fwd_end'?\n");
+
+  if (m_state!=RepoState::Clean) {
+    EKAT_REQUIRE_MSG (m_fwd_allowed,
+                     "Error! Forward remap is not allowed by this remapper.\n"
+                     "       This means that some fields on the target grid are read-only.\n");
+    do_remap_fwd_begin ();
+  }
+  m_fwd_pending = true;
+}
+
+void AbstractRemapper::remap_fwd_end () {
+  EKAT_REQUIRE_MSG(m_fwd_pending,
+                     "Error! Cannot complete a forward remap at this time.\n"
+                     "       Did you forget to call 'remap_fwd_begin'?\n");
+
+  if (m_state!=RepoState::Clean) {
+    do_remap_fwd_end ();
+  }
+  m_fwd_pending = false;
+}
+
+void AbstractRemapper::check_can_remap () const {
+  EKAT_REQUIRE_MSG(m_state!=RepoState::Open,
+                     "Error! Cannot perform remapping at this time.\n"
+                     "       Did you forget to call 'registration_ends'?\n");
+
+  EKAT_REQUIRE_MSG(m_num_bound_fields==m_num_fields,
+                     "Error! Not all fields have been set in the remapper.\n"
+                     "       In particular, field " +
+                     std::to_string(std::distance(m_fields_are_bound.begin(),std::find(m_fields_are_bound.begin(),m_fields_are_bound.end(),false))) +
+                     " has not been bound.\n");
+}
+
 void AbstractRemapper::
 set_grids (const grid_ptr_type& src_grid,
            const grid_ptr_type& tgt_grid)
@@ -69,6 +69,16 @@ public:
   // The actual remap routine.
   void remap (const bool forward);
 
+  // Split-phase forward remap: remap_fwd_begin starts the remap, and
+  // remap_fwd_end completes it. In between, the caller can do other work,
+  // but must not modify the src fields, nor access the tgt fields.
+  // Calling the two back to back is equivalent to calling remap(true).
+  // Remappers that cannot split the work do all of it in remap_fwd_begin.
+  void remap_fwd_begin ();
+  void remap_fwd_end ();
+
+  bool is_remap_fwd_pending () const { return m_fwd_pending; }
+
   // Getter methods
   grid_ptr_type get_src_grid () const { return m_src_grid; }
   grid_ptr_type get_tgt_grid () const { return m_tgt_grid; }
@@ -179,6 +189,8 @@ protected:
   void set_grids (const grid_ptr_type& src_grid,
                   const grid_ptr_type& tgt_grid);
 
+  void check_can_remap () const;
+
   virtual const identifier_type& do_get_src_field_id (const int ifield) const = 0;
   virtual const identifier_type& do_get_tgt_field_id (const int ifield) const = 0;
   virtual const field_type& do_get_src_field (const int ifield) const = 0;
@@ -204,6 +216,12 @@ protected:
   // the protected data members of this class.
   virtual void do_remap_fwd () = 0;
 
+  // Override these methods to split the forward remap in two phases (e.g.,
+  // to start communication in the first, and complete it in the second).
+  // By default, the whole forward remap is done in the first phase.
+  virtual void do_remap_fwd_begin () { do_remap_fwd(); }
+  virtual void do_remap_fwd_end () { /* Nothing to do */ }
+
   // Override this method to implement the backward/inverse remapping process
   // using the protected data members of this class.
   virtual void do_remap_bwd () = 0;
@@ -232,6 +250,9 @@ protected:
   bool m_fwd_allowed = true;
   bool m_bwd_allowed = true;
 
+  // Whether remap_fwd_begin was called, but remap_fwd_end was not (yet)
+  bool m_fwd_pending = false;
+
   // The state of the remapper
   RepoState     m_state = RepoState::Clean;
 
@@ -6,6 +6,7 @@
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace scream
@@ -14,10 +15,12 @@ namespace scream
 CoarseningRemapper::
 CoarseningRemapper (const grid_ptr_type& src_grid,
                     const std::string& map_file,
-                    const bool track_mask)
+                    const bool track_mask,
+                    const bool batch_mat_vec)
  : AbstractRemapper()
  , m_comm (src_grid->get_comm())
  , m_track_mask (track_mask)
+ , m_batch_mat_vec (batch_mat_vec)
 {
   using namespace ShortFieldTagsNames;
 
@@ -150,6 +153,9 @@ CoarseningRemapper (const grid_ptr_type& src_grid,
       "  - row_offsets(end): " + std::to_string(row_offsets_h(num_ov_row_gids)) + "\n");
 
   Kokkos::deep_copy(m_row_offsets,row_offsets_h);
+  if (num_ov_row_gids>0) {
+    m_max_row_nnz = *std::max_element(row_counts.begin(),row_counts.end());
+  }
 
   const int nlevs  = src_grid->get_num_vertical_levels();
 
@@ -353,6 +359,7 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
       (this->m_num_bound_fields+1)==this->m_num_registered_fields) {
     create_ov_tgt_fields ();
     setup_mpi_data_structures ();
+    setup_batched_mat_vec ();
   }
 }
 
@@ -361,10 +368,17 @@ void CoarseningRemapper::do_registration_ends ()
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
     create_ov_tgt_fields ();
     setup_mpi_data_structures ();
+    setup_batched_mat_vec ();
   }
 }
 
 void CoarseningRemapper::do_remap_fwd ()
+{
+  do_remap_fwd_begin ();
+  do_remap_fwd_end ();
+}
+
+void CoarseningRemapper::do_remap_fwd_begin ()
 {
   // Fire the recv requests right away, so that if some other ranks
   // is done packing before us, we can start receiving their data
@@ -377,43 +391,56 @@ void CoarseningRemapper::do_remap_fwd ()
 
   // TODO: Add check that if there are mask values they are either 1's or 0's for unmasked/masked.
 
-  // Loop over each field
-  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
-  for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
-    const auto& f_src    = m_src_fields[i];
-    const auto& f_ov_tgt = m_ov_tgt_fields[i];
+  // Rows owned by other ranks come first in the send list. Compute and
+  // send them right away, so other ranks don't have to wait on us.
+  const int num_send_lids = m_ov_tgt_grid->get_num_local_dofs();
+  const int num_remote = m_num_remote_send_lids;
+  compute_ov_tgt_rows (0,num_remote);
+  pack (0,num_remote);
 
-    const int mask_idx = m_field_idx_to_mask_idx[i];
-    if (mask_idx>0) {
-      // Pass the mask to the local_mat_vec routine
-      auto mask = m_src_fields[mask_idx];
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,&mask);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt,&mask);
-      }
-    } else {
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt);
-      }
-    }
+  // If MPI does not use dev pointers, we need to deep copy from dev to host.
+  // Otherwise, we need to make sure packing is done before MPI reads the buffer.
+  const int buf_size = m_send_buffer.size();
+  if (not MpiOnDev) {
+    using range_t = Kokkos::pair<int,int>;
+    Kokkos::deep_copy (Kokkos::subview(m_mpi_send_buffer,range_t(0,m_send_self_beg)),
+                       Kokkos::subview(m_send_buffer,range_t(0,m_send_self_beg)));
+    Kokkos::deep_copy (Kokkos::subview(m_mpi_send_buffer,range_t(m_send_self_end,buf_size)),
+                       Kokkos::subview(m_send_buffer,range_t(m_send_self_end,buf_size)));
+  } else {
+    Kokkos::fence();
+  }
+
+  if (m_num_remote_send_req>0) {
+    int ierr = MPI_Startall(m_num_remote_send_req,m_send_req.data());
+    EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
+        "Error! Something whent wrong while starting persistent send requests.\n"
+        "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
+  }
+
+  // Now take care of the rows that this rank owns
+  compute_ov_tgt_rows (num_remote,num_send_lids);
+  pack (num_remote,num_send_lids);
+
+  if (not MpiOnDev) {
+    using range_t = Kokkos::pair<int,int>;
+    Kokkos::deep_copy (Kokkos::subview(m_mpi_send_buffer,range_t(m_send_self_beg,m_send_self_end)),
+                       Kokkos::subview(m_send_buffer,range_t(m_send_self_beg,m_send_self_end)));
+  } else {
+    Kokkos::fence();
   }
 
-  // Pack, then fire off the sends
-  pack_and_send ();
+  const int num_send_req = m_send_req.size();
+  if (num_send_req>m_num_remote_send_req) {
+    int ierr = MPI_Start(&m_send_req.back());
+    EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
+        "Error! Something whent wrong while starting persistent send requests.\n"
+        "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
+  }
+}
 
+void CoarseningRemapper::do_remap_fwd_end ()
+{
   // Wait for all data to be received, then unpack
   recv_and_unpack ();
 
@@ -426,6 +453,7 @@ void CoarseningRemapper::do_remap_fwd ()
   }
 
   // Rescale any fields that had the mask applied.
+  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
   if (m_track_mask) {
     for (int i=0; i<m_num_fields; ++i) {
       const auto& f_tgt = m_tgt_fields[i];
@@ -444,6 +472,53 @@ void CoarseningRemapper::do_remap_fwd ()
   }
 }
 
+void CoarseningRemapper::
+compute_ov_tgt_rows (const int beg, const int end) const
+{
+  // First, all the fields that can be batched together
+  if (m_batch_mat_vec && m_batch_col_size>0) {
+    batched_mat_vec (beg,end);
+  }
+
+  // Then, loop over each of the remaining fields
+  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
+  for (int i=0; i<m_num_fields; ++i) {
+    if (m_batch_mat_vec && m_field_is_batched[i]) {
+      continue;
+    }
+
+    // Perform the local mat-vec. Recall that in these y=Ax products,
+    // x is the src field, and y is the overlapped tgt field.
+    const auto& f_src    = m_src_fields[i];
+    const auto& f_ov_tgt = m_ov_tgt_fields[i];
+
+    const int mask_idx = m_field_idx_to_mask_idx.at(i);
+    if (mask_idx>0) {
+      // Pass the mask to the local_mat_vec routine
+      auto mask = m_src_fields[mask_idx];
+      // Dispatch kernel with the largest possible pack size
+      const auto& src_ap = f_src.get_header().get_alloc_properties();
+      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
+      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
+                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
+        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,beg,end,&mask);
+      } else {
+        local_mat_vec<1>(f_src,f_ov_tgt,beg,end,&mask);
+      }
+    } else {
+      // Dispatch kernel with the largest possible pack size
+      const auto& src_ap = f_src.get_header().get_alloc_properties();
+      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
+      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
+                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
+        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,beg,end);
+      } else {
+        local_mat_vec<1>(f_src,f_ov_tgt,beg,end);
+      }
+    }
+  }
+}
+
 template<int PackSize>
 void CoarseningRemapper::
 rescale_masked_fields (const Field& x, const Field& mask) const
@@ -536,7 +611,8 @@ rescale_masked_fields (const Field& x, const Field& mask) const
 
 template<int PackSize>
 void CoarseningRemapper::
-local_mat_vec (const Field& x, const Field& y, const Field* mask) const
+local_mat_vec (const Field& x, const Field& y,
+               const int beg_lid, const int end_lid, const Field* mask) const
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
@@ -546,7 +622,8 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
 
   const auto& src_layout = x.get_header().get_identifier().get_layout();
   const int rank = src_layout.rank();
-  const int nrows = m_ov_tgt_grid->get_num_local_dofs();
+  const int nrows = end_lid - beg_lid;
+  auto lids_pids = m_send_lids_pids;
   auto row_offsets = m_row_offsets;
   auto col_lids = m_col_lids;
   auto weights = m_weights;
@@ -554,6 +631,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
     // Note: in each case, handle 1st contribution to each row separately,
     //       using = instead of +=. This allows to avoid doing an extra
     //       loop to zero out y before the mat-vec.
+    // Note: rows are processed in the order of the send lids list.
     case 1:
     {
       auto x_view = x.get_view<const Real*>();
@@ -562,8 +640,9 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       if (mask != nullptr) {
         mask_view = mask->get_view<Real*>();
       }
-      Kokkos::parallel_for(RangePolicy(0,nrows),
-                           KOKKOS_LAMBDA(const int& row) {
+      Kokkos::parallel_for(RangePolicy(beg_lid,end_lid),
+                           KOKKOS_LAMBDA(const int& i) {
+        const auto row = lids_pids(i,0);
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
         if (mask != nullptr) {
@@ -592,7 +671,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = lids_pids(beg_lid+team.league_rank(),0);
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -627,7 +706,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = lids_pids(beg_lid+team.league_rank(),0);
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -657,13 +736,72 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
   }
 }
 
-void CoarseningRemapper::pack_and_send ()
+void CoarseningRemapper::
+batched_mat_vec (const int beg_lid, const int end_lid) const
+{
+  using MemberType   = typename KT::MemberType;
+  using ESU          = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using ScratchSpace = typename KT::ExeSpace::scratch_memory_space;
+  using ScratchInts  = Kokkos::View<int*, ScratchSpace,Kokkos::MemoryUnmanaged>;
+  using ScratchReals = Kokkos::View<Real*,ScratchSpace,Kokkos::MemoryUnmanaged>;
+
+  const int nrows = end_lid - beg_lid;
+  const int col_size = m_batch_col_size;
+  const int max_nnz = m_max_row_nnz;
+  auto lids_pids = m_send_lids_pids;
+  auto row_offsets = m_row_offsets;
+  auto col_lids = m_col_lids;
+  auto weights = m_weights;
+  auto entries = m_batch_entries;
+
+  // Each team stores the col lids and weights of its row in scratch memory,
+  // and then processes all the entries of all the batched fields.
+  const size_t scratch_size = ScratchInts::shmem_size(max_nnz) +
+                              ScratchReals::shmem_size(max_nnz);
+  auto policy = ESU::get_default_team_policy(nrows,col_size);
+  policy.set_scratch_size(0,Kokkos::PerTeam(scratch_size));
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const auto row = lids_pids(beg_lid+team.league_rank(),0);
+    const auto beg = row_offsets(row);
+    const auto nnz = row_offsets(row+1) - beg;
+
+    ScratchInts  cols (team.team_scratch(0),max_nnz);
+    ScratchReals w    (team.team_scratch(0),max_nnz);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nnz),
+                        [&](const int k){
+      cols(k) = col_lids(beg+k);
+      w(k)    = weights(beg+k);
+    });
+    team.team_barrier();
+
+    // Note: as in local_mat_vec, handle 1st contribution to each row separately
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,col_size),
+                        [&](const int idx){
+      int ifield = 0;
+      while (idx>=entries(ifield).end) {
+        ++ifield;
+      }
+      const auto& e = entries(ifield);
+      const int stride = e.end - e.beg;
+      const int j = idx - e.beg;
+
+      Real y = w(0)*e.src[cols(0)*stride+j];
+      for (int icol=1; icol<nnz; ++icol) {
+        y += w(icol)*e.src[cols(icol)*stride+j];
+      }
+      e.ov_tgt[row*stride+j] = y;
+    });
+  });
+}
+
+void CoarseningRemapper::pack (const int beg, const int end)
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
-  const int num_send_gids = m_ov_tgt_grid->get_num_local_dofs();
+  const int num_send_gids = end - beg;
   const auto pid_lid_start = m_send_pid_lids_start;
   const auto lids_pids = m_send_lids_pids;
   const auto buf = m_send_buffer;
@@ -678,7 +816,7 @@ void CoarseningRemapper::pack_and_send ()
       case LayoutType::Scalar2D:
       {
         auto v = f.get_view<const Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_send_gids),
+        Kokkos::parallel_for(RangePolicy(beg,end),
                              KOKKOS_LAMBDA(const int& i){
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
@@ -695,7 +833,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,ndims);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -714,7 +852,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,nlevs);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -734,7 +872,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,ndims*nlevs);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -756,17 +894,6 @@ void CoarseningRemapper::pack_and_send ()
     }
   }
 
-  // If MPI does not use dev pointers, we need to deep copy from dev to host
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
-  }
-
-  if (not m_send_req.empty()) {
-    int ierr = MPI_Startall(m_send_req.size(),m_send_req.data());
-    EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
-        "Error! Something whent wrong while starting persistent send requests.\n"
-        "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
-  }
 }
 
 void CoarseningRemapper::recv_and_unpack ()
@@ -1124,7 +1251,9 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   const auto ov_gids = m_ov_tgt_grid->get_dofs_gids().get_view<const gid_t*,Host>();
   auto gids_owners = m_tgt_grid->get_owners (ov_gids);
 
-  // 2. Group dofs to send by remote pid
+  // 2. Group dofs to send by remote pid. Dofs that stay on this
+  //    rank are stored last, so that remote ones can be sent first
+  const int my_pid = m_comm.rank();
   const int num_ov_gids = ov_gids.size();
   std::map<int,std::vector<int>> pid2lids_send;
   std::map<int,std::vector<gid_t>> pid2gids_send;
@@ -1138,13 +1267,21 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   m_send_pid_lids_start = view_1d<int>("",m_comm.size());
   auto send_lids_pids_h = Kokkos::create_mirror_view(m_send_lids_pids);
   auto send_pid_lids_start_h = Kokkos::create_mirror_view(m_send_pid_lids_start);
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    send_pid_lids_start_h(pid) = pos;
+  int send_pos = 0;
+  auto add_pid_lids = [&](const int pid) {
+    send_pid_lids_start_h(pid) = send_pos;
     for (auto lid : pid2lids_send[pid]) {
-      send_lids_pids_h(pos,0) = lid;
-      send_lids_pids_h(pos++,1) = pid;
+      send_lids_pids_h(send_pos,0) = lid;
+      send_lids_pids_h(send_pos++,1) = pid;
+    }
+  };
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    if (pid!=my_pid) {
+      add_pid_lids(pid);
     }
   }
+  m_num_remote_send_lids = send_pos;
+  add_pid_lids(my_pid);
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
@@ -1166,27 +1303,35 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     }
   }
   Kokkos::deep_copy (m_send_f_pid_offsets,send_f_pid_offsets_h);
+  m_send_self_beg = send_pid_offsets[my_pid];
+  m_send_self_end = m_send_self_beg + pid2lids_send[my_pid].size()*sum_fields_col_sizes;
 
   // 4. Allocate send buffers
   m_send_buffer = view_1d<Real>("",sum_fields_col_sizes*num_ov_gids);
   m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
 
-  // 5. Setup send requests
+  // 5. Setup send requests, with the one to this rank (if any) last
   m_send_req.reserve(num_send_pids);
-  for (const auto& it : pid2lids_send) {
-    const int n = it.second.size()*sum_fields_col_sizes;
+  auto add_send_req = [&](const int pid) {
+    const int n = pid2lids_send[pid].size()*sum_fields_col_sizes;
     if (n==0) {
-      continue;
+      return;
     }
 
-    const int pid = it.first;
     const auto send_ptr = m_mpi_send_buffer.data() + send_pid_offsets[pid];
 
     m_send_req.emplace_back();
     auto& req = m_send_req.back();
     MPI_Send_init (send_ptr, n, mpi_real, pid,
                    0, mpi_comm, &req);
+  };
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    if (pid!=my_pid) {
+      add_send_req(pid);
+    }
   }
+  m_num_remote_send_req = m_send_req.size();
+  add_send_req(my_pid);
 
   // --------------------------------------------------------- //
   //                   Setup RECV structures                   //
@@ -1286,6 +1431,53 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   }
 }
 
+void CoarseningRemapper::setup_batched_mat_vec ()
+{
+  // A field can be batched if we can address its data with a raw pointer,
+  // and if each column has the same (padded) size in src and ov_tgt.
+  // Masked fields need the mask in the mat-vec, so they are not batched.
+  auto col_stride = [](const Field& f) {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto& ap = f.get_header().get_alloc_properties();
+    int stride = 1;
+    for (int i=1; i<fl.rank()-1; ++i) {
+      stride *= fl.dim(i);
+    }
+    return fl.rank()>1 ? stride*ap.get_last_extent() : 1;
+  };
+
+  std::vector<MatVecBatchEntry> entries;
+  m_field_is_batched.assign(m_num_fields,0);
+  m_batch_col_size = 0;
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& f_src    = m_src_fields[i];
+    const auto& f_ov_tgt = m_ov_tgt_fields[i];
+    const auto& src_ap = f_src.get_header().get_alloc_properties();
+    if (m_field_idx_to_mask_idx[i]>0 || src_ap.is_subfield() || not src_ap.contiguous()) {
+      continue;
+    }
+    const int stride = col_stride(f_src);
+    if (stride!=col_stride(f_ov_tgt)) {
+      continue;
+    }
+
+    MatVecBatchEntry e;
+    e.src    = f_src.get_internal_view_data<const Real>();
+    e.ov_tgt = f_ov_tgt.get_internal_view_data<Real>();
+    e.beg    = m_batch_col_size;
+    e.end    = m_batch_col_size + stride;
+    entries.push_back(e);
+
+    m_batch_col_size += stride;
+    m_field_is_batched[i] = 1;
+  }
+
+  m_batch_entries = view_1d<MatVecBatchEntry>("",entries.size());
+  auto entries_h = Kokkos::create_mirror_view(m_batch_entries);
+  std::copy(entries.begin(),entries.end(),entries_h.data());
+  Kokkos::deep_copy(m_batch_entries,entries_h);
+}
+
 void CoarseningRemapper::clean_up ()
 {
   // Clear all MPI related structures
@@ -1297,11 +1489,20 @@ void CoarseningRemapper::clean_up ()
   m_recv_f_pid_offsets  = view_2d<int>();
   m_send_lids_pids      = view_2d<int>();
   m_send_pid_lids_start = view_1d<int>();
+  m_num_remote_send_lids = 0;
+  m_send_self_beg       = 0;
+  m_send_self_end       = 0;
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
   m_send_req.clear();
   m_recv_req.clear();
+  m_num_remote_send_req = 0;
+
+  // Clear batched mat-vec structures
+  m_batch_entries = view_1d<MatVecBatchEntry>();
+  m_batch_col_size = 0;
+  m_field_is_batched.clear();
 
   // Clear all fields
   m_src_fields.clear();
@@ -31,6 +31,18 @@ namespace scream
  *   2. Perform a pack-send-recv-unpack sequence via MPI, to accumulate
  *      partial results on the rank that owns the dof in the tgt grid.
  *
+ * The forward remap can also be split in two phases (see remap_fwd_begin
+ * and remap_fwd_end in AbstractRemapper). In the first phase, the rows
+ * that are owned by remote ranks are computed, packed, and sent first,
+ * and only then the rows that this rank owns. The second phase waits
+ * for all the data, and unpacks it. Work done by the caller between the
+ * two phases overlaps with the communication.
+ *
+ * Fields that allow it (i.e., unmasked fields that are not subfields) are
+ * processed together in the local mat-vec: each row of the matrix is loaded
+ * once in team scratch memory, and applied to all the batched fields.
+ * Batching can be disabled at construction time (batch_mat_vec=false).
+ *
  * The class has to create temporaries for the intermediate fields.
  * An obvious future development would be to use some scratch memory
  * for these fields, so to not increase memory pressure.
@@ -49,7 +61,8 @@ public:
 
   CoarseningRemapper (const grid_ptr_type& src_grid,
                       const std::string& map_file,
-                      const bool track_mask = false);
+                      const bool track_mask = false,
+                      const bool batch_mat_vec = true);
 
   ~CoarseningRemapper ();
 
@@ -97,6 +110,8 @@ protected:
   void do_registration_ends () override;
 
   void do_remap_fwd () override;
+  void do_remap_fwd_begin () override;
+  void do_remap_fwd_end () override;
 
   void do_remap_bwd () override {
     EKAT_ERROR_MSG ("CoarseningRemapper only supports fwd remapping.\n");
@@ -117,6 +132,7 @@ protected:
 
   void create_ov_tgt_fields ();
   void setup_mpi_data_structures ();
+  void setup_batched_mat_vec ();
 
   int gid2lid (const gid_t gid, const grid_ptr_type& grid) const {
     const auto gids = grid->get_dofs_gids().get_view<const gid_t*,Host>();
@@ -143,11 +159,15 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // Mat-vec, pack, and send only act on the entries [beg,end) of the send lids list
   template<int N>
-  void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field* mask = nullptr) const;
+  void local_mat_vec (const Field& f_src, const Field& f_tgt,
+                      const int beg, const int end, const Field* mask = nullptr) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
-  void pack_and_send ();
+  void batched_mat_vec (const int beg, const int end) const;
+  void compute_ov_tgt_rows (const int beg, const int end) const;
+  void pack (const int beg, const int end);
   void recv_and_unpack ();
 
 protected:
@@ -182,6 +202,28 @@ protected:
   view_1d<int>    m_row_offsets;
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
+  int             m_max_row_nnz = 0;
+
+  // ------- Batched mat-vec data -------- //
+
+  // Raw pointers to the src/ov_tgt data of a batched field, and the range
+  // [beg,end) of this field within a column of all the batched fields.
+  // Note: end-beg is the (padded) number of scalars per column of the field.
+  struct MatVecBatchEntry {
+    const Real* src;
+    Real*       ov_tgt;
+    int         beg;
+    int         end;
+  };
+
+  // Whether to use the batched mat-vec at all (if false, all fields
+  // are processed one at a time)
+  bool                          m_batch_mat_vec;
+  view_1d<MatVecBatchEntry>     m_batch_entries;
+  int                           m_batch_col_size = 0;
+
+  // For each field, whether it is part of the batch
+  std::vector<int>              m_field_is_batched;
 
   // ------- MPI data structures -------- //
 
@@ -201,7 +243,8 @@ protected:
   view_2d<int>          m_recv_f_pid_offsets;
 
   // Reorder the lids so that all lids to send to PID n
-  // come before those for PID N+1. The meaning is
+  // come before those for PID N+1, except for the lids that
+  // stay on this rank, which come last. The meaning is
   //   lids_pids(i,0) = ith lid to send to PID=lids_pids(i,1)
   // Note: send lids are the lids of gids in the ov_tgt_grid.
   //       But here, dofs are ordered differently, so that all dofs to
@@ -211,6 +254,13 @@ protected:
   // Store the start of lids to send to each PID in the view above
   view_1d<int>          m_send_pid_lids_start;
 
+  // Number of entries in m_send_lids_pids that go to remote PIDs
+  // (they are the first ones), and the range [beg,end) of the send
+  // buffer that is reserved for the data this rank sends to itself.
+  int                   m_num_remote_send_lids = 0;
+  int                   m_send_self_beg = 0;
+  int                   m_send_self_end = 0;
+
   // Unlike the packing for sends, unpacking after the recv can cause
   // race conditions. Hence, we ||ize of tgt lids, and process separate
   // contributions from separate PIDs serially. To do so, we use the
@@ -228,9 +278,10 @@ protected:
   view_1d<int>          m_recv_lids_beg;
   view_1d<int>          m_recv_lids_end;
 
-  // Send/recv requests
+  // Send/recv requests. The send request to this rank (if any) is the last one.
   std::vector<MPI_Request>  m_recv_req;
   std::vector<MPI_Request>  m_send_req;
+  int                       m_num_remote_send_req = 0;
 };
 
 } // namespace scream
@@ -2,6 +2,7 @@
 
 #include "share/grid/point_grid.hpp"
 #include "share/util/scream_vertical_interpolation.hpp"
+#include "share/util/scream_vertical_interp_cache.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/field/field_tag.hpp"
 #include "share/field/field_identifier.hpp"
@@ -167,6 +168,10 @@ set_pressure_levels(const std::string& map_file) {
   scorpio::grid_read_data_array(map_file,"p_levs",-1,remap_pres_scal.data(),remap_pres_scal.size());
   scorpio::eam_pio_closefile(map_file);
 
+  // Keep a host copy of the levels, used as key to retrieve interpolation stencils
+  auto remap_pres_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),remap_pres_scal);
+  m_remap_pres_levs.assign(remap_pres_h.data(),remap_pres_h.data()+m_num_remap_levs);
+
 }
 
 void VerticalRemapper::
@@ -271,11 +276,10 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
       }
     }
     if (!found) {
-      // We have to create this mask field and add it to the map so we can assign it to this tgt field as an extra data
+      // We have to create this mask field and add it to the map so we can assign it to this tgt field as an extra data.
+      // Note: the tgt mask is computed from the interpolation stencil, so the src mask is never allocated.
       FieldIdentifier mask_src_fid (lname, src_lay, nondim, m_src_grid->name() );
       Field           mask_src_fld (mask_src_fid);
-      mask_src_fld.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
-      mask_src_fld.allocate_view();
       const auto& tgt_lay = create_tgt_layout(src_lay);
       FieldIdentifier mask_tgt_fid (lname, tgt_lay, nondim, m_tgt_grid->name() );
       Field           mask_tgt_fld (mask_tgt_fid);
@@ -366,19 +370,14 @@ void VerticalRemapper::do_remap_fwd ()
     const auto  src_tag  = layout.tags().back();
     const bool  do_remap = ekat::contains(std::vector<FieldTag>{ILEV,LEV},src_tag);
     if (do_remap) {
-      // If we are remapping then we need to initialize the mask source values to 1.0
-      f_src.deep_copy(1.0);
+      // The mask is 1 where the stencil interpolates, and 0 where it masks,
+      // so there is no need to interpolate a field of ones.
       // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
       const auto& tgt_ap = f_tgt.get_header().get_alloc_properties();
-      const auto& src_pres_ap = src_tag == LEV ? m_src_mid.get_header().get_alloc_properties() : m_src_int.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      src_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        apply_vertical_interpolation<SCREAM_PACK_SIZE>(f_src,f_tgt,true); 
+      if (can_pack && tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
+        compute_vertical_mask<SCREAM_PACK_SIZE>(f_src,f_tgt);
       } else {
-        apply_vertical_interpolation<1>(f_src,f_tgt,true); 
+        compute_vertical_mask<1>(f_src,f_tgt);
       }
     } else {
       // There is nothing to do, this field cannot be vertically interpolated,
@@ -390,7 +389,7 @@ void VerticalRemapper::do_remap_fwd ()
 
 template<int Packsize>
 void VerticalRemapper::
-apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool mask_interp) const
+apply_vertical_interpolation(const Field& f_src, const Field& f_tgt) const
 {
     
     using Pack = ekat::Pack<Real,Packsize>;
@@ -400,8 +399,7 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool
     const auto  rank   = f_src.rank();
     const auto src_tag = layout.tags().back();
     const auto src_num_levs = layout.dims().back();
-    // ARG mask_interp checks if this is a vertical interpolation of the mask array that tracks masked 0.0 or not 1.0
-    Real mask_val = mask_interp ? 0.0 : m_mask_val;
+    const Real mask_val = m_mask_val;
 
     Field    src_lev_f;
     if (src_tag == ILEV) {
@@ -409,21 +407,23 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool
     } else {
       src_lev_f = m_src_mid;
     }
-    auto src_lev  = src_lev_f.get_view<const Pack**>();
-    auto remap_pres_view = m_remap_pres.get_view<Pack*>();
+    // All fields on the same source levels share the same stencil,
+    // which is only recomputed when the source levels change.
+    const auto& stencil = VerticalInterpCache::instance().get_stencil(src_lev_f,m_remap_pres_levs);
+    EKAT_REQUIRE (stencil.nlevs_src==src_num_levs);
     switch(rank) {
       case 2:
       {
         auto src_view = f_src.get_view<const Pack**>();
         auto tgt_view = f_tgt.get_view<      Pack**>();
-        perform_vertical_interpolation<Real,Packsize,2>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+        apply_interp_stencil<Real,Packsize>(stencil,src_view,tgt_view,mask_val);
         break;
       }
       case 3:
       {
         auto src_view = f_src.get_view<const Pack***>();
         auto tgt_view = f_tgt.get_view<      Pack***>();
-        perform_vertical_interpolation<Real,Packsize,3>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+        apply_interp_stencil<Real,Packsize>(stencil,src_view,tgt_view,mask_val);
         break;
       }
       default:
@@ -432,4 +432,23 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool
 
 }
 
+template<int Packsize>
+void VerticalRemapper::
+compute_vertical_mask(const Field& mask_src, const Field& mask_tgt) const
+{
+    using Pack = ekat::Pack<Real,Packsize>;
+    using namespace ShortFieldTagsNames;
+    using namespace scream::vinterp;
+    const auto& layout = mask_src.get_header().get_identifier().get_layout();
+    const auto src_tag = layout.tags().back();
+    const auto src_num_levs = layout.dims().back();
+
+    // Masks are (COL,LEV) or (COL,ILEV), and use the same stencil of the fields they track
+    EKAT_REQUIRE (mask_tgt.rank()==2);
+    const Field& src_lev_f = src_tag==ILEV ? m_src_int : m_src_mid;
+    const auto& stencil = VerticalInterpCache::instance().get_stencil(src_lev_f,m_remap_pres_levs);
+    EKAT_REQUIRE (stencil.nlevs_src==src_num_levs);
+    compute_stencil_mask<Real,Packsize>(stencil,mask_tgt.get_view<Pack**>());
+}
+
 } // namespace scream
@@ -106,7 +106,9 @@ protected:
 public:
 #endif
   template<int N>
-  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt, const bool mask_interp=false) const;
+  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt) const;
+  template<int N>
+  void compute_vertical_mask (const Field& mask_src, const Field& mask_tgt) const;
 protected:
 
   using KT = KokkosTypes<DefaultDevice>;
@@ -134,6 +136,7 @@ protected:
   int                   m_num_remap_levs;
   Real                  m_mask_val;
   Field                 m_remap_pres;
+  std::vector<Real>     m_remap_pres_levs;  // Host copy of m_remap_pres
   Field                 m_src_mid;  // Src vertical profile for LEV layouts
   Field                 m_src_int;  // Src vertical profile for ILEV layouts
   bool                  m_mid_set = false;
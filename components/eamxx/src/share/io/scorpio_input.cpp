@@ -191,7 +191,7 @@ void AtmosphereInput::read_variables (const int time_index)
 
     // Read the data
     auto v1d = m_host_views_1d.at(name);
-    scorpio::grid_read_data_array(m_filename,name,time_index,v1d.data(),v1d.size());
+    scorpio::grid_read_data_array(m_var_handles.at(name),time_index,v1d.data(),v1d.size());
 
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
@@ -331,6 +331,7 @@ void AtmosphereInput::finalize()
 
   m_host_views_1d.clear();
   m_layouts.clear();
+  m_var_handles.clear();
 
   m_inited_with_views = false;
   m_inited_with_fields = false;
@@ -372,8 +373,8 @@ void AtmosphereInput::register_variables()
     //  Currently the field_manager only stores Real variables so it is not an issue,
     //  but in the future if non-Real variables are added we will want to accomodate that.
     //TODO: Should be able to simply inquire from the netCDF the dimensions for each variable.
-    scorpio::get_variable(m_filename, name, name,
-                          vec_of_dims, fp_precision, io_decomp_tag);
+    m_var_handles[name] = scorpio::get_variable(m_filename, name, name,
+                                                vec_of_dims, fp_precision, io_decomp_tag);
   }
 }
 
@@ -424,8 +425,13 @@ void AtmosphereInput::set_degrees_of_freedom()
 {
   // For each field, tell PIO the offset of each DOF to be read.
   // Here, offset is meant in the *global* array in the nc file.
+  // If the decomposition was already created (e.g., by a previous input or output
+  // file), scorpio reuses it, and needs no offsets.
   for (auto const& name : m_fields_names) {
-    auto var_dof = get_var_dof_offsets(m_layouts.at(name));
+    std::vector<scorpio::offset_t> var_dof;
+    if (not scorpio::is_decomp_set(m_filename,name)) {
+      var_dof = get_var_dof_offsets(m_layouts.at(name));
+    }
     scorpio::set_dof(m_filename,name,var_dof.size(),var_dof.data());
   }
 } // set_degrees_of_freedom
@@ -126,6 +126,7 @@ protected:
 
   std::map<std::string, view_1d_host>   m_host_views_1d;
   std::map<std::string, FieldLayout>    m_layouts;
+  std::map<std::string, int>            m_var_handles;
   
   std::string               m_filename;
   std::vector<std::string>  m_fields_names;
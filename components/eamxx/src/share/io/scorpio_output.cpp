@@ -1,5 +1,6 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/util/scream_array_utils.hpp"
 #include "share/grid/remap/coarsening_remapper.hpp"
 #include "share/grid/remap/vertical_remapper.hpp"
@@ -57,6 +58,7 @@ AtmosphereOutput (const ekat::Comm& comm,
   // This version of AtmosphereOutput is for quick output of fields
   m_avg_type = OutputAvgType::Instant;
   m_add_time_dim = false;
+  m_async_write = false;
 
   // Create a FieldManager with the input fields
   auto fm = std::make_shared<FieldManager> (grid);
@@ -101,6 +103,12 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
       "Error! Unsupported averaging type '" + avg_type + "'.\n"
       "       Valid options: Instant, Max, Min, Average. Case insensitive.\n");
 
+  // If requested, writes are performed by the async IO worker, from a separate set of host buffers
+  m_async_write = params.get("Asynchronous Write",false);
+
+  // If requested, update all running tallies with a single kernel, rather than one per field
+  m_fused_accumulation = params.get("Fused Accumulation",false);
+
   // Set all internal field managers to the simulation field manager to start with.  If
   // vertical remapping, horizontal remapping or both are used then those remapper will
   // set things accordingly.
@@ -218,7 +226,8 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     if (use_horiz_remap_from_file) {
       // Construct the coarsening remapper
       auto horiz_remap_file   = params.get<std::string>("horiz_remap_file");
-      m_horiz_remapper = std::make_shared<CoarseningRemapper>(io_grid,horiz_remap_file,true);
+      auto batch_mat_vec      = params.get<bool>("horiz_remap_batch_mat_vec",true);
+      m_horiz_remapper = std::make_shared<CoarseningRemapper>(io_grid,horiz_remap_file,true,batch_mat_vec);
       io_grid = m_horiz_remapper->get_tgt_grid();
       set_grid(io_grid);
     } else {
@@ -292,10 +301,22 @@ void AtmosphereOutput::init()
 } // init
 /*-----*/
 void AtmosphereOutput::
-run (const std::string& filename,
-     const bool is_write_step,
-     const int nsteps_since_last_output,
-     const bool allow_invalid_fields)
+update_time_stamps (const std::shared_ptr<remapper_type>& remapper)
+{
+  for (int i=0; i<remapper->get_num_fields(); ++i) {
+    // Need to update the time stamp of the fields on the IO grid,
+    // to avoid throwing an exception later
+    auto src = remapper->get_src_field(i);
+    auto tgt = remapper->get_tgt_field(i);
+
+    auto src_t = src.get_header().get_tracking().get_time_stamp();
+    tgt.get_header().get_tracking().update_time_stamp(src_t);
+  }
+}
+/*-----*/
+void AtmosphereOutput::
+begin_run (const bool is_write_step,
+           const bool allow_invalid_fields)
 {
   // If we do INSTANT output, but this is not an write step,
   // we can immediately return
@@ -303,8 +324,6 @@ run (const std::string& filename,
     return;
   }
 
-  using namespace scream::scorpio;
-
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
   // First we reset the diag computed map so that all diags are recomputed.
@@ -313,31 +332,57 @@ run (const std::string& filename,
     compute_diagnostic(it.first,allow_invalid_fields);
   }
 
-  auto apply_remap = [&](const std::shared_ptr<AbstractRemapper> remapper)
-  {
-    remapper->remap(true);
-
-    for (int i=0; i<remapper->get_num_fields(); ++i) {
-      // Need to update the time stamp of the fields on the IO grid,
-      // to avoid throwing an exception later
-      auto src = remapper->get_src_field(i);
-      auto tgt = remapper->get_tgt_field(i);
-
-      auto src_t = src.get_header().get_tracking().get_time_stamp();
-      tgt.get_header().get_tracking().update_time_stamp(src_t);
-    }
-  }; // end apply_remap
-
   // If needed, remap fields from their grid to the unique grid, for I/O
   if (m_vert_remapper) {
     start_timer("EAMxx::IO::vert_remap");
-    apply_remap(m_vert_remapper);
+    m_vert_remapper->remap(true);
+    update_time_stamps(m_vert_remapper);
     stop_timer("EAMxx::IO::vert_remap");
   }
 
+  // Only start the horizontal remap: it is completed in run, so that whatever
+  // the caller does in between (e.g., starting the remap of other streams, or
+  // setting up the output files) overlaps with the communication.
   if (m_horiz_remapper) {
     start_timer("EAMxx::IO::horiz_remap");
-    apply_remap(m_horiz_remapper);
+    m_horiz_remapper->remap_fwd_begin();
+    stop_timer("EAMxx::IO::horiz_remap");
+  }
+
+  m_run_begun = true;
+}
+/*-----*/
+void AtmosphereOutput::
+run (const std::string& filename,
+     const bool is_write_step,
+     const int nsteps_since_last_output,
+     const bool allow_invalid_fields)
+{
+  // If we do INSTANT output, but this is not an write step,
+  // we can immediately return
+  if (not is_write_step and m_avg_type==OutputAvgType::Instant) {
+    return;
+  }
+
+  using namespace scream::scorpio;
+
+  // If the caller did not start this step, do it now
+  if (not m_run_begun) {
+    begin_run(is_write_step,allow_invalid_fields);
+  }
+  m_run_begun = false;
+
+  // In async mode, the current set of staging buffers was last read by the write issued
+  // two write steps ago, which may still be in flight. Make sure it is over before we
+  // overwrite them. The previous write (on the other set) can keep going.
+  if (is_write_step and m_async_write) {
+    AsyncIOWorker::instance().wait(m_async_tickets[m_async_buf]);
+  }
+
+  if (m_horiz_remapper) {
+    start_timer("EAMxx::IO::horiz_remap");
+    m_horiz_remapper->remap_fwd_end();
+    update_time_stamps(m_horiz_remapper);
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
@@ -345,9 +390,6 @@ run (const std::string& filename,
   for (auto const& name : m_fields_names) {
     // Get all the info for this field.
           auto  field = get_field(name,"io");
-    const auto& layout = m_layouts.at(name);
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
 
     if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
       // Safety check: make sure that the user is ok with this
@@ -359,111 +401,207 @@ run (const std::string& filename,
       }
     }
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
-
     // Manually update the 'running-tally' views with data from the field,
     // by combining new data with current avg values.
     // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
+    if (not m_fused_accumulation and not is_aliasing_field_view(name)) {
+      accumulate_field(name);
+    }
+  }
+
+  if (m_fused_accumulation) {
+    accumulate_fields();
+  }
+
+  if (not is_write_step) {
+    return;
+  }
+
+  const auto& var_handles = m_var_handles.at(filename);
+  auto& host_views = m_async_write ? m_async_host_views_1d[m_async_buf] : m_host_views_1d;
+  for (auto const& name : m_fields_names) {
+    const auto& layout = m_layouts.at(name);
     auto view_dev = m_dev_views_1d.at(name);
     auto data = view_dev.data();
     KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
-
     auto avg_type = m_avg_type;
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            combine(new_view_1d(i), avg_view_1d(i),avg_type);
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
-      }
-    }
 
-    if (is_write_step) {
-      if (avg_type==OutputAvgType::Average) {
-        // Divide by steps count only when the summation is complete
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-          data[i] /= nsteps_since_last_output;
-        });
-      }
-      // Bring data to host
-      auto view_host = m_host_views_1d.at(name);
+    if (avg_type==OutputAvgType::Average) {
+      // Divide by steps count only when the summation is complete
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        data[i] /= nsteps_since_last_output;
+      });
+    }
+    // Bring data to host
+    auto view_host = host_views.at(name);
+    if (m_async_write) {
+      // Only stage the data: the copy is asynchronous w.r.t. the host,
+      // and we will fence once, after all fields have been staged.
+      Kokkos::deep_copy (KT::ExeSpace(),view_host,view_dev);
+    } else {
       Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+      grid_write_data_array(var_handles.at(name),view_host.data(),view_host.size());
     }
   }
+
+  if (m_async_write) {
+    Kokkos::fence();
+
+    // Hand the staged buffers to the IO worker. Capture everything by value,
+    // since this stream may be modified (or destroyed) before the task runs.
+    std::vector<std::pair<int,view_1d_host>> staged;
+    for (auto const& name : m_fields_names) {
+      staged.emplace_back(var_handles.at(name),host_views.at(name));
+    }
+    m_async_tickets[m_async_buf] = AsyncIOWorker::instance().enqueue([staged]() {
+      for (const auto& it : staged) {
+        grid_write_data_array(it.first,it.second.data(),it.second.size());
+      }
+    });
+
+    // Next write step stages into the other set
+    m_async_buf = 1 - m_async_buf;
+  }
 } // run
+/* ---------------------------------------------------------- */
+bool AtmosphereOutput::
+is_aliasing_field_view (const std::string& name) const
+{
+  // See register_views for the conditions under which we can alias the field view
+  const auto field = get_field(name,"io");
+  const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
+  return m_avg_type==OutputAvgType::Instant &&
+         field.get_header().get_alloc_properties().get_padding()==0 &&
+         field.get_header().get_parent().expired() &&
+         not is_diagnostic;
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
+accumulate_fields ()
+{
+  if (m_accum_size==0) {
+    return;
+  }
+
+  // Launch over the concatenation of all fields. Each thread finds the field it
+  // belongs to with a binary search on the offsets, which is cheap compared to the
+  // cost of one kernel launch per field.
+  const auto table    = m_accum_table;
+  const int  nentries = table.extent(0);
+  const auto avg_type = m_avg_type;
+  KT::RangePolicy policy(0,m_accum_size);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+    int lo = 0, hi = nentries-1;
+    while (lo<hi) {
+      const int mid = (lo+hi+1)/2;
+      if (table(mid).offset<=idx) {
+        lo = mid;
+      } else {
+        hi = mid-1;
+      }
+    }
+    const auto& e = table(lo);
+    const int local = idx - e.offset;
+
+    int src_idx = local;
+    if (not e.contiguous) {
+      // Unflatten local (w.r.t. the layout extents), and use src strides
+      int rem = local;
+      src_idx = 0;
+      for (int d=e.rank-1; d>=0; --d) {
+        src_idx += (rem % e.extents[d])*e.strides[d];
+        rem /= e.extents[d];
+      }
+    }
+    combine(e.src[src_idx], e.dst[local], avg_type);
+  });
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
+accumulate_field (const std::string& name)
+{
+  const auto  field = get_field(name,"io");
+  const auto& layout = m_layouts.at(name);
+  const auto& dims = layout.dims();
+  const auto  rank = layout.rank();
+
+  auto view_dev = m_dev_views_1d.at(name);
+  auto data = view_dev.data();
+  KT::RangePolicy policy(0,layout.size());
+  const auto extents = layout.extents();
+
+  auto avg_type = m_avg_type;
+  switch (rank) {
+    case 1:
+    {
+      // For rank-1 views, we use strided layout, since it helps us
+      // handling a few more scenarios
+      auto new_view_1d = field.get_strided_view<const Real*,Device>();
+      auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        combine(new_view_1d(i), avg_view_1d(i),avg_type);
+      });
+      break;
+    }
+    case 2:
+    {
+      auto new_view_2d = field.get_view<const Real**,Device>();
+      auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j;
+        unflatten_idx(idx,extents,i,j);
+        combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
+      });
+      break;
+    }
+    case 3:
+    {
+      auto new_view_3d = field.get_view<const Real***,Device>();
+      auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k;
+        unflatten_idx(idx,extents,i,j,k);
+        combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
+      });
+      break;
+    }
+    case 4:
+    {
+      auto new_view_4d = field.get_view<const Real****,Device>();
+      auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l;
+        unflatten_idx(idx,extents,i,j,k,l);
+        combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
+      });
+      break;
+    }
+    case 5:
+    {
+      auto new_view_5d = field.get_view<const Real*****,Device>();
+      auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l,m;
+        unflatten_idx(idx,extents,i,j,k,l,m);
+        combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
+      });
+      break;
+    }
+    case 6:
+    {
+      auto new_view_6d = field.get_view<const Real******,Device>();
+      auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l,m,n;
+        unflatten_idx(idx,extents,i,j,k,l,m,n);
+        combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+  }
+}
 
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
@@ -639,7 +777,13 @@ void AtmosphereOutput::register_views()
     if (can_alias_field_view) {
       // Alias field's data, to save storage.
       m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
-      m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      if (m_async_write) {
+        // The host view is a staging buffer, which is read by the IO worker
+        // while the model keeps running: it cannot alias the field's host data.
+        m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
+      } else {
+        m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      }
     } else {
       // Create a local view.
       m_dev_views_1d.emplace(name,view_1d_dev("",size));
@@ -647,8 +791,85 @@ void AtmosphereOutput::register_views()
 
     }
   }
+  // In async mode, set up the two sets of staging buffers. Set 0 is m_host_views_1d
+  // (which is also used when reading the history restart file).
+  if (m_async_write) {
+    m_async_host_views_1d[0] = m_host_views_1d;
+    for (const auto& it : m_dev_views_1d) {
+      m_async_host_views_1d[1].emplace(it.first,Kokkos::create_mirror(it.second));
+    }
+  }
+
   // Initialize the local views
   reset_dev_views();
+
+  if (m_fused_accumulation) {
+    build_accumulation_table();
+  }
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::build_accumulation_table()
+{
+  std::vector<AccumEntry> entries;
+  long long offset = 0;
+  for (auto const& name : m_fields_names) {
+    if (is_aliasing_field_view(name)) {
+      // Nothing to combine
+      continue;
+    }
+
+    const auto  field  = get_field(name,"io");
+    const auto& layout = m_layouts.at(name);
+    const int   rank   = layout.rank();
+    EKAT_REQUIRE_MSG (rank>=1 && rank<=MaxRank,
+        "Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+
+    AccumEntry e;
+    e.dst    = m_dev_views_1d.at(name).data();
+    e.rank   = rank;
+    e.offset = offset;
+
+    // Grab pointer and strides from the device view, which accounts for padding and subfields
+    auto set_src = [&](const auto& v) {
+      e.src = v.data();
+      for (int d=0; d<rank; ++d) {
+        e.strides[d] = v.stride(d);
+      }
+    };
+    switch (rank) {
+      case 1: set_src(field.get_strided_view<const Real*,Device>()); break;
+      case 2: set_src(field.get_view<const Real**,Device>());        break;
+      case 3: set_src(field.get_view<const Real***,Device>());       break;
+      case 4: set_src(field.get_view<const Real****,Device>());      break;
+      case 5: set_src(field.get_view<const Real*****,Device>());     break;
+      case 6: set_src(field.get_view<const Real******,Device>());    break;
+    }
+
+    // If src strides are those of a LayoutRight view with the layout extents,
+    // src and dst have the same indexing, and we can skip the unflattening.
+    e.contiguous = true;
+    int expected_stride = 1;
+    for (int d=rank-1; d>=0; --d) {
+      e.extents[d] = layout.dim(d);
+      e.contiguous &= (e.strides[d]==expected_stride);
+      expected_stride *= e.extents[d];
+    }
+
+    entries.push_back(e);
+    offset += layout.size();
+  }
+
+  EKAT_REQUIRE_MSG (offset<=std::numeric_limits<int>::max(),
+      "Error! Total size of output fields exceeds the range of the fused accumulation kernel.\n"
+      "       Set 'Fused Accumulation: false' for this stream.\n");
+  m_accum_size = offset;
+
+  m_accum_table = accum_table_dev("accum_table",entries.size());
+  auto table_h = Kokkos::create_mirror_view(m_accum_table);
+  for (size_t i=0; i<entries.size(); ++i) {
+    table_h(i) = entries[i];
+  }
+  Kokkos::deep_copy(m_accum_table,table_h);
 }
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
@@ -683,6 +904,19 @@ register_variables(const std::string& filename,
   using namespace scorpio;
   using namespace ShortFieldTagsNames;
 
+  // Drop the handles of files that were closed since they were registered:
+  // their handles are recycled by scorpio once the file is closed.
+  // is_file_open_c2f reads scorpio's file list, so wait for pending async I/O.
+  AsyncIOWorker::instance().wait();
+  for (auto it=m_var_handles.begin(); it!=m_var_handles.end(); ) {
+    if (is_file_open_c2f(it->first.c_str(),-1)) {
+      ++it;
+    } else {
+      it = m_var_handles.erase(it);
+    }
+  }
+  auto& var_handles = m_var_handles[filename];
+
   // Cycle through all fields and register.
   for (auto const& name : m_fields_names) {
     auto field = get_field(name,"io");
@@ -726,8 +960,8 @@ register_variables(const std::string& filename,
     // Currently the field_manager only stores Real variables so it is not an issue,
     // but in the future if non-Real variables are added we will want to accomodate that.
 
-    register_variable(filename, name, name, units, vec_of_dims,
-                      "real",fp_precision, io_decomp_tag);
+    var_handles[name] = register_variable(filename, name, name, units, vec_of_dims,
+                                          "real",fp_precision, io_decomp_tag);
 
     // Add any extra attributes for this variable, examples include:
     //   1. A list of subfields associated with a field group output
@@ -842,10 +1076,15 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
   // Cycle through all fields and set dof.
   for (auto const& name : m_fields_names) {
     auto field = get_field(name,"io");
-    const auto& fid  = field.get_header().get_identifier();
-    auto var_dof = get_var_dof_offsets(fid.get_layout());
+    const auto& layout = field.get_header().get_identifier().get_layout();
+    // The decomposition may have been created already, for a previous file of this
+    // (or any other) stream. In that case scorpio reuses it, and needs no offsets.
+    std::vector<offset_t> var_dof;
+    if (not is_decomp_set(filename,name)) {
+      var_dof = get_var_dof_offsets(layout);
+    }
     set_dof(filename,name,var_dof.size(),var_dof.data());
-    m_dofs.emplace(std::make_pair(name,var_dof.size()));
+    m_dofs.emplace(std::make_pair(name,layout.size()));
   }
 
   /* TODO: 
@@ -3,6 +3,7 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -28,6 +29,8 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  Asynchronous Write:           BOOL                  (default: false)
+ *  Fused Accumulation:           BOOL                  (default: false)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -62,6 +65,15 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - Asynchronous Write: if true, on write steps the data of all fields is staged in a separate
+ *    set of host buffers, and the scorpio writes are handed to the async IO worker (see
+ *    scream_async_io.hpp), so that the model can proceed while the write is in flight.
+ *    Two sets of staging buffers are used in turn, so that a write step only has to wait
+ *    for the write issued two write steps earlier, rather than for the last one.
+ *    Without MPI_THREAD_MULTIPLE support, the writes are still performed synchronously.
+ *  - Fused Accumulation: if true, the running tallies of all fields are updated with a single
+ *    kernel launch per step, rather than one launch per field. Mostly useful for streams
+ *    with many fields and non-instant averaging type. Off by default.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -145,6 +157,11 @@ public:
   void init();
   void reset_dev_views();
   void setup_output_file (const std::string& filename, const std::string& fp_precision);
+  // begin_run computes the diagnostics and starts the remap of the fields, while run
+  // completes the remap, and accumulates/writes the fields. A caller with several
+  // streams can begin all of them before running any, to overlap their remaps.
+  // If begin_run was not called for this step, run calls it.
+  void begin_run (const bool write, const bool allow_invalid_fields = false);
   void run (const std::string& filename, const bool write, const int nsteps_since_last_output,
             const bool allow_invalid_fields = false);
 
@@ -161,12 +178,17 @@ protected:
   void set_field_manager (const std::shared_ptr<const fm_type>& field_mgr, const std::vector<std::string>& modes);
 
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
+  void update_time_stamps (const std::shared_ptr<remapper_type>& remapper);
 
   void register_dimensions(const std::string& name);
   void register_variables(const std::string& filename, const std::string& fp_precision);
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
+  void build_accumulation_table();
+  void accumulate_fields ();
+  void accumulate_field (const std::string& name);
+  bool is_aliasing_field_view (const std::string& name) const;
   Field get_field(const std::string& name, const std::string mode) const;
   void compute_diagnostic (const std::string& name, const bool allow_invalid_fields = false);
   void set_diagnostics();
@@ -198,6 +220,9 @@ protected:
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
 
+  // Handles of the variables registered in each file (see scorpio::get_variable_handle)
+  std::map<std::string,std::map<std::string,int>>       m_var_handles;
+
   // Use float, so that if output fp_precision=float, this is a representable value.
   // Otherwise, you would get an error from Netcdf, like
   //   NetCDF: Numeric conversion not representable
@@ -209,7 +234,39 @@ protected:
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Everything needed to combine one field into its local view from within a single
+  // kernel launching over the concatenation of all the fields. Since fields are
+  // allocated once and for all, pointers and strides can be computed at init time.
+  static constexpr int MaxRank = 6;
+  struct AccumEntry {
+    const Real* src;
+    Real*       dst;
+    int         rank;
+    int         offset;             // Index of the first entry of this field in the fused range
+    int         extents[MaxRank];
+    int         strides[MaxRank];   // Strides of src (dst is always contiguous)
+    bool        contiguous;         // If true, src has same indexing as dst
+  };
+  using accum_table_dev = typename KT::template view_1d<AccumEntry>;
+
+  accum_table_dev   m_accum_table;
+  int               m_accum_size = 0;
+  bool              m_fused_accumulation = false;
+
   bool m_add_time_dim;
+
+  // If true, m_host_views_1d are never aliased to the fields' host views, and the
+  // writes are performed by the async IO worker.
+  bool m_async_write;
+
+  // In async mode, the staging buffers (set 0 is m_host_views_1d), and the ticket
+  // of the last write that read from each set. Write steps alternate between sets.
+  std::map<std::string,view_1d_host>    m_async_host_views_1d[2];
+  scorpio::AsyncIOWorker::ticket_type   m_async_tickets[2] = {0, 0};
+  int                                   m_async_buf = 0;
+
+  // Whether begin_run was called, but run was not (yet)
+  bool m_run_begun = false;
 };
 
 } //namespace scream
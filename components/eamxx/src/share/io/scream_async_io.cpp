@@ -0,0 +1,152 @@
+#include "share/io/scream_async_io.hpp"
+
+#include <mpi.h>
+
+namespace scream {
+namespace scorpio {
+
+AsyncIOWorker::~AsyncIOWorker ()
+{
+  // Do not throw from the destructor: simply stop the thread
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_task_cv.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+bool AsyncIOWorker::is_threaded () const
+{
+  int inited, finalized;
+  MPI_Initialized(&inited);
+  MPI_Finalized(&finalized);
+  if (not inited or finalized) {
+    return false;
+  }
+
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided==MPI_THREAD_MULTIPLE;
+}
+
+AsyncIOWorker::ticket_type AsyncIOWorker::enqueue (task_type&& task)
+{
+  if (not is_threaded()) {
+    task();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_num_done = ++m_num_enqueued;
+    return m_num_enqueued;
+  }
+
+  if (not m_started) {
+    start();
+  }
+
+  ticket_type ticket;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+    ticket = ++m_num_enqueued;
+  }
+  m_task_cv.notify_one();
+  return ticket;
+}
+
+void AsyncIOWorker::wait ()
+{
+  if (not m_started || std::this_thread::get_id()==m_thread.get_id()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock,[&]{ return m_tasks.empty() and not m_busy; });
+
+  rethrow_error();
+}
+
+void AsyncIOWorker::wait (const ticket_type ticket)
+{
+  if (not m_started || std::this_thread::get_id()==m_thread.get_id()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock,[&]{ return m_num_done>=ticket; });
+
+  rethrow_error();
+}
+
+void AsyncIOWorker::rethrow_error ()
+{
+  // Must be called with m_mutex locked
+  if (m_error) {
+    auto err = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncIOWorker::shutdown ()
+{
+  if (not m_started) {
+    return;
+  }
+
+  wait();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_task_cv.notify_all();
+  m_thread.join();
+
+  m_stop = false;
+  m_started = false;
+}
+
+void AsyncIOWorker::start ()
+{
+  m_stop = false;
+  m_thread = std::thread(&AsyncIOWorker::loop,this);
+  m_started = true;
+}
+
+void AsyncIOWorker::loop ()
+{
+  while (true) {
+    task_type task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_task_cv.wait(lock,[&]{ return m_stop or not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // We were asked to stop, and there is nothing left to do
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      m_busy = true;
+    }
+
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (not m_error) {
+        m_error = std::current_exception();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_busy = false;
+      ++m_num_done;
+    }
+    m_done_cv.notify_all();
+  }
+}
+
+} // namespace scorpio
+} // namespace scream
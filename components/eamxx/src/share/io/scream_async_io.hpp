@@ -0,0 +1,95 @@
+#ifndef SCREAM_ASYNC_IO_HPP
+#define SCREAM_ASYNC_IO_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace scream {
+namespace scorpio {
+
+/*
+ * A single, process-wide worker thread that drains scorpio tasks in FIFO order.
+ *
+ * Output streams that request asynchronous writes stage their data in host
+ * buffers, and then enqueue the actual scorpio calls as a task. The task
+ * runs on the worker thread, while the model keeps stepping.
+ *
+ * Since PIO calls are collective, they must be issued in the same order on
+ * all ranks, and never concurrently from two threads. To guarantee that,
+ *  - all tasks are executed by the same thread, in the order they were enqueued;
+ *  - every entry point of the scorpio interface calls wait() before doing
+ *    anything, so that a scorpio call from the main thread cannot overlap
+ *    with a pending task.
+ *
+ * A worker thread is only spawned if MPI was initialized with MPI_THREAD_MULTIPLE.
+ * Otherwise, tasks are executed immediately inside enqueue, which gives the
+ * same results as synchronous output.
+ *
+ * Exceptions thrown by a task are stored, and rethrown by the next call to
+ * wait() from the main thread.
+ *
+ * enqueue returns a ticket for the task. wait(ticket) blocks only until that
+ * task (and all the ones enqueued before it) has completed, which lets a
+ * stream reuse a staging buffer while later writes are still in flight.
+ */
+
+class AsyncIOWorker
+{
+public:
+  using task_type   = std::function<void()>;
+  using ticket_type = long long;
+
+  static AsyncIOWorker& instance () {
+    static AsyncIOWorker worker;
+    return worker;
+  }
+
+  ~AsyncIOWorker ();
+
+  // Whether enqueued tasks run on a separate thread
+  bool is_threaded () const;
+
+  // Add a task to the queue (or run it right away, if not threaded)
+  ticket_type enqueue (task_type&& task);
+
+  // Block until all tasks have completed. No-op if called from the worker thread.
+  void wait ();
+
+  // Block until the task with the given ticket has completed. Tickets are
+  // increasing, and 0 is never handed out, so wait(0) returns right away.
+  void wait (const ticket_type ticket);
+
+  // Wait for all tasks, then join the worker thread (if any)
+  void shutdown ();
+
+private:
+  AsyncIOWorker () = default;
+
+  void start ();
+  void loop ();
+  void rethrow_error ();
+
+  std::thread                 m_thread;
+  std::mutex                  m_mutex;
+  std::condition_variable     m_task_cv;
+  std::condition_variable     m_done_cv;
+  std::deque<task_type>       m_tasks;
+  std::exception_ptr          m_error;
+
+  // Number of tasks enqueued and completed so far
+  ticket_type m_num_enqueued = 0;
+  ticket_type m_num_done     = 0;
+
+  bool m_busy    = false;
+  bool m_stop    = false;
+  bool m_started = false;
+};
+
+} // namespace scorpio
+} // namespace scream
+
+#endif // SCREAM_ASYNC_IO_HPP
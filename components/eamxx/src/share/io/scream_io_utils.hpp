@@ -126,6 +126,10 @@ struct IOFileSpecs {
 
   // Whether this struct refers to a history restart file
   bool hist_restart_file         = false;
+
+  // Scorpio handles of the time and time_bnds variables in the currently open file
+  int time_var_handle            = -1;
+  int time_bnds_var_handle       = -1;
 };
 
 std::string find_filename_in_rpointer (
@@ -2,6 +2,7 @@
 
 #include "share/io/scorpio_input.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/util/scream_timing.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
@@ -84,6 +85,9 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   m_output_file_specs.filename_with_mpiranks    = out_control_pl.get("MPI Ranks in Filename",false);
   m_output_file_specs.save_grid_data            = out_control_pl.get("save_grid_data",!m_is_model_restart_output);
 
+  // Whether the writes (fields and globals) can be deferred to the async IO worker
+  m_async_write = m_params.get("Asynchronous Write",false);
+
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
     auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
@@ -236,6 +240,39 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const bool is_full_checkpoint_step = is_checkpoint_step && has_checkpoint_data && not is_output_step;
   const bool is_write_step           = is_output_step || is_checkpoint_step;
 
+  // In async mode, a file can only be listed in rpointer.atm once all its pending writes
+  // are done, or a restart may find an incomplete file. Defer until the end of the step.
+  std::vector<std::string> rpointer_files;
+  auto update_rpointer = [&](const std::string& filename) {
+    if (m_io_comm.am_i_root()) {
+      std::ofstream rpointer;
+      rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
+      rpointer << filename << std::endl;
+    }
+  };
+
+  // Update time (must be done _before_ writing fields). In async mode, this must also
+  // be deferred to the IO worker, to preserve the order of the scorpio calls.
+  auto update_time = [&](const int time_var_handle) {
+    const double time = timestamp.days_from(m_case_t0);
+    if (m_async_write) {
+      AsyncIOWorker::instance().enqueue([time_var_handle,time]() {
+        pio_update_time(time_var_handle,time);
+      });
+    } else {
+      pio_update_time(time_var_handle,time);
+    }
+  };
+
+  // Start all the output streams: their remaps proceed while we set up the files,
+  // and while the other streams complete theirs
+  const bool is_fields_write_step = is_output_step || is_full_checkpoint_step;
+  start_timer(timer_root+"::begin_output_streams");
+  for (auto& it : m_output_streams) {
+    it->begin_run(is_fields_write_step,is_t0_output);
+  }
+  stop_timer(timer_root+"::begin_output_streams");
+
   // Create and setup output/checkpoint file(s), if necessary
   start_timer(timer_root+"::get_new_file");
   auto setup_output_file = [&](IOControl& control, IOFileSpecs& filespecs, bool add_to_rpointer, const std::string& file_type) {
@@ -249,10 +286,10 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     // we need to append to the filename ".rhist" or ".r" respectively, and add
     // the filename to the rpointer.atm file.
     if (add_to_rpointer) {
-      if (m_io_comm.am_i_root()) {
-        std::ofstream rpointer;
-        rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
-        rpointer << filespecs.filename << std::endl;
+      if (m_async_write) {
+        rpointer_files.push_back(filespecs.filename);
+      } else {
+        update_rpointer(filespecs.filename);
       }
     }
 
@@ -266,15 +303,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   if (is_output_step) {
     setup_output_file(m_output_control,m_output_file_specs,m_is_model_restart_output,m_is_model_restart_output ? "model restart" : "model output");
 
-    // Update time (must be done _before_ writing fields)
-    pio_update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
+    update_time(m_output_file_specs.time_var_handle);
   }
   if (is_checkpoint_step) {
     setup_output_file(m_checkpoint_control,m_checkpoint_file_specs,true,"history restart");
 
     if (is_full_checkpoint_step) {
-      // Update time (must be done _before_ writing fields)
-      pio_update_time(m_checkpoint_file_specs.filename,timestamp.days_from(m_case_t0));
+      update_time(m_checkpoint_file_specs.time_var_handle);
     }
   }
   stop_timer(timer_root+"::get_new_file");
@@ -284,7 +319,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
   for (auto& it : m_output_streams) {
     // Note: filename only matters if is_output_step || is_full_checkpoint_step=true. In that case, it will definitely point to a valid file name.
-    it->run(fields_write_filename,is_output_step || is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
+    it->run(fields_write_filename,is_fields_write_step,m_output_control.nsamples_since_last_write,is_t0_output);
   }
   stop_timer(timer_root+"::run_output_streams");
 
@@ -301,39 +336,62 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
 
     auto write_global_data = [&](IOControl& control, IOFileSpecs& filespecs) {
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"nsteps",timestamp.get_num_steps());
-      } else if (filespecs.hist_restart_file) {
-        // Update the date of last write and sample size
-        scorpio::write_timestamp (filespecs.filename,"last_write",m_output_control.timestamp_of_last_write);
-        scorpio::set_attribute (filespecs.filename,"num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
-      }
-
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        set_any_attribute(filespecs.filename,name,any);
-      }
+      // Grab everything we need to write *now*: in async mode, the scorpio calls
+      // are deferred, and by the time they run, this manager will have moved on.
+      const auto filename       = filespecs.filename;
+      const bool is_restart     = m_is_model_restart_output;
+      const bool is_hist_rest   = filespecs.hist_restart_file;
+      const auto nsteps         = timestamp.get_num_steps();
+      const auto last_write     = m_output_control.timestamp_of_last_write;
+      const auto nsamples       = m_output_control.nsamples_since_last_write;
+      const auto globals        = m_globals;
+      const auto time_bnds      = m_time_bnds;
+      const auto time_bnds_hdl  = filespecs.time_bnds_var_handle;
 
       // We're adding one snapshot to the file
       ++filespecs.num_snapshots_in_file;
 
-      if (m_time_bnds.size()>0) {
-        scorpio::grid_write_data_array(filespecs.filename, "time_bnds", m_time_bnds.data(), 2);
-      }
-
       // Since we wrote to file we need to reset the nsamples_since_last_write, the timestamp ...
       control.nsamples_since_last_write = 0;
       control.timestamp_of_last_write = timestamp;
 
       // Check if we need to close the output file
-      if (filespecs.file_is_full()) {
-        eam_pio_closefile(filespecs.filename);
+      const bool close_file = filespecs.file_is_full();
+      if (close_file) {
         filespecs.num_snapshots_in_file = 0;
         filespecs.is_open = false;
       }
+
+      auto write = [=]() {
+        if (is_restart) {
+          // Only write nsteps on model restart
+          set_attribute(filename,"nsteps",nsteps);
+        } else if (is_hist_rest) {
+          // Update the date of last write and sample size
+          scorpio::write_timestamp (filename,"last_write",last_write);
+          scorpio::set_attribute (filename,"num_snapshots_since_last_write",nsamples);
+        }
+
+        // Write all stored globals
+        for (const auto& it : globals) {
+          set_any_attribute(filename,it.first,it.second);
+        }
+
+        if (time_bnds.size()>0) {
+          scorpio::grid_write_data_array(time_bnds_hdl, time_bnds.data(), 2);
+        }
+
+        if (close_file) {
+          eam_pio_closefile(filename);
+        }
+      };
+
+      if (m_async_write) {
+        // Must go in the queue *after* the fields writes of the output streams
+        AsyncIOWorker::instance().enqueue(write);
+      } else {
+        write();
+      }
     };
 
     start_timer(timer_root+"::update_snapshot_tally");
@@ -350,6 +408,14 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (m_time_bnds.size()>0) {
       m_time_bnds[0] = m_time_bnds[1];
     }
+
+    if (rpointer_files.size()>0) {
+      // All the writes of this step (fields and globals) are in the queue: wait for them
+      AsyncIOWorker::instance().wait();
+      for (const auto& fn : rpointer_files) {
+        update_rpointer(fn);
+      }
+    }
   }
 
   stop_timer(timer_root);
@@ -447,6 +513,8 @@ set_params (const ekat::ParameterList& params,
     m_casename = m_params.get<std::string>("filename_prefix");
     // Match precision of Fields
     m_params.set<std::string>("Floating Point Precision","real");
+    // Model restart files must be complete when the rpointer file is updated
+    m_params.set("Asynchronous Write",false);
   } else {
     auto avg_type = m_params.get<std::string>("Averaging Type");
     m_avg_type = str2avg(avg_type);
@@ -478,7 +546,9 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
   filename = compute_filename (control,filespecs,is_checkpoint_step,timestamp);
 
   // Register new netCDF file for output. First, check no other output managers
-  // are trying to write on the same file
+  // are trying to write on the same file. Since we query the scorpio internal
+  // structures directly, make sure pending async writes are done first.
+  AsyncIOWorker::instance().wait();
   EKAT_REQUIRE_MSG (not is_file_open_c2f(filename.c_str(),Write),
       "Error! File '" + filename + "' is currently open for write. Cannot share with other output managers.\n");
   register_file(filename,Write);
@@ -490,7 +560,7 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
 
   // Register time as a variable.
   auto time_units="days since " + m_case_t0.get_date_string() + " " + m_case_t0.get_time_string();
-  register_variable(filename,"time","time",time_units,{"time"}, "double", "double","time");
+  filespecs.time_var_handle = register_variable(filename,"time","time",time_units,{"time"}, "double", "double","time");
 #ifdef SCREAM_HAS_LEAP_YEAR
   set_variable_metadata (filename,"time","calendar","gregorian");
 #else
@@ -501,7 +571,7 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
     register_dimension(filename,"dim2","dim2",2,false);
 
     // Register time_bnds var, with its dofs
-    register_variable(filename,"time_bnds","time_bnds",time_units,{"dim2","time"},"double","double","time-dim2");
+    filespecs.time_bnds_var_handle = register_variable(filename,"time_bnds","time_bnds",time_units,{"dim2","time"},"double","double","time-dim2");
     scorpio::offset_t time_bnds_dofs[2] = {0,1};
     set_dof(filename,"time_bnds",2,time_bnds_dofs);
 
@@ -559,6 +629,15 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
   }
 
   filespecs.is_open = true;
+
+  if (m_atm_logger) {
+    // Decompositions are shared by all files/streams, so after the first few files
+    // the number of created decompositions should stop growing.
+    int num_created, num_reused;
+    get_decomp_counters(num_created,num_reused);
+    m_atm_logger->debug("[EAMxx::output_manager] PIO decompositions created/reused so far: "
+                        + std::to_string(num_created) + "/" + std::to_string(num_reused));
+  }
 }
 /*===============================================================================================*/
 void set_file_header(const std::string& filename)
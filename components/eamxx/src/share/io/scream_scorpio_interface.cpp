@@ -1,4 +1,5 @@
 #include "scream_scorpio_interface.hpp"
+#include "scream_async_io.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 #include "scream_config.h"
 
@@ -18,6 +19,8 @@ extern "C" {
   void register_file_c2f(const char*&& filename, const int& mode);
   void set_decomp_c2f(const char*&& filename);
   void set_dof_c2f(const char*&& filename,const char*&& varname,const Int dof_len,const std::int64_t *x_dof);
+  bool is_decomp_set_c2f(const char*&& filename,const char*&& varname);
+  void get_decomp_counters_c2f(int& num_created, int& num_reused);
   void grid_read_data_array_c2f_int(const char*&& filename, const char*&& varname, const Int time_index, int *buf, const int buf_size);
   void grid_read_data_array_c2f_float(const char*&& filename, const char*&& varname, const Int time_index, float *buf, const int buf_size);
   void grid_read_data_array_c2f_double(const char*&& filename, const char*&& varname, const Int time_index, double *buf, const int buf_size);
@@ -25,10 +28,18 @@ extern "C" {
   void grid_write_data_array_c2f_int(const char*&& filename, const char*&& varname, const int* buf, const int buf_size);
   void grid_write_data_array_c2f_float(const char*&& filename, const char*&& varname, const float* buf, const int buf_size);
   void grid_write_data_array_c2f_double(const char*&& filename, const char*&& varname, const double* buf, const int buf_size);
+  void grid_read_data_array_handle_c2f_int(const int var_handle, const Int time_index, int *buf, const int buf_size);
+  void grid_read_data_array_handle_c2f_float(const int var_handle, const Int time_index, float *buf, const int buf_size);
+  void grid_read_data_array_handle_c2f_double(const int var_handle, const Int time_index, double *buf, const int buf_size);
+  void grid_write_data_array_handle_c2f_int(const int var_handle, const int* buf, const int buf_size);
+  void grid_write_data_array_handle_c2f_float(const int var_handle, const float* buf, const int buf_size);
+  void grid_write_data_array_handle_c2f_double(const int var_handle, const double* buf, const int buf_size);
   void eam_init_pio_subsystem_c2f(const int mpicom, const int atm_id);
   void eam_pio_finalize_c2f();
   void eam_pio_closefile_c2f(const char*&& filename);
   void pio_update_time_c2f(const char*&& filename,const double time);
+  void pio_update_time_handle_c2f(const int time_var_handle,const double time);
+  int get_var_handle_c2f(const char*&& filename, const char*&& varname);
   void register_dimension_c2f(const char*&& filename, const char*&& shortname, const char*&& longname, const int global_length, const bool partitioned);
   void register_variable_c2f(const char*&& filename, const char*&& shortname, const char*&& longname,
                              const char*&& units, const int numdims, const char** var_dimensions,
@@ -69,6 +80,7 @@ void eam_init_pio_subsystem(const ekat::Comm& comm) {
 }
 
 void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
+  AsyncIOWorker::instance().wait();
   // TODO: Right now the compid has been hardcoded to 0 and the flag
   // to create a init a subsystem in SCREAM is hardcoded to true.
   // When surface coupling is established we will need to refactor this
@@ -78,25 +90,29 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  // Make sure all pending writes are flushed before shutting down pio
+  AsyncIOWorker::instance().shutdown();
   eam_pio_finalize_c2f();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
+  AsyncIOWorker::instance().wait();
   register_file_c2f(filename.c_str(),mode);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
-
+  AsyncIOWorker::instance().wait();
   eam_pio_closefile_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void set_decomp(const std::string& filename) {
-
+  AsyncIOWorker::instance().wait();
   set_decomp_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 int get_dimlen(const std::string& filename, const std::string& dimname)
 {
+  AsyncIOWorker::instance().wait();
   int ncid, dimid, err;
   PIO_Offset len;
 
@@ -134,6 +150,7 @@ int get_dimlen(const std::string& filename, const std::string& dimname)
 /* ----------------------------------------------------------------- */
 bool has_variable (const std::string& filename, const std::string& varname)
 {
+  AsyncIOWorker::instance().wait();
   int ncid, varid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -159,24 +176,38 @@ bool has_variable (const std::string& filename, const std::string& varname)
 }
 /* ----------------------------------------------------------------- */
 void set_dof(const std::string& filename, const std::string& varname, const Int dof_len, const std::int64_t* x_dof) {
-
+  AsyncIOWorker::instance().wait();
   set_dof_c2f(filename.c_str(),varname.c_str(),dof_len,x_dof);
 }
 /* ----------------------------------------------------------------- */
+bool is_decomp_set(const std::string& filename, const std::string& varname) {
+  AsyncIOWorker::instance().wait();
+  return is_decomp_set_c2f(filename.c_str(),varname.c_str());
+}
+/* ----------------------------------------------------------------- */
+void get_decomp_counters(int& num_created, int& num_reused) {
+  AsyncIOWorker::instance().wait();
+  get_decomp_counters_c2f(num_created,num_reused);
+}
+/* ----------------------------------------------------------------- */
 void pio_update_time(const std::string& filename, const double time) {
-
+  AsyncIOWorker::instance().wait();
   pio_update_time_c2f(filename.c_str(),time);
 }
+void pio_update_time(const int time_var_handle, const double time) {
+  AsyncIOWorker::instance().wait();
+  pio_update_time_handle_c2f(time_var_handle,time);
+}
 /* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length, const bool partitioned) {
-
+  AsyncIOWorker::instance().wait();
   register_dimension_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), length, partitioned);
 }
 /* ----------------------------------------------------------------- */
-void get_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
-                  const std::vector<std::string>& var_dimensions,
-                  const std::string& dtype, const std::string& pio_decomp_tag) {
-
+int get_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
+                 const std::vector<std::string>& var_dimensions,
+                 const std::string& dtype, const std::string& pio_decomp_tag) {
+  AsyncIOWorker::instance().wait();
   /* Convert the vector of strings that contains the variable dimensions to a char array */
   const int numdims = var_dimensions.size();
   std::vector<const char*> var_dimensions_c(numdims);
@@ -186,12 +217,13 @@ void get_variable(const std::string &filename, const std::string& shortname, con
   }
   get_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(),
                    numdims, var_dimensions_c.data(), nctype(dtype), pio_decomp_tag.c_str());
+  return get_var_handle_c2f(filename.c_str(),shortname.c_str());
 }
 /* ----------------------------------------------------------------- */
-void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
-                       const std::string& units, const std::vector<std::string>& var_dimensions,
-                       const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag) {
-
+int register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
+                      const std::string& units, const std::vector<std::string>& var_dimensions,
+                      const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag) {
+  AsyncIOWorker::instance().wait();
   /* Convert the vector of strings that contains the variable dimensions to a char array */
   const int numdims = var_dimensions.size();
   std::vector<const char*> var_dimensions_c(numdims);
@@ -202,13 +234,21 @@ void register_variable(const std::string &filename, const std::string& shortname
   register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(),
                         units.c_str(), numdims, var_dimensions_c.data(),
                         nctype(dtype), nctype(nc_dtype), pio_decomp_tag.c_str());
+  return get_var_handle_c2f(filename.c_str(),shortname.c_str());
+}
+/* ----------------------------------------------------------------- */
+int get_variable_handle(const std::string& filename, const std::string& varname) {
+  AsyncIOWorker::instance().wait();
+  return get_var_handle_c2f(filename.c_str(),varname.c_str());
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val) {
+  AsyncIOWorker::instance().wait();
   set_variable_metadata_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
 }
 /* ----------------------------------------------------------------- */
 ekat::any get_any_attribute (const std::string& filename, const std::string& att_name) {
+  AsyncIOWorker::instance().wait();
   register_file(filename,Read);
   auto ncid = get_file_ncid_c2f (filename.c_str());
   EKAT_REQUIRE_MSG (ncid>=0,
@@ -267,6 +307,7 @@ ekat::any get_any_attribute (const std::string& filename, const std::string& att
   return att;
 }
 void set_any_attribute (const std::string& filename, const std::string& att_name, const ekat::any& att) {
+  AsyncIOWorker::instance().wait();
   auto ncid = get_file_ncid_c2f (filename.c_str());
   int err;
 
@@ -322,38 +363,77 @@ void set_any_attribute (const std::string& filename, const std::string& att_name
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
+  AsyncIOWorker::instance().wait();
   eam_pio_enddef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_write_data_array<int>(const std::string &filename, const std::string &varname, const int* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_write_data_array_c2f_int(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<float>(const std::string &filename, const std::string &varname, const float* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_write_data_array_c2f_float(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<double>(const std::string &filename, const std::string &varname, const double* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
   grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
+template<>
+void grid_read_data_array<int>(const int var_handle, const int time_index, int *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_read_data_array_handle_c2f_int(var_handle,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<float>(const int var_handle, const int time_index, float *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_read_data_array_handle_c2f_float(var_handle,time_index,hbuf,buf_size);
+}
+template<>
+void grid_read_data_array<double>(const int var_handle, const int time_index, double *hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_read_data_array_handle_c2f_double(var_handle,time_index,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
+template<>
+void grid_write_data_array<int>(const int var_handle, const int* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_write_data_array_handle_c2f_int(var_handle,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<float>(const int var_handle, const float* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_write_data_array_handle_c2f_float(var_handle,hbuf,buf_size);
+}
+template<>
+void grid_write_data_array<double>(const int var_handle, const double* hbuf, const int buf_size) {
+  AsyncIOWorker::instance().wait();
+  grid_write_data_array_handle_c2f_double(var_handle,hbuf,buf_size);
+}
+/* ----------------------------------------------------------------- */
 void write_timestamp (const std::string& filename, const std::string& ts_name, const util::TimeStamp& ts)
 {
   set_attribute(filename,ts_name,ts.to_string());
@@ -38,17 +38,30 @@ namespace scorpio {
   void set_decomp(const std::string& filename);
   /* Sets the degrees-of-freedom for a particular variable in a particular file.  Called once for each variable, for each file. */
   void set_dof(const std::string &filename, const std::string &varname, const Int dof_len, const offset_t* x_dof);
+  /* Whether the PIO decomposition used by a registered variable already exists. Decompositions are cached
+   * (by decomp tag) for the whole simulation, and shared by all files and streams. If this returns true,
+   * the dofs are not needed, and set_dof can be called with dof_len=0. */
+  bool is_decomp_set(const std::string& filename, const std::string& varname);
+  /* Number of PIO decompositions created so far, and number of times an existing one was reused. */
+  void get_decomp_counters(int& num_created, int& num_reused);
   /* Register a dimension coordinate with a file. Called during the file setup. */
   void register_dimension(const std::string& filename,const std::string& shortname, const std::string& longname, const int length, const bool partitioned);
-  /* Register a variable with a file.  Called during the file setup, for an output stream. */
-  void register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
+  /* Register a variable with a file.  Called during the file setup, for an output stream.
+   * Returns the variable handle (see get_variable_handle). */
+  int register_variable(const std::string& filename, const std::string& shortname, const std::string& longname,
                          const std::string& units, const std::vector<std::string>& var_dimensions,
                          const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag);
   void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val);
-  /* Register a variable with a file.  Called during the file setup, for an input stream. */
-  void get_variable(const std::string& filename,const std::string& shortname, const std::string& longname,
-                    const std::vector<std::string>& var_dimensions,
-                    const std::string& dtype, const std::string& pio_decomp_tag);
+  /* Register a variable with a file.  Called during the file setup, for an input stream.
+   * Returns the variable handle (see get_variable_handle). */
+  int get_variable(const std::string& filename,const std::string& shortname, const std::string& longname,
+                   const std::vector<std::string>& var_dimensions,
+                   const std::string& dtype, const std::string& pio_decomp_tag);
+  /* Get an opaque handle to a variable registered in an open file. The per-step routines
+   * (reads, writes, time updates) accept the handle in place of the filename/varname pair,
+   * and use it to find the variable in O(1), rather than scanning the file and variable lists
+   * by name. The handle is valid until the file is closed, after which it may be reused. */
+  int get_variable_handle(const std::string& filename, const std::string& varname);
   ekat::any get_any_attribute (const std::string& filename, const std::string& att_name);
   void set_any_attribute (const std::string& filename, const std::string& att_name, const ekat::any& att);
   /* End the definition phase for a scorpio file.  Last thing called after all dimensions, variables, dof's and decomps have been set.  Called once per file.
@@ -56,6 +69,8 @@ namespace scorpio {
   void eam_pio_enddef(const std::string &filename);
   /* Called each timestep to update the timesnap for the last written output. */
   void pio_update_time(const std::string &filename, const double time);
+  /* Same as above, using the handle of the file 'time' variable. */
+  void pio_update_time(const int time_var_handle, const double time);
 
   // Read data for a specific variable from a specific file. To read data that
   // isn't associated with a time index, or to read data at the most recent
@@ -67,6 +82,11 @@ namespace scorpio {
   template<typename T>
   void grid_write_data_array(const std::string &filename, const std::string &varname,
                              const T* hbuf, const int buf_size);
+  /* Same as the two above, with the variable identified by its handle. */
+  template<typename T>
+  void grid_read_data_array (const int var_handle, const int time_index, T* hbuf, const int buf_size);
+  template<typename T>
+  void grid_write_data_array(const int var_handle, const T* hbuf, const int buf_size);
 
   template<typename T>
   T get_attribute (const std::string& filename, const std::string& att_name)
@@ -0,0 +1,195 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scorpio_output.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace scream {
+
+// Expose the running-tally views, so we can compare the two accumulation paths
+class AccumTester : public AtmosphereOutput
+{
+public:
+  using AtmosphereOutput::AtmosphereOutput;
+
+  view_1d_dev get_accum_view (const std::string& name) const {
+    return m_dev_views_1d.at(name);
+  }
+};
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int nlcols = 64;
+  const int nlevs = 72;
+  const int ngcols = nlcols*comm.size();
+  ekat::ParameterList gm_params;
+  gm_params.set("number_of_global_columns",ngcols);
+  gm_params.set("number_of_vertical_levels",nlevs);
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int nfields, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  // Mix of layouts, some padded, so that both the contiguous and strided
+  // paths of the fused kernel are exercised
+  std::vector<FL> layouts =
+  {
+    FL({COL         }, {nlcols        }),
+    FL({COL,     LEV}, {nlcols,  nlevs}),
+    FL({COL,CMP,ILEV}, {nlcols,2,nlevs+1})
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  fm->registration_ends();
+
+  const auto units = ekat::units::Units::nondimensional();
+  for (int i=0; i<nfields; ++i) {
+    const auto& fl = layouts[i % layouts.size()];
+    FID fid("f_"+std::to_string(i),fl,units,grid->name());
+    Field f(fid);
+    if (i % 2 == 1) {
+      f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    }
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+  }
+
+  return fm;
+}
+
+// Run the output stream for nsteps (non-write) steps, and return the time per step in ms
+double time_run (AtmosphereOutput& out, const int nsteps)
+{
+  // Warm up, so that first-touch effects are not counted
+  out.run("",false,0);
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  for (int n=0; n<nsteps; ++n) {
+    out.run("",false,0);
+  }
+  Kokkos::fence();
+  return 1e3*timer.seconds()/nsteps;
+}
+
+ekat::ParameterList get_params (const std::shared_ptr<FieldManager>& fm)
+{
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+
+  ekat::ParameterList params;
+  params.set("Field Names",fnames);
+  params.set<std::string>("Averaging Type","AVERAGE");
+  return params;
+}
+
+TEST_CASE ("io_accumulate") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto seed = get_random_test_seed(&comm);
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = util::TimeStamp({2023,2,17},{0,0,0});
+
+  const int nsteps = 5;
+
+  for (int nfields : {1, 10, 100}) {
+    auto fm = get_fm(grid,t0,nfields,seed);
+    auto params = get_params(fm);
+
+    params.set("Fused Accumulation",false);
+    AccumTester per_field (comm,params,fm,gm);
+    params.set("Fused Accumulation",true);
+    AccumTester fused (comm,params,fm,gm);
+
+    for (int n=0; n<nsteps; ++n) {
+      per_field.run("",false,0);
+      fused.run("",false,0);
+    }
+
+    // Same data, same order of operations: results must match exactly
+    for (const auto& fn : params.get<std::vector<std::string>>("Field Names")) {
+      auto v1 = per_field.get_accum_view(fn);
+      auto v2 = fused.get_accum_view(fn);
+      auto v1_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v1);
+      auto v2_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v2);
+      REQUIRE (v1_h.size()==v2_h.size());
+      for (size_t i=0; i<v1_h.size(); ++i) {
+        REQUIRE (v1_h(i)==v2_h(i));
+      }
+    }
+  }
+}
+
+// Timing of fused vs per-field accumulation. This test is hidden, so it does not
+// run as part of ctest. Run it with './io_accumulate [perf]'.
+TEST_CASE ("io_accumulate_perf","[.][perf]") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto seed = get_random_test_seed(&comm);
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = util::TimeStamp({2023,2,17},{0,0,0});
+
+  const int nsteps = 20;
+
+  for (int nfields : {1, 10, 100, 400}) {
+    auto fm = get_fm(grid,t0,nfields,seed);
+    auto params = get_params(fm);
+
+    params.set("Fused Accumulation",false);
+    AccumTester per_field (comm,params,fm,gm);
+    params.set("Fused Accumulation",true);
+    AccumTester fused (comm,params,fm,gm);
+
+    const double t_per_field = time_run(per_field,nsteps);
+    const double t_fused     = time_run(fused,nsteps);
+
+    std::stringstream ss;
+    ss << "nfields: " << nfields << std::fixed << std::setprecision(4)
+       << ", per-field: " << t_per_field << " ms/step"
+       << ", fused: " << t_fused << " ms/step";
+    WARN (ss.str());
+  }
+}
+
+} // namespace scream
@@ -123,7 +123,8 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 
 // Returns fields after initialization
 void write (const std::string& avg_type, const std::string& freq_units,
-            const int freq, const int seed, const ekat::Comm& comm)
+            const int freq, const int seed, const ekat::Comm& comm,
+            const bool async = false)
 {
   // Create grid
   auto gm = get_gm(comm);
@@ -146,6 +147,7 @@ void write (const std::string& avg_type, const std::string& freq_units,
   om_pl.set("filename_prefix",std::string("io_basic"));
   om_pl.set("Field Names",fnames);
   om_pl.set("Averaging Type", avg_type);
+  om_pl.set("Asynchronous Write", async);
   auto& ctrl_pl = om_pl.sublist("output_control");
   ctrl_pl.set("frequency_units",freq_units);
   ctrl_pl.set("Frequency",freq);
@@ -280,6 +282,7 @@ TEST_CASE ("io_basic") {
     }
   };
 
+  int num_decomps_created, num_decomps_reused;
   for (const auto& units : freq_units) {
     print ("-> Output frequency: " + units + "\n");
     for (const auto& avg : avg_type) {
@@ -288,6 +291,25 @@ TEST_CASE ("io_basic") {
       read(avg,units,freq,seed,comm);
       print(" PASS\n");
     }
+    if (units==freq_units.front()) {
+      scorpio::get_decomp_counters(num_decomps_created,num_decomps_reused);
+    }
+  }
+
+  // All files use the same grid and fields, so the PIO decompositions created
+  // for the first frequency must have been reused by all the following files
+  int num_created, num_reused;
+  scorpio::get_decomp_counters(num_created,num_reused);
+  REQUIRE (num_created==num_decomps_created);
+  REQUIRE (num_reused>num_decomps_reused);
+
+  // Async writes must produce the same files
+  print ("-> Asynchronous write\n");
+  for (const auto& avg : avg_type) {
+    print("   -> Averaging type: " + avg + " ", 40);
+    write(avg,"nsteps",freq,seed,comm,true);
+    read(avg,"nsteps",freq,seed,comm);
+    print(" PASS\n");
   }
   scorpio::eam_pio_finalize();
 }
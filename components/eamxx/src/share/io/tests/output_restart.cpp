@@ -42,16 +42,16 @@ void time_advance (const FieldManager& fm,
 std::shared_ptr<FieldManager>
 backup_fm (const std::shared_ptr<FieldManager>& src_fm);
 
-TEST_CASE("output_restart","io")
+// With async=true, all files are written by the async IO worker, and their
+// names start with io_async_ rather than io_.
+template<typename Engine>
+void run_restart_test (const ekat::Comm& io_comm, Engine& engine, const bool async)
 {
   // Note to AaronDonahue:  You are trying to figure out why you can't change the number of cols and levs for this test.  
   // Something having to do with freeing up and then resetting the io_decompositions.
-  ekat::Comm io_comm(MPI_COMM_WORLD);
   Int num_gcols = 2*io_comm.size();
   Int num_levs = 3;
 
-  auto engine = setup_random_test(&io_comm);
-
   // First set up a field manager and grids manager to interact with the output functions
   auto gm = get_test_gm(io_comm,num_gcols,num_levs);
   auto grid = gm->get_grid("Point Grid");
@@ -59,18 +59,18 @@ TEST_CASE("output_restart","io")
   randomize_fields(*field_manager,engine);
   const auto& out_fields = field_manager->get_groups_info().at("output")->m_fields_names;
 
-  // Initialize the pio_subsystem for this test:
-  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
-  scorpio::eam_init_pio_subsystem(fcomm);
-
   // Timestamp of the simulation initial time
   util::TimeStamp t0 ({2000,1,1},{0,0,0});
 
+  const std::string prefix = async ? "io_async_" : "io_";
+
   // Create an Output manager for testing output
   std::string param_filename = "io_test_restart.yaml";
   ekat::ParameterList output_params;
   ekat::parse_yaml_file(param_filename,output_params);
   output_params.set<std::string>("Floating Point Precision","real");
+  output_params.set<std::string>("filename_prefix",prefix+"output_restart");
+  output_params.set("Asynchronous Write",async);
   OutputManager output_manager;
   output_manager.setup(io_comm,output_params,field_manager,gm,t0,t0,false);
 
@@ -139,6 +139,9 @@ TEST_CASE("output_restart","io")
   ekat::ParameterList output_params_res;
   ekat::parse_yaml_file(param_filename_res,output_params_res);
   output_params_res.set<std::string>("Floating Point Precision","real");
+  output_params_res.set<std::string>("filename_prefix",prefix+"output_restart_check");
+  output_params_res.sublist("Restart").set<std::string>("filename_prefix",prefix+"output_restart");
+  output_params_res.set("Asynchronous Write",async);
 
   OutputManager output_manager_res;
   output_manager_res.setup(io_comm,output_params_res,fm_res,gm,time_res,t0,false);
@@ -151,10 +154,27 @@ TEST_CASE("output_restart","io")
     output_manager_res.run(time_res);
   }
   output_manager_res.finalize();
+}
+
+TEST_CASE("output_restart","io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&io_comm);
+
+  // Initialize the pio_subsystem for this test:
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  run_restart_test(io_comm,engine,false);
+
+  // The .rhist file listed in rpointer.atm must be complete when it is
+  // read by the restarted run, even if it was written asynchronously.
+  run_restart_test(io_comm,engine,true);
 
   // Finalize everything
   scorpio::eam_pio_finalize();
-} 
+}
 
 /*=============================================================================================*/
 std::shared_ptr<FieldManager> get_test_fm(std::shared_ptr<const AbstractGrid> grid)
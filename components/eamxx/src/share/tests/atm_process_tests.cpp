@@ -338,6 +338,68 @@ protected:
   }
 };
 
+// Adds a given increment to Field A on device
+class IncrementA : public DummyProcess
+{
+public:
+  IncrementA (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_increment = params.get<Real>("Increment");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>("Field A",lt,K,m_grid_name);
+  }
+protected:
+  void run_impl (const double /* dt */) {
+    auto v = get_field_out("Field A", m_grid_name).get_view<Real*>();
+    const auto inc = m_increment;
+    Kokkos::parallel_for(v.extent(0),KOKKOS_LAMBDA(const int i) {
+      v(i) += inc;
+    });
+    Kokkos::fence();
+  }
+
+  Real m_increment;
+};
+
+// Copies Field A into Field B on device
+class CopyA : public DummyProcess
+{
+public:
+  CopyA (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Required>("Field A",lt,K,m_grid_name);
+    add_field<Computed>("Field B",lt,K,m_grid_name);
+  }
+protected:
+  void run_impl (const double /* dt */) {
+    get_field_out("Field B", m_grid_name).deep_copy(get_field_in("Field A", m_grid_name));
+  }
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -690,4 +752,80 @@ TEST_CASE ("diagnostics") {
   }
 }
 
+TEST_CASE ("parallel_schedule") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("IncrementA",&create_atmosphere_process<IncrementA>);
+  factory.register_product("CopyA",&create_atmosphere_process<CopyA>);
+
+  // Two procs updating A, and one proc reading it. In parallel splitting,
+  // all procs see the initial value of A, and the increments are added up.
+  ekat::ParameterList params ("Parallel Group");
+  params.set<std::string>("schedule_type","Parallel");
+  params.set<std::string>("atm_procs_list","(IncA1,IncA2,CopyA)");
+  for (const auto& name : {"IncA1","IncA2"}) {
+    auto& p = params.sublist(name);
+    p.set<std::string>("Type","IncrementA");
+    p.set<std::string>("Grid Name", "Point Grid");
+  }
+  params.sublist("IncA1").set<Real>("Increment",1);
+  params.sublist("IncA2").set<Real>("Increment",2);
+  params.sublist("CopyA").set<std::string>("Grid Name", "Point Grid");
+
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  REQUIRE (group->get_schedule_type()==ScheduleType::Parallel);
+  group->set_grids(gm);
+
+  std::map<std::string,Field> fields;
+  for (const auto& req : group->get_required_field_requests()) {
+    Field f(req.fid);
+    f.allocate_view();
+    f.deep_copy(0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fields.emplace(f.name(),f);
+    group->set_required_field(f.get_const());
+  }
+  for (const auto& req : group->get_computed_field_requests()) {
+    if (fields.count(req.fid.name())==0) {
+      Field f(req.fid);
+      f.allocate_view();
+      f.deep_copy(-1);
+      f.get_header().get_tracking().update_time_stamp(t0);
+      fields.emplace(f.name(),f);
+    }
+    group->set_computed_field(fields.at(req.fid.name()));
+  }
+
+  // All procs in a parallel group read from the nodes preceding the group
+  AtmProcDAG dag;
+  REQUIRE_NOTHROW (dag.create_dag(*group));
+
+  group->initialize(t0,RunType::Initial);
+
+  auto& f_A = fields.at("Field A");
+  auto& f_B = fields.at("Field B");
+  for (int step=1; step<=2; ++step) {
+    group->run(1);
+
+    f_A.sync_to_host();
+    f_B.sync_to_host();
+    auto v_A = f_A.get_view<const Real*,Host>();
+    auto v_B = f_B.get_view<const Real*,Host>();
+    for (size_t i=0; i<v_A.size(); ++i) {
+      REQUIRE (v_A[i]==3*step);
+      REQUIRE (v_B[i]==3*(step-1));
+    }
+  }
+}
+
 } // empty namespace
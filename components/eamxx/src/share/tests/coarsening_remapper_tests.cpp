@@ -4,6 +4,10 @@
 #include "share/grid/point_grid.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
 namespace scream {
 
 template<typename ViewT>
@@ -17,8 +21,9 @@ cmvc (const ViewT& v) {
 class CoarseningRemapperTester : public CoarseningRemapper {
 public:
   CoarseningRemapperTester (const grid_ptr_type& src_grid,
-                            const std::string& map_file)
-   : CoarseningRemapper(src_grid,map_file)
+                            const std::string& map_file,
+                            const bool batch_mat_vec = true)
+   : CoarseningRemapper(src_grid,map_file,false,batch_mat_vec)
   {
     // Nothing to do
   }
@@ -69,6 +74,10 @@ public:
   int gid2lid (const gid_t gid, const grid_ptr_type& grid) const {
     return CoarseningRemapper::gid2lid(gid,grid);
   }
+
+  void run_local_mat_vec () const {
+    compute_ov_tgt_rows (0,m_ov_tgt_grid->get_num_local_dofs());
+  }
 };
 
 template<typename ViewT>
@@ -281,9 +290,22 @@ TEST_CASE("coarsening_remap_nnz>nsrc") {
   //          Check remapped fields         //
   // -------------------------------------- //
   const auto tgt_gids = tgt_grid->get_dofs_gids().get_view<const gid_t*,Host>();
+  // Cannot end a split-phase remap that was never started
+  REQUIRE_THROWS(remap->remap_fwd_end());
+
   for (int irun=0; irun<5; ++irun) {
     print (" -> run remap ...\n",comm);
-    remap->remap(true);
+    if (irun % 2 == 0) {
+      remap->remap(true);
+    } else {
+      // Use the split-phase remap, which must give the same result
+      remap->remap_fwd_begin();
+      REQUIRE (remap->is_remap_fwd_pending());
+      REQUIRE_THROWS(remap->remap(true));
+      REQUIRE_THROWS(remap->remap_fwd_begin());
+      remap->remap_fwd_end();
+      REQUIRE (not remap->is_remap_fwd_pending());
+    }
     print (" -> run remap ... done!\n",comm);
 
     print (" -> check tgt fields ...\n",comm);
@@ -600,9 +622,22 @@ TEST_CASE ("coarsening_remap") {
   // No bwd remap
   REQUIRE_THROWS(remap->remap(false));
 
+  // Cannot end a split-phase remap that was never started
+  REQUIRE_THROWS(remap->remap_fwd_end());
+
   for (int irun=0; irun<5; ++irun) {
     print (" -> run remap ...\n",comm);
-    remap->remap(true);
+    if (irun % 2 == 0) {
+      remap->remap(true);
+    } else {
+      // Use the split-phase remap, which must give the same result
+      remap->remap_fwd_begin();
+      REQUIRE (remap->is_remap_fwd_pending());
+      REQUIRE_THROWS(remap->remap(true));
+      REQUIRE_THROWS(remap->remap_fwd_begin());
+      remap->remap_fwd_end();
+      REQUIRE (not remap->is_remap_fwd_pending());
+    }
     print (" -> run remap ... done!\n",comm);
 
     // -------------------------------------- //
@@ -681,4 +716,171 @@ TEST_CASE ("coarsening_remap") {
   scorpio::eam_pio_finalize();
 }
 
+// Compare per-field and batched local mat-vec on a synthetic map where each
+// tgt dof is the average of a contiguous chunk of src dofs. The two must be
+// BFB. If nsteps>0, also print timings of the local mat-vec.
+void test_batched_mat_vec (const ekat::Comm& comm,
+                           const int ngdofs_src, const int ngdofs_tgt,
+                           const int nlevs, const std::vector<int>& nfields_list,
+                           const int nsteps)
+{
+  using gid_t = AbstractGrid::gid_type;
+
+  // Src dofs are split linearly across ranks
+  const int nldofs_src = ngdofs_src/comm.size() + (comm.rank()<ngdofs_src%comm.size() ? 1 : 0);
+  int offset = nldofs_src;
+  comm.scan(&offset,1,MPI_SUM);
+  offset -= nldofs_src;
+
+  auto src_grid = std::make_shared<PointGrid>("src",nldofs_src,nlevs,comm);
+  auto src_dofs = src_grid->get_dofs_gids();
+  auto src_dofs_h = src_dofs.get_view<gid_t*,Host>();
+  std::iota(src_dofs_h.data(),src_dofs_h.data()+nldofs_src,offset);
+  src_dofs.sync_to_dev();
+
+  // Create triplets: each src dof contributes to one tgt dof.
+  print (" -> creating map file ...\n",comm);
+  std::string filename = "coarsening_map_file_batched_" + std::to_string(ngdofs_src)
+                       + "_np" + std::to_string(comm.size()) + ".nc";
+  auto src2tgt = [&](const int src_gid) {
+    return static_cast<int>((static_cast<long long>(src_gid)*ngdofs_tgt)/ngdofs_src);
+  };
+  std::vector<int> tgt_count(ngdofs_tgt,0);
+  for (int gid=0; gid<ngdofs_src; ++gid) {
+    ++tgt_count[src2tgt(gid)];
+  }
+  std::vector<std::int64_t> dofs (nldofs_src);
+  std::vector<Real> col,row,S;
+  for (int i=0; i<nldofs_src; ++i) {
+    const int src_gid = offset+i;
+    const int tgt_gid = src2tgt(src_gid);
+    dofs[i] = src_gid;
+    row.push_back(1+tgt_gid);
+    col.push_back(1+src_gid);
+    S.push_back(1.0/tgt_count[tgt_gid]);
+  }
+  create_remap_file(filename, dofs, ngdofs_src, ngdofs_tgt, ngdofs_src, col, row, S);
+  print (" -> creating map file ... done!\n",comm);
+
+  std::stringstream ss;
+  if (nsteps>0) {
+    ss << " nfields  per-field [ms/step]  batched [ms/step]\n";
+  }
+  for (int nfields : nfields_list) {
+    auto per_field = std::make_shared<CoarseningRemapperTester>(src_grid,filename,false);
+    auto batched   = std::make_shared<CoarseningRemapperTester>(src_grid,filename,true);
+    auto tgt_grid = batched->get_tgt_grid();
+
+    // Mix of 2d and 3d fields, with the 3d ones dominating the cost
+    std::vector<Field> src_f, tgt_pf_f, tgt_b_f;
+    for (int i=0; i<nfields; ++i) {
+      const bool twod = i%4==0;
+      const auto name = "f" + std::to_string(i);
+      const int ps = twod ? 1 : SCREAM_PACK_SIZE;
+      src_f.push_back(create_field(name,src_grid,twod,false,true,ps));
+      tgt_pf_f.push_back(create_field(name,tgt_grid,twod,false,true,ps));
+      tgt_b_f.push_back(create_field(name,tgt_grid,twod,false,true,ps));
+
+      // Fill src data in a deterministic way
+      const auto& f = src_f.back();
+      if (twod) {
+        auto v = f.get_view<Real*,Host>();
+        for (int icol=0; icol<nldofs_src; ++icol) {
+          v(icol) = std::sin(src_dofs_h(icol) + i);
+        }
+      } else {
+        auto v = f.get_view<Real**,Host>();
+        for (int icol=0; icol<nldofs_src; ++icol) {
+          for (int ilev=0; ilev<nlevs; ++ilev) {
+            v(icol,ilev) = std::sin(src_dofs_h(icol) + i + 0.1*ilev);
+        }}
+      }
+      f.sync_to_dev();
+    }
+
+    per_field->registration_begins();
+    batched->registration_begins();
+    for (int i=0; i<nfields; ++i) {
+      per_field->register_field(src_f[i],tgt_pf_f[i]);
+      batched->register_field(src_f[i],tgt_b_f[i]);
+    }
+    per_field->registration_ends();
+    batched->registration_ends();
+
+    if (nsteps>0) {
+      auto time_run = [&] (const CoarseningRemapperTester& remap) {
+        // Warm up, so that first-touch effects are not counted
+        remap.run_local_mat_vec();
+        Kokkos::fence();
+        Kokkos::Timer timer;
+        for (int n=0; n<nsteps; ++n) {
+          remap.run_local_mat_vec();
+        }
+        Kokkos::fence();
+        return 1e3*timer.seconds()/nsteps;
+      };
+      const double t_per_field = time_run(*per_field);
+      const double t_batched   = time_run(*batched);
+      ss << std::setw(8) << nfields
+         << std::setw(21) << std::fixed << std::setprecision(4) << t_per_field
+         << std::setw(19) << t_batched << "\n";
+    }
+
+    // Same weights, same order of operations: results must be BFB
+    per_field->remap(true);
+    batched->remap(true);
+    for (int i=0; i<nfields; ++i) {
+      tgt_pf_f[i].sync_to_host();
+      tgt_b_f[i].sync_to_host();
+      const auto& fl = tgt_b_f[i].get_header().get_identifier().get_layout();
+      const int ncols = fl.dim(0);
+      if (fl.rank()==1) {
+        auto v1 = tgt_pf_f[i].get_view<const Real*,Host>();
+        auto v2 = tgt_b_f[i].get_view<const Real*,Host>();
+        for (int icol=0; icol<ncols; ++icol) {
+          REQUIRE (v1(icol)==v2(icol));
+        }
+      } else {
+        auto v1 = tgt_pf_f[i].get_view<const Real**,Host>();
+        auto v2 = tgt_b_f[i].get_view<const Real**,Host>();
+        for (int icol=0; icol<ncols; ++icol) {
+          for (int ilev=0; ilev<nlevs; ++ilev) {
+            REQUIRE (v1(icol,ilev)==v2(icol,ilev));
+        }}
+      }
+    }
+  }
+  if (nsteps>0 && comm.am_i_root()) {
+    WARN (ss.str());
+  }
+}
+
+TEST_CASE ("coarsening_remap_batched") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  MPI_Fint fcomm = MPI_Comm_c2f(comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  // Small sizes, untimed: only check that batched and per-field are BFB.
+  test_batched_mat_vec(comm,240,12,10,{1,5},0);
+
+  // Clean up scorpio stuff
+  scorpio::eam_pio_finalize();
+}
+
+// Timing of batched vs per-field local mat-vec, with the sizes of a
+// ne30pg2->ne4pg2 map. This test is hidden, so it does not run as part of
+// ctest. Run it with './coarsening_remapper [perf]'.
+TEST_CASE ("coarsening_remap_batched_perf","[.][perf]") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  MPI_Fint fcomm = MPI_Comm_c2f(comm.mpi_comm());
+  scorpio::eam_init_pio_subsystem(fcomm);
+
+  test_batched_mat_vec(comm,21600,384,72,{1,4,16},10);
+
+  // Clean up scorpio stuff
+  scorpio::eam_pio_finalize();
+}
+
 } // namespace scream
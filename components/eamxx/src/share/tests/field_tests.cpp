@@ -620,6 +620,128 @@ TEST_CASE("tracers_bundle", "") {
   REQUIRE (qr_ptr->equivalent(qr));
 }
 
+TEST_CASE("field_mgr_arena") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using FR  = FieldRequest;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  const auto nondim = Units::nondimensional();
+  const std::string grid_name = "physics";
+
+  FieldIdentifier qv_id("qv", {{COL,LEV}, {ncols,nlevs}}, nondim, grid_name);
+  FieldIdentifier qc_id("qc", {{COL,LEV}, {ncols,nlevs}}, nondim, grid_name);
+  FieldIdentifier T_id ("T",  {{COL,LEV}, {ncols,nlevs}}, K, grid_name);
+  FieldIdentifier ps_id("ps", {{COL},     {ncols}},       Pa, grid_name);
+  FieldIdentifier p_id ("p",  {{COL,LEV}, {ncols,nlevs}}, Pa, grid_name);
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid(grid_name,ncols*comm.size(),nlevs,comm);
+
+  FieldManager field_mgr(pg);
+  field_mgr.set_arena_allocation(true);
+  field_mgr.registration_begins();
+  field_mgr.register_field(FR{qv_id,"tracers"});
+  field_mgr.register_field(FR{qc_id,"tracers"});
+  field_mgr.register_field(FR{T_id,SCREAM_PACK_SIZE});
+  field_mgr.register_field(FR{ps_id});
+  field_mgr.register_field(FR{p_id});
+  field_mgr.register_group(GroupRequest("tracers",grid_name,Bundling::Required));
+  field_mgr.registration_ends();
+
+  // Cannot change allocation strategy once fields are allocated
+  REQUIRE_THROWS (field_mgr.set_arena_allocation(false));
+  REQUIRE (field_mgr.uses_arena_allocation());
+
+  auto qv = field_mgr.get_field(qv_id.name());
+  auto qc = field_mgr.get_field(qc_id.name());
+  auto T  = field_mgr.get_field(T_id.name());
+  auto ps = field_mgr.get_field(ps_id.name());
+  auto p  = field_mgr.get_field(p_id.name());
+
+  // Bundling must work as usual
+  auto group = field_mgr.get_field_group("tracers");
+  REQUIRE (group.m_info->m_bundled);
+  auto Q = *group.m_bundle;
+  auto qvp = qv.get_header().get_parent().lock();
+  REQUIRE ((qvp!=nullptr && qvp.get()==&Q.get_header()));
+
+  // All allocations must be within the arena
+  const char* beg = nullptr;
+  const char* end = nullptr;
+  for (const auto& f : {Q,T,ps,p}) {
+    REQUIRE (f.is_allocated());
+    const auto data = f.get_internal_view_data<const char>();
+    const auto size = f.get_header().get_alloc_properties().get_alloc_size();
+    beg = beg==nullptr ? data : std::min(beg,data);
+    end = std::max(end,data+size);
+  }
+  REQUIRE ((end-beg)<=field_mgr.get_arena_size());
+
+  // T and p have the same layout, so they should be adjacent in the arena
+  const auto T_size = T.get_header().get_alloc_properties().get_alloc_size();
+  const auto p_size = p.get_header().get_alloc_properties().get_alloc_size();
+  const auto T_data = T.get_internal_view_data<const char>();
+  const auto p_data = p.get_internal_view_data<const char>();
+  REQUIRE ((std::abs(p_data-T_data)<=std::max(T_size,p_size)+64));
+
+  // Fill fields with random values (on both host and device)
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0.0,1.0);
+  for (auto& f : {Q,T,ps,p}) {
+    randomize(f,engine,pdf);
+  }
+
+  // On host-only builds, the host arena is the device arena, so host and device
+  // views cannot diverge, and there is nothing to check in between syncs.
+  const bool same_space = T.get_view<const Real**>().data()==T.get_view<const Real**,Host>().data();
+
+  auto Th  = T.get_view<const Real**,Host>();
+  auto psh = ps.get_view<const Real*,Host>();
+  auto check_dev = [&](const Real val) {
+    auto Td  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),T.get_view<const Real**>());
+    auto psd = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),ps.get_view<const Real*>());
+    for (int icol=0; icol<ncols; ++icol) {
+      REQUIRE (psd(icol)==val);
+      for (int ilev=0; ilev<nlevs; ++ilev) {
+        REQUIRE (Td(icol,ilev)==val);
+      }
+    }
+  };
+  auto check_host = [&](const Real val) {
+    for (int icol=0; icol<ncols; ++icol) {
+      REQUIRE (psh(icol)==val);
+      for (int ilev=0; ilev<nlevs; ++ilev) {
+        REQUIRE (Th(icol,ilev)==val);
+      }
+    }
+  };
+
+  // Write on device: a single sync of the arena must bring all host views up to date.
+  T.deep_copy<Real>(1);
+  ps.deep_copy<Real>(1);
+  if (not same_space) {
+    for (int icol=0; icol<ncols; ++icol) {
+      REQUIRE (psh(icol)!=1);
+    }
+  }
+  field_mgr.sync_to_host();
+  check_host(1);
+
+  // Write on host: a single sync of the arena must bring all device views up to date.
+  T.deep_copy<Real,Host>(2);
+  ps.deep_copy<Real,Host>(2);
+  if (not same_space) {
+    check_dev(1);
+  }
+  field_mgr.sync_to_dev();
+  check_dev(2);
+}
+
 TEST_CASE("multiple_bundles") {
   using namespace scream;
   using namespace ekat::units;
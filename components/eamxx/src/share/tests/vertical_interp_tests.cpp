@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "share/util/scream_vertical_interpolation.hpp"
+#include "share/util/scream_vertical_interp_cache.hpp"
 
 using namespace scream;
 using namespace vinterp;
@@ -354,3 +355,104 @@ TEST_CASE("testing_masking"){
 
 }
 
+
+TEST_CASE("stencil_cache"){
+  using namespace ShortFieldTagsNames;
+  using P1 = Pack<Real,1>;
+
+  constexpr int ncols = 3;
+  constexpr int nlevs = 10;
+  const Real tol = std::numeric_limits<Real>::epsilon()*100;
+
+  // Source levels are p(icol,k) = 1000*(k+1)+icol, data is 2*p.
+  FieldIdentifier fid("p_mid",FieldLayout({COL,LEV},{ncols,nlevs}),ekat::units::Pa,"grid");
+  Field p_src(fid);
+  p_src.allocate_view();
+  auto p_h = p_src.get_view<Real**,Host>();
+  auto data = view_2d<P1>("",ncols,nlevs);
+  auto data_h = Kokkos::create_mirror_view(data);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs; ++k) {
+      p_h(icol,k) = 1000*(k+1)+icol;
+      data_h(icol,k)[0] = 2*p_h(icol,k);
+    }
+  }
+  p_src.sync_to_dev();
+  Kokkos::deep_copy(data,data_h);
+
+  // Last target is out of bounds, and must be masked
+  const std::vector<Real> p_tgt = {1000.5, 2500, 9999, 20000};
+  const int ntgt = p_tgt.size();
+
+  auto& cache = VerticalInterpCache::instance();
+  cache.clear();
+
+  auto check = [&]() {
+    const auto& stencil = cache.get_stencil(p_src,p_tgt);
+    auto out = view_2d<P1>("",ncols,ntgt);
+    auto mask = view_2d<P1>("",ncols,ntgt);
+    apply_interp_stencil<Real,1>(stencil,data,out,-1);
+    compute_stencil_mask<Real,1>(stencil,mask);
+    auto out_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),out);
+    auto mask_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),mask);
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int k=0; k<ntgt; ++k) {
+        const bool masked = p_tgt[k]<p_h(icol,0) || p_tgt[k]>p_h(icol,nlevs-1);
+        const Real expected = masked ? -1 : 2*p_tgt[k];
+        REQUIRE (std::abs(out_h(icol,k)[0]-expected)<=tol*std::abs(expected));
+        REQUIRE (mask_h(icol,k)[0]==(masked ? 0 : 1));
+      }
+    }
+  };
+
+  util::TimeStamp t0({2000,1,1},{0,0,0});
+  p_src.get_header().get_tracking().update_time_stamp(t0);
+  check();
+  REQUIRE (cache.num_entries()==1);
+
+  // Same field, same time stamp: the stencil is reused, even if data changed.
+  const auto& s1 = cache.get_stencil(p_src,p_tgt);
+  auto idx_before = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),s1.idx);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs; ++k) {
+      p_h(icol,k) += 500;
+    }
+  }
+  p_src.sync_to_dev();
+  const auto& s2 = cache.get_stencil(p_src,p_tgt);
+  REQUIRE (&s1==&s2);
+  auto idx_after = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),s2.idx);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<ntgt; ++k) {
+      REQUIRE (idx_before(icol,k)==idx_after(icol,k));
+    }
+  }
+
+  // Once the time stamp changes, the stencil is recomputed
+  p_src.get_header().get_tracking().update_time_stamp(t0+300);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs; ++k) {
+      data_h(icol,k)[0] = 2*p_h(icol,k);
+    }
+  }
+  Kokkos::deep_copy(data,data_h);
+  check();
+  REQUIRE (cache.num_entries()==1);
+
+  // Different targets get a different entry
+  cache.get_stencil(p_src,{2000});
+  REQUIRE (cache.num_entries()==2);
+
+  // Entries of a source field that no longer exists are evicted
+  {
+    Field p_tmp(fid);
+    p_tmp.allocate_view();
+    p_tmp.deep_copy(p_src);
+    cache.get_stencil(p_tmp,p_tgt);
+    REQUIRE (cache.num_entries()==3);
+  }
+  cache.get_stencil(p_src,p_tgt);
+  REQUIRE (cache.num_entries()==2);
+
+  cache.clear();
+}
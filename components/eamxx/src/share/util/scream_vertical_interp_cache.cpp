@@ -0,0 +1,85 @@
+#include "share/util/scream_vertical_interp_cache.hpp"
+
+namespace scream {
+namespace vinterp {
+
+VerticalInterpCache& VerticalInterpCache::instance ()
+{
+  static VerticalInterpCache cache;
+  // The entries store device views, which must be released before Kokkos is finalized.
+  // Note: the initialization of a local static is thread safe, so the hook is set once.
+  static const bool hook_set = []() {
+    Kokkos::push_finalize_hook([]() { VerticalInterpCache::instance().clear(); });
+    return true;
+  }();
+  (void) hook_set;
+  return cache;
+}
+
+void VerticalInterpCache::clear ()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+int VerticalInterpCache::num_entries () const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+void VerticalInterpCache::evict_stale_entries ()
+{
+  m_entries.remove_if([](const Entry& e) { return e.x_src_header.expired(); });
+}
+
+const InterpStencil& VerticalInterpCache::
+get_stencil (const Field& x_src, const std::vector<Real>& x_tgt)
+{
+  EKAT_REQUIRE_MSG (x_src.rank()==2,
+      "Error! VerticalInterpCache requires a (COL,LEV) source profile field.\n"
+      " - field name  : " + x_src.name() + "\n"
+      " - field layout: " + to_string(x_src.get_header().get_identifier().get_layout()) + "\n");
+
+  const auto src_data = x_src.get_internal_view_data<const Real>();
+  const auto& ts = x_src.get_header().get_tracking().get_time_stamp();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Drop entries of fields that are gone, before their data pointer can be matched
+  evict_stale_entries();
+
+  Entry* entry = nullptr;
+  for (auto& e : m_entries) {
+    if (e.x_src_data==src_data && e.x_tgt==x_tgt) {
+      entry = &e;
+      break;
+    }
+  }
+
+  if (entry==nullptr) {
+    m_entries.emplace_back();
+    entry = &m_entries.back();
+    entry->x_src_header = x_src.get_header_ptr();
+    entry->x_src_data = src_data;
+    entry->x_tgt = x_tgt;
+    entry->x_tgt_dev = view_1d<Real>("vinterp_x_tgt",x_tgt.size());
+    auto x_tgt_h = Kokkos::create_mirror_view(entry->x_tgt_dev);
+    for (size_t k=0; k<x_tgt.size(); ++k) {
+      x_tgt_h(k) = x_tgt[k];
+    }
+    Kokkos::deep_copy(entry->x_tgt_dev,x_tgt_h);
+  } else if (ts.is_valid() && ts==entry->time_stamp) {
+    return entry->stencil;
+  }
+
+  const int nlevs_src = x_src.get_header().get_identifier().get_layout().dims().back();
+  compute_interp_stencil(x_src.get_view<const Real**>(),entry->x_tgt_dev,
+                         nlevs_src,x_tgt.size(),entry->stencil);
+  entry->time_stamp = ts;
+
+  return entry->stencil;
+}
+
+} // namespace vinterp
+} // namespace scream
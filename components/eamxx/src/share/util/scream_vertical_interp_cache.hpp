@@ -0,0 +1,76 @@
+#ifndef SCREAM_VERTICAL_INTERP_CACHE_HPP
+#define SCREAM_VERTICAL_INTERP_CACHE_HPP
+
+#include "share/util/scream_vertical_interpolation.hpp"
+#include "share/field/field.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace scream {
+namespace vinterp {
+
+/*
+ * A process-wide cache of vertical interpolation stencils.
+ *
+ * Several users (e.g., all the X_at_YhPa diagnostics, or all the fields
+ * of a VerticalRemapper) interpolate against the same source pressure
+ * profile and the same target levels. Rather than each one redoing the
+ * bracket search, they can ask this class for the stencil, which is
+ * computed once and reused until the source profile changes.
+ *
+ * Stencils are keyed by the source profile field, the target levels, and
+ * the time stamp of the source profile field. If the source field does not
+ * have a valid time stamp, the stencil is recomputed at every request, since
+ * we have no way to tell whether the field changed.
+ *
+ * Entries do not keep the source Field alive: they only hold a weak reference
+ * to its header, and are evicted as soon as the source field is destroyed
+ * (which also guarantees that a recycled allocation is never matched to a
+ * stale entry). Access to the cache is serialized with a mutex. The cache
+ * is cleared when Kokkos is finalized.
+ */
+
+class VerticalInterpCache
+{
+public:
+  static VerticalInterpCache& instance ();
+
+  // Get the stencil to interpolate from the levels in x_src onto x_tgt.
+  // The returned reference remains valid as long as x_src is alive,
+  // and clear() is not called.
+  const InterpStencil& get_stencil (const Field& x_src, const std::vector<Real>& x_tgt);
+
+  // Remove all entries
+  void clear ();
+
+  int num_entries () const;
+
+private:
+  VerticalInterpCache () = default;
+
+  // Remove the entries whose source field no longer exists.
+  // Must be called with m_mutex locked.
+  void evict_stale_entries ();
+
+  struct Entry {
+    std::weak_ptr<const FieldHeader>  x_src_header;
+    const Real*                       x_src_data;
+    std::vector<Real>                 x_tgt;
+    view_1d<Real>                     x_tgt_dev;
+    util::TimeStamp                   time_stamp;
+    InterpStencil                     stencil;
+  };
+
+  // Use a list, so that references to stored stencils are not invalidated by insertions
+  std::list<Entry>    m_entries;
+  mutable std::mutex  m_mutex;
+};
+
+} // namespace vinterp
+} // namespace scream
+
+#endif // SCREAM_VERTICAL_INTERP_CACHE_HPP
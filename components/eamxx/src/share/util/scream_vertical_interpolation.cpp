@@ -0,0 +1,59 @@
+#include "share/util/scream_vertical_interpolation.hpp"
+
+namespace scream {
+namespace vinterp {
+
+void compute_interp_stencil(
+  const view_2d<const Real>& x_src,
+  const view_1d<const Real>& x_tgt,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  InterpStencil& stencil)
+{
+  const int ncols = x_src.extent_int(0);
+  EKAT_REQUIRE_MSG (nlevs_src>=2,
+      "Error! Vertical interpolation requires at least 2 source levels.\n");
+  EKAT_REQUIRE(nlevs_src <= x_src.extent_int(1));
+  EKAT_REQUIRE(nlevs_tgt <= x_tgt.extent_int(0));
+
+  if (stencil.idx.extent_int(0)!=ncols || stencil.idx.extent_int(1)!=nlevs_tgt) {
+    stencil.idx = view_2d<int>("vinterp_stencil_idx",ncols,nlevs_tgt);
+    stencil.wgt = view_2d<Real>("vinterp_stencil_wgt",ncols,nlevs_tgt);
+  }
+  stencil.nlevs_src = nlevs_src;
+  stencil.nlevs_tgt = nlevs_tgt;
+
+  const auto idx = stencil.idx;
+  const auto wgt = stencil.wgt;
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+  Kokkos::parallel_for("scream_vert_interp_stencil_setup", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt), [&] (const int k) {
+      const Real x = x_tgt(k);
+      // Mask out values above (below) maximum (minimum) source grid
+      if (x > x_src(icol,nlevs_src-1) || x < x_src(icol,0)) {
+        idx(icol,k) = -1;
+        wgt(icol,k) = 0;
+        return;
+      }
+      // Bisection, keeping x_src(lo) <= x <= x_src(hi)
+      int lo = 0, hi = nlevs_src-1;
+      while (hi-lo>1) {
+        const int mid = (lo+hi)/2;
+        if (x_src(icol,mid) <= x) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      const Real dx = x_src(icol,hi) - x_src(icol,lo);
+      idx(icol,k) = lo;
+      wgt(icol,k) = dx>0 ? (x - x_src(icol,lo)) / dx : Real(0);
+    });
+  });
+  Kokkos::fence();
+}
+
+} // namespace vinterp
+} // namespace scream
@@ -195,6 +195,54 @@ void apply_interpolation(
   const view_3d<      Pack<T,P>>& output,
   const view_3d<        Mask<P>>& mask);
 
+/* ----------------------------------------------------------------------
+ * Precomputed interpolation stencils
+ *
+ * For each column icol and target level k, the stencil stores
+ *  - idx(icol,k): the source level such that x_src(idx) <= x_tgt(k) <= x_src(idx+1),
+ *    or -1 if x_tgt(k) is outside the range of x_src (i.e., the output is masked);
+ *  - wgt(icol,k): the weight of x_src(idx+1) in the linear interpolation.
+ * Computing the stencil once allows to interpolate several fields that share
+ * the same source and target profiles without repeating the bracket search.
+ * ---------------------------------------------------------------------- */
+struct InterpStencil {
+  view_2d<int>  idx;
+  view_2d<Real> wgt;
+  int nlevs_src = 0;
+  int nlevs_tgt = 0;
+};
+
+// Compute the stencil. Views in the stencil are only (re)allocated if their
+// extents do not match, so repeated calls do not allocate memory.
+void compute_interp_stencil(
+  const view_2d<const Real>& x_src,
+  const view_1d<const Real>& x_tgt,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  InterpStencil& stencil);
+
+// Interpolate input onto output using a precomputed stencil. Masked entries are set to msk_val.
+template<typename T, int P>
+void apply_interp_stencil(
+  const InterpStencil&              stencil,
+  const view_2d<const Pack<T,P>>&   input,
+  const view_2d<      Pack<T,P>>&   output,
+  const Real msk_val = masked_val);
+
+template<typename T, int P>
+void apply_interp_stencil(
+  const InterpStencil&              stencil,
+  const view_3d<const Pack<T,P>>&   input,
+  const view_3d<      Pack<T,P>>&   output,
+  const Real msk_val = masked_val);
+
+// Set mask to 1 where the stencil interpolates, and to 0 where the output is masked.
+// This is what interpolating a field of ones would give, without reading any input.
+template<typename T, int P>
+void compute_stencil_mask(
+  const InterpStencil&              stencil,
+  const view_2d<      Pack<T,P>>&   mask);
+
 // Helper function to allocate memory for an Nd mask on the fly.
 template<int P, int N>
 view_Nd<Mask<P>,N> allocate_mask(const std::vector<int>& extents);
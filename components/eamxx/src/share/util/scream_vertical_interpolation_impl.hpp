@@ -348,7 +348,103 @@ void apply_interpolation(
   });
   Kokkos::fence();   
 }
-  
+
+/* ----------------------------------------------------------------------
+ * Precomputed interpolation stencils
+ * ---------------------------------------------------------------------- */
+template<typename T>
+KOKKOS_INLINE_FUNCTION
+T interp_with_stencil(const int idx, const Real wgt, const T* in, const T msk_val)
+{
+  return idx<0 ? msk_val : in[idx] + wgt*(in[idx+1]-in[idx]);
+}
+
+template<typename T, int P>
+void apply_interp_stencil(
+  const InterpStencil&              stencil,
+  const view_2d<const Pack<T,P>>&   input,
+  const view_2d<      Pack<T,P>>&   output,
+  const Real msk_val)
+{
+  const int ncols = input.extent_int(0);
+  const int nlevs_tgt = stencil.nlevs_tgt;
+  EKAT_REQUIRE_MSG (stencil.idx.extent_int(0)==ncols,
+      "Error! Interpolation stencil was computed for a different number of columns.\n");
+  EKAT_REQUIRE(stencil.nlevs_src <= input.extent_int(1)*P);
+  EKAT_REQUIRE(nlevs_tgt <= output.extent_int(1)*P);
+
+  const auto idx = stencil.idx;
+  const auto wgt = stencil.wgt;
+  const T mval = msk_val;
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+  Kokkos::parallel_for("scream_vert_interp_stencil_2d", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank();
+    const T* in  = reinterpret_cast<const T*>(&input(icol,0));
+          T* out = reinterpret_cast<      T*>(&output(icol,0));
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt), [&] (const int k) {
+      out[k] = interp_with_stencil(idx(icol,k),wgt(icol,k),in,mval);
+    });
+  });
+  Kokkos::fence();
+}
+
+template<typename T, int P>
+void apply_interp_stencil(
+  const InterpStencil&              stencil,
+  const view_3d<const Pack<T,P>>&   input,
+  const view_3d<      Pack<T,P>>&   output,
+  const Real msk_val)
+{
+  const int ncols = input.extent_int(0);
+  const int num_vars = input.extent_int(1);
+  const int nlevs_tgt = stencil.nlevs_tgt;
+  EKAT_REQUIRE_MSG (stencil.idx.extent_int(0)==ncols,
+      "Error! Interpolation stencil was computed for a different number of columns.\n");
+  EKAT_REQUIRE(stencil.nlevs_src <= input.extent_int(2)*P);
+  EKAT_REQUIRE(nlevs_tgt <= output.extent_int(2)*P);
+
+  const auto idx = stencil.idx;
+  const auto wgt = stencil.wgt;
+  const T mval = msk_val;
+  const auto policy = ESU::get_default_team_policy(ncols*num_vars, nlevs_tgt);
+  Kokkos::parallel_for("scream_vert_interp_stencil_3d", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+    const T* in  = reinterpret_cast<const T*>(&input(icol,ivar,0));
+          T* out = reinterpret_cast<      T*>(&output(icol,ivar,0));
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt), [&] (const int k) {
+      out[k] = interp_with_stencil(idx(icol,k),wgt(icol,k),in,mval);
+    });
+  });
+  Kokkos::fence();
+}
+
+template<typename T, int P>
+void compute_stencil_mask(
+  const InterpStencil&              stencil,
+  const view_2d<      Pack<T,P>>&   mask)
+{
+  const int ncols = mask.extent_int(0);
+  const int nlevs_tgt = stencil.nlevs_tgt;
+  EKAT_REQUIRE_MSG (stencil.idx.extent_int(0)==ncols,
+      "Error! Interpolation stencil was computed for a different number of columns.\n");
+  EKAT_REQUIRE(nlevs_tgt <= mask.extent_int(1)*P);
+
+  const auto idx = stencil.idx;
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+  Kokkos::parallel_for("scream_vert_interp_stencil_mask", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int icol = team.league_rank();
+    T* out = reinterpret_cast<T*>(&mask(icol,0));
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt), [&] (const int k) {
+      out[k] = idx(icol,k)<0 ? T(0) : T(1);
+    });
+  });
+  Kokkos::fence();
+}
+
 } // namespace vinterp
 } // namespace scream
 
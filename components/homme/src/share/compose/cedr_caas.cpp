@@ -43,6 +43,7 @@ CAAS<ES>::CAAS (const mpi::Parallel::Ptr& p, const Int nlclcells,
   o.nrhomidxs_ = 0;
   o.need_conserve_ = false;
   finished_setup_ = false;
+  reduce_in_flight_ = false;
   cedr_throw_if(nlclcells == 0, "CAAS does not support 0 cells on a rank.");
   tracer_decls_ = std::make_shared<std::vector<Decl> >();  
 }
@@ -201,11 +202,20 @@ void CAAS<ES>::reduce_locally () {
 }
 
 template <typename ES>
-void CAAS<ES>::reduce_globally () {
-  const int err = mpi::all_reduce(*p_, send_.data(), recv_.data(),
-                                  send_.size(), MPI_SUM);
+void CAAS<ES>::reduce_globally_start () {
+  // send_ must be complete before MPI reads it.
+  Kokkos::fence();
+  const int err = mpi::iall_reduce(*p_, send_.data(), recv_.data(),
+                                   send_.size(), MPI_SUM, &reduce_req_);
   cedr_throw_if(err != MPI_SUCCESS,
-                "CAAS::reduce_globally MPI_Allreduce returned " << err);
+                "CAAS::reduce_globally_start MPI_Iallreduce returned " << err);
+}
+
+template <typename ES>
+void CAAS<ES>::reduce_globally_finish () {
+  const int err = mpi::wait(&reduce_req_);
+  cedr_throw_if(err != MPI_SUCCESS,
+                "CAAS::reduce_globally_finish MPI_Wait returned " << err);
 }
 
 template <typename ES>
@@ -257,15 +267,34 @@ const typename CAAS<ES>::DeviceOp& CAAS<ES>::get_device_op() { return o; }
 
 template <typename ES>
 void CAAS<ES>::run () {
+  run_start();
+  run_finish();
+}
+
+template <typename ES>
+void CAAS<ES>::run_start () {
   cedr_assert(finished_setup_);
+  cedr_assert( ! reduce_in_flight_);
   reduce_locally();
   const bool user_reduces = user_reducer_ != nullptr;
   if (user_reduces)
-    (*user_reducer_)(*p_, send_.data(), recv_.data(),
-                     o.nlclcells_ / user_reducer_->n_accum_in_place(),
-                     recv_.size(), MPI_SUM);
+    user_reducer_->start(*p_, send_.data(), recv_.data(),
+                         o.nlclcells_ / user_reducer_->n_accum_in_place(),
+                         recv_.size(), MPI_SUM);
+  else
+    reduce_globally_start();
+  reduce_in_flight_ = true;
+}
+
+template <typename ES>
+void CAAS<ES>::run_finish () {
+  cedr_assert(reduce_in_flight_);
+  const bool user_reduces = user_reducer_ != nullptr;
+  if (user_reduces)
+    user_reducer_->finish();
   else
-    reduce_globally();
+    reduce_globally_finish();
+  reduce_in_flight_ = false;
   finish_locally();
 }
 
@@ -280,31 +309,46 @@ struct TestCAAS : public cedr::test::TestRandomized {
 
     int operator() (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
                     int nlcl, int count, MPI_Op op) const override {
-      Kokkos::View<Real*> s(sendbuf, nlcl*count), r(rcvbuf, count);
-      const auto s_h = Kokkos::create_mirror_view(s);
-      Kokkos::deep_copy(s_h, s);
-      const auto r_h = Kokkos::create_mirror_view(r);
+      const int err = start(p, sendbuf, rcvbuf, nlcl, count, op);
+      const int err_finish = finish();
+      return err != MPI_SUCCESS ? err : err_finish;
+    }
+
+    int start (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+               int nlcl, int count, MPI_Op op) const override {
+      Kokkos::View<Real*> s(sendbuf, nlcl*count);
+      r_ = Kokkos::View<Real*>(rcvbuf, count);
+      s_h_ = Kokkos::create_mirror_view(s);
+      Kokkos::deep_copy(s_h_, s);
+      r_h_ = Kokkos::create_mirror_view(r_);
       for (int k = 0; k < count; ++k) {
         // When k == 0, s_h(0:nlcl-1) is summed. Then s_h(1:nlcl-1) is
         // free to be overwritten.
-        s_h(k) = s_h(nlcl*k);
+        s_h_(k) = s_h_(nlcl*k);
         for (int i = 1; i < nlcl; ++i)
-          s_h(k) += s_h(nlcl*k + i);
+          s_h_(k) += s_h_(nlcl*k + i);
       }
-      const int err = mpi::all_reduce(p, s_h.data(), r_h.data(), count, op);
-      Kokkos::deep_copy(r, r_h);
+      return mpi::iall_reduce(p, s_h_.data(), r_h_.data(), count, op, &req_);
+    }
+
+    int finish () const override {
+      const int err = mpi::wait(&req_);
+      Kokkos::deep_copy(r_, r_h_);
       return err;
     }
 
   private:
     Int n_;
+    mutable mpi::Request req_;
+    mutable Kokkos::View<Real*> r_;
+    mutable Kokkos::View<Real*>::HostMirror s_h_, r_h_;
   };
 
   TestCAAS (const mpi::Parallel::Ptr& p, const Int& ncells,
             const bool use_own_reducer, const bool external_memory,
-            const bool verbose)
+            const bool split_run, const bool verbose)
     : TestRandomized("CAAS", p, ncells, verbose),
-      p_(p), external_memory_(external_memory)
+      p_(p), external_memory_(external_memory), split_run_(split_run)
   {
     const auto np = p->size(), rank = p->rank();
     nlclcells_ = ncells / np;
@@ -360,12 +404,17 @@ struct TestCAAS : public cedr::test::TestRandomized {
   }
 
   void run_impl (const Int trial) override {
-    caas_->run();
+    if (split_run_) {
+      caas_->run_start();
+      caas_->run_finish();
+    } else {
+      caas_->run();
+    }
   }
 
 private:
   mpi::Parallel::Ptr p_;
-  bool external_memory_;
+  bool external_memory_, split_run_;
   Int nlclcells_;
   CAAST::Ptr caas_;
   typename CAAST::RealList buf1_, buf2_;
@@ -386,8 +435,9 @@ Int unittest (const mpi::Parallel::Ptr& p) {
     if (ncells > np) ncells -= np/2;
     for (const bool own_reducer : {false, true})
       for (const bool external_memory : {false, true})
-        nerr += TestCAAS(p, ncells, own_reducer, external_memory, false)
-          .run<TestCAAS::CAAST>(1, false);
+        for (const bool split_run : {false, true})
+          nerr += TestCAAS(p, ncells, own_reducer, external_memory, split_run, false)
+            .run<TestCAAS::CAAST>(1, false);
   }
   return nerr;
 }
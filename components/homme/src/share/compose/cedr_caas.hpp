@@ -46,6 +46,16 @@ public:
     // if those DOFs are guaranteed always to be on the same processor. If so,
     // expose that value n here.
     virtual int n_accum_in_place () const { return 1; }
+
+    // Split-phase alternative to operator(). start may return before the
+    // reduction is complete, and finish completes it. The caller must not touch
+    // sendbuf or rcvbuf between the two calls. By default, start does all the
+    // work.
+    virtual int start (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+                       int nlocal, int nfld, MPI_Op op) const {
+      return (*this)(p, sendbuf, rcvbuf, nlocal, nfld, op);
+    }
+    virtual int finish () const { return 0; }
   };
 
   CAAS(const mpi::Parallel::Ptr& p, const Int nlclcells,
@@ -88,6 +98,13 @@ public:
 
   void run() override;
 
+  // Reduce locally and start the global reduction. If the caller provided a
+  // UserAllReducer, its start/finish pair does the reduction.
+  void run_start() override;
+
+  // Wait for the global reduction and adjust the local values.
+  void run_finish() override;
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -106,8 +123,11 @@ protected:
   RealList send_, recv_;
   bool finished_setup_;
   DeviceOp o;
+  mpi::Request reduce_req_;
+  bool reduce_in_flight_;
 
-  void reduce_globally();
+  void reduce_globally_start();
+  void reduce_globally_finish();
 
 PRIVATE_CUDA:
   void reduce_locally();
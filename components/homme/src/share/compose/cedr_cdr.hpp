@@ -107,6 +107,14 @@ struct CDR {
   // call this function from a parallel region.
   virtual void run() = 0;
 
+  // Split-phase alternative to run(): run_start does the rank-local work and
+  // starts the global communication, and run_finish completes the
+  // algorithm. The caller may do other work between the two calls, but must
+  // not call set_{rhom,Qm} or get_Qm until run_finish returns. CDRs without a
+  // split phase do all the work in run_start.
+  virtual void run_start () { run(); }
+  virtual void run_finish () {}
+
 protected:
   Options options_;
 };
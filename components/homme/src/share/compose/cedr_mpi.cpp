@@ -77,6 +77,13 @@ int waitall (int count, Request* reqs, MPI_Status* stats) {
 #endif
 }
 
+int wait (Request* req, MPI_Status* stat) {
+#ifdef COMPOSE_DEBUG_MPI
+  req->unfreed--;
+#endif
+  return MPI_Wait(&req->request, stat ? stat : MPI_STATUS_IGNORE);
+}
+
 bool all_ok (const Parallel& p, bool im_ok) {
   int ok = im_ok, msg;
   all_reduce<int>(p, &ok, &msg, 1, MPI_LAND);
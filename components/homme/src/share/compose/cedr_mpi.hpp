@@ -47,6 +47,11 @@ int reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op,
 template <typename T>
 int all_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op);
 
+// Nonblocking all_reduce. Complete it with wait.
+template <typename T>
+int iall_reduce(const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_Op op,
+                Request* ireq);
+
 template <typename T>
 int isend(const Parallel& p, const T* buf, int count, int dest, int tag,
           Request* ireq = nullptr);
@@ -59,6 +64,8 @@ int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 
+int wait(Request* req, MPI_Status* stat = nullptr);
+
 template<typename T>
 int gather(const Parallel& p, const T* sendbuf, int sendcount,
            T* recvbuf, int recvcount, int root);
@@ -229,7 +229,7 @@ void QLT<ES>::init_ordinals () {
 template <typename ES>
 QLT<ES>::QLT (const Parallel::Ptr& p, const Int& ncells, const tree::Node::Ptr& tree,
               Options options)
-  : CDR(options)
+  : CDR(options), run_lvl_(0), run_lvl_recv_posted_(false)
 {
   init(p, ncells, tree);
   cedr_throw_if(nlclcells() == 0, "QLT does not support 0 cells on a rank.");
@@ -326,11 +326,21 @@ Int QLT<ES>::get_num_tracers () const {
 
 template <typename ES> void QLT<ES>
 ::l2r_recv (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+  l2r_post_recv(lvl, l2rndps);
+  l2r_wait(lvl);
+}
+
+template <typename ES> void QLT<ES>
+::l2r_post_recv (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
     const auto& mmd = lvl.kids[i];
     mpi::irecv(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
                mmd.rank, tree::NodeSets::mpitag, &lvl.kids_req[i]);
   }
+}
+
+template <typename ES> void QLT<ES>
+::l2r_wait (const tree::NodeSets::Level& lvl) const {
   Timer::start(Timer::waitall);
   mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
   Timer::stop(Timer::waitall);
@@ -617,17 +627,42 @@ const typename QLT<ES>::DeviceOp& QLT<ES>::get_device_op() { return o; }
 
 template <typename ES>
 void QLT<ES>::run () {
+  run_start();
+  run_finish();
+}
+
+template <typename ES>
+void QLT<ES>::run_start () {
   cedr_assert(o.bd_.inited());
+  Timer::start(Timer::qltrunl2r);
+  const Int l2rndps = o.md_.a_h.prob2bl2r[o.md_.nprobtypes];
+  // Levels up to the first one with kids on other ranks need only local data.
+  run_lvl_ = 0;
+  for ( ; run_lvl_ < ns_->levels.size(); ++run_lvl_) {
+    auto& lvl = ns_->levels[run_lvl_];
+    if (lvl.kids.size()) break;
+    l2r_combine_kid_data(run_lvl_, l2rndps);
+    if (lvl.me.size()) l2r_send_to_parents(lvl, l2rndps);
+  }
+  run_lvl_recv_posted_ = run_lvl_ < ns_->levels.size();
+  if (run_lvl_recv_posted_) l2r_post_recv(ns_->levels[run_lvl_], l2rndps);
+  Timer::stop(Timer::qltrunl2r);
+}
+
+template <typename ES>
+void QLT<ES>::run_finish () {
   Timer::start(Timer::qltrunl2r);
   // Number of data per slot.
   const Int l2rndps = o.md_.a_h.prob2bl2r[o.md_.nprobtypes];
   const Int r2lndps = o.md_.a_h.prob2br2l[o.md_.nprobtypes];
-  for (size_t il = 0; il < ns_->levels.size(); ++il) {
+  for (size_t il = run_lvl_; il < ns_->levels.size(); ++il) {
     auto& lvl = ns_->levels[il];
-    if (lvl.kids.size()) l2r_recv(lvl, l2rndps);
+    if (il == run_lvl_ && run_lvl_recv_posted_) l2r_wait(lvl);
+    else if (lvl.kids.size()) l2r_recv(lvl, l2rndps);
     l2r_combine_kid_data(il, l2rndps);    
     if (lvl.me.size()) l2r_send_to_parents(lvl, l2rndps);
   }
+  run_lvl_recv_posted_ = false;
   Timer::stop(Timer::qltrunl2r); Timer::start(Timer::qltrunr2l);
   root_compute(l2rndps, r2lndps);
   for (size_t il = ns_->levels.size(); il > 0; --il) {
@@ -647,10 +682,11 @@ public:
   typedef QLT<Kokkos::DefaultExecutionSpace> QLTT;
 
   TestQLT (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
-           const Int& ncells, const bool external_memory, const bool verbose,
-           CDR::Options options)
+           const Int& ncells, const bool external_memory, const bool split_run,
+           const bool verbose, CDR::Options options)
     : TestRandomized("QLT", p, ncells, verbose, options),
-      qlt_(p, ncells, tree, options), tree_(tree), external_memory_(external_memory)
+      qlt_(p, ncells, tree, options), tree_(tree), external_memory_(external_memory),
+      split_run_(split_run)
   {
     if (verbose) qlt_.print(std::cout);
     init();
@@ -659,7 +695,7 @@ public:
 private:
   QLTT qlt_;
   tree::Node::Ptr tree_;
-  bool external_memory_;
+  bool external_memory_, split_run_;
   typename QLTT::RealList buf1_, buf2_;
 
   CDR& get_cdr () override { return qlt_; }
@@ -716,7 +752,12 @@ private:
   void run_impl (const Int trial) override {
     MPI_Barrier(p_->comm());
     Timer::start(Timer::qltrun);
-    qlt_.run();
+    if (split_run_) {
+      qlt_.run_start();
+      qlt_.run_finish();
+    } else {
+      qlt_.run();
+    }
     MPI_Barrier(p_->comm());
     Timer::stop(Timer::qltrun);
     if (trial == 0) {
@@ -733,11 +774,12 @@ private:
 Int test_qlt (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
               const Int& ncells, const Int nrepeat,
               const bool write, const bool external_memory,
-              const bool prefer_mass_con_to_bounds, const bool verbose) {
+              const bool prefer_mass_con_to_bounds, const bool verbose,
+              const bool split_run) {
   CDR::Options options;
   options.prefer_numerical_mass_conservation_to_numerical_bounds =
     prefer_mass_con_to_bounds;
-  return TestQLT(p, tree, ncells, external_memory, verbose, options)
+  return TestQLT(p, tree, ncells, external_memory, split_run, verbose, options)
     .run<TestQLT::QLTT>(nrepeat, write);
 }
 } // namespace test
@@ -753,6 +795,8 @@ Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
       for (bool imbalanced : {false, true}) {
         for (bool prefer_mass_con_to_bounds : {false, true}) {
           const auto external_memory = imbalanced;
+          // Exercise the split-phase run in half of the configurations.
+          const auto split_run = prefer_mass_con_to_bounds != imbalanced;
           if (p->amroot()) {
             std::cout << " (" << szs[is] << ", " << id << ", " << imbalanced << ", "
                       << prefer_mass_con_to_bounds << ")";
@@ -763,7 +807,7 @@ Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
           const bool write = (write_requested && m.ncell() < 3000 &&
                               is == islim-1 && id == idlim-1);
           nerr += test::test_qlt(p, tree, m.ncell(), 1, write, external_memory,
-                                 prefer_mass_con_to_bounds, false);
+                                 prefer_mass_con_to_bounds, false, split_run);
         }
       }
     }
@@ -185,6 +185,14 @@ public:
 
   void run() override;
 
+  // Run the leaf levels that need no data from other ranks, send their
+  // results to the parents, and post the receives for the first level that
+  // does.
+  void run_start() override;
+
+  // Run the rest of the leaves-to-root sweep and the root-to-leaves sweep.
+  void run_finish() override;
+
 protected:
   static void init(const std::string& name, IntList& d,
                    typename IntList::HostMirror& h, size_t n);
@@ -207,9 +215,15 @@ protected:
   // end_tracer_declarations().
   typename MetaDataBuilder::Ptr mdb_;
   DeviceOp o;
+  // First level of the leaves-to-root sweep not yet done by run_start.
+  size_t run_lvl_;
+  // Whether run_start posted the receives for level run_lvl_.
+  bool run_lvl_recv_posted_;
 
 PRIVATE_CUDA:
   void l2r_recv(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_post_recv(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_wait(const tree::NodeSets::Level& lvl) const;
   void l2r_combine_kid_data(const Int& lvlidx, const Int& l2rndps) const;
   void l2r_send_to_parents(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
   void root_compute(const Int& l2rndps, const Int& r2lndps) const;
@@ -237,7 +251,9 @@ Int test_qlt(const Parallel::Ptr& p, const tree::Node::Ptr& tree, const Int& nce
              const bool external_memory,
              // Set CDR::Options.prefer_numerical_mass_conservation_to_numerical_bounds.
              const bool prefer_mass_con_to_bounds,
-             const bool verbose);
+             const bool verbose,
+             // Call run_start and run_finish instead of run.
+             const bool split_run = false);
 } // namespace test
 } // namespace qlt
 } // namespace cedr
@@ -3,6 +3,9 @@
 #include "compose_kokkos.hpp"
 #include "cedr_bfb_tree_allreduce.hpp"
 
+#include <cfloat>
+#include <cmath>
+
 namespace ko = Kokkos;
 
 namespace homme {
@@ -338,6 +341,10 @@ Int test_tree_maker () {
 extern "C"
 void compose_repro_sum(const Real* send, Real* recv,
                        Int nlocal, Int nfld, Int fcomm);
+extern "C"
+void compose_repro_sum_finish(const Real* send, Real* recv,
+                              Int nlocal, Int nfld, Int fcomm,
+                              const Int* gextremes, Int tot_summands);
 
 template <typename MT>
 struct ReproSumReducer :
@@ -376,12 +383,78 @@ struct ReproSumReducer :
     return 0;
   }
 
+  // The fixed-point sum needs the global summand count and the global exponent
+  // extrema of the summands before it can do its own reduction. start posts
+  // nonblocking reductions for these, and finish passes them to
+  // compose_repro_sum_finish, so the result is BFB with operator(). Only the
+  // first of the two dependent reductions overlaps the caller's work.
+  int start (const cedr::mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+             int nlocal, int count, MPI_Op op) const override {
+    cedr_assert(op == MPI_SUM);
+    sendptr_ = sendbuf;
+    rcvptr_ = rcvbuf;
+    rcvbuf_ = rcvbuf;
+    nlocal_ = nlocal;
+    count_ = count;
+    if (ko::OnGpu<typename MT::DES>::value) {
+      if (send.size() == 0) {
+        send = typename RealList::HostMirror("send", nlocal*count);
+        recv = typename RealList::HostMirror("recv", count);
+      }
+      cedr_assert(static_cast<int>(send.size()) == nlocal*count);
+      ko::deep_copy(send, ConstRealList(sendbuf, nlocal*count));
+      sendptr_ = send.data();
+      rcvptr_ = recv.data();
+    }
+    // As in repro_sum: max and min exponent over the nonzero summands of each
+    // field, packed so one MPI_MIN reduces both.
+    lextremes_.resize(2*count);
+    gextremes_.resize(2*count);
+    for (int k = 0; k < count; ++k) {
+      int lmax = DBL_MIN_EXP, lmin = DBL_MAX_EXP;
+      for (int i = 0; i < nlocal; ++i) {
+        const Real v = sendptr_[nlocal*k + i];
+        if (v == 0) continue;
+        int e;
+        std::frexp(v, &e);
+        lmax = std::max(lmax, e);
+        lmin = std::min(lmin, e);
+      }
+      lextremes_[        k] = -lmax;
+      lextremes_[count + k] =  lmin;
+    }
+    const auto comm = MPI_Comm_f2c(fcomm_);
+    int err = MPI_Iallreduce(&nlocal_, &tot_summands_, 1, MPI_INT, MPI_SUM, comm,
+                             &reqs_[0]);
+    if (err != MPI_SUCCESS) return err;
+    err = MPI_Iallreduce(lextremes_.data(), gextremes_.data(), 2*count, MPI_INT,
+                         MPI_MIN, comm, &reqs_[1]);
+    return err;
+  }
+
+  int finish () const override {
+    const int err = MPI_Waitall(2, reqs_, MPI_STATUSES_IGNORE);
+    if (err != MPI_SUCCESS) return err;
+    compose_repro_sum_finish(sendptr_, rcvptr_, nlocal_, count_, fcomm_,
+                             gextremes_.data(), tot_summands_);
+    if (ko::OnGpu<typename MT::DES>::value)
+      ko::deep_copy(RealList(rcvbuf_, count_), recv);
+    return 0;
+  }
+
 private:
   typedef Kokkos::View<Real*, typename MT::DES> RealList;
   typedef Kokkos::View<const Real*, typename MT::DES> ConstRealList;
 
   mutable typename RealList::HostMirror send, recv;
   const Int fcomm_, n_accum_in_place_;
+
+  // State of a start/finish pair.
+  mutable const Real* sendptr_;
+  mutable Real* rcvptr_, * rcvbuf_;
+  mutable int nlocal_, count_, tot_summands_;
+  mutable std::vector<int> lextremes_, gextremes_;
+  mutable MPI_Request reqs_[2];
 };
 
 template <typename MT>
@@ -750,6 +823,15 @@ void cedr_sl_run_global () {
                                            0, g_sl->ta->nelemd - 1);
 }
 
+void cedr_sl_run_global_start () {
+  homme::sl::run_global_start<ko::MachineTraits>(*g_cdr, *g_sl, nullptr, nullptr,
+                                                 0, g_sl->ta->nelemd - 1);
+}
+
+void cedr_sl_run_global_finish () {
+  homme::sl::run_global_finish<ko::MachineTraits>(*g_cdr);
+}
+
 void cedr_sl_run_local (const int limiter_option) {
   homme::sl::run_local(*g_cdr, *g_sl, nullptr, nullptr, 0, g_sl->ta->nelemd - 1,
                        false, limiter_option);
@@ -23,6 +23,9 @@ struct CAAS : public cedr::caas::CAAS<Kokkos::Serial> {
   {}
 
   void run () override { run_horiz_omp(); }
+  // run_horiz_omp has no split phase.
+  void run_start () override { run_horiz_omp(); }
+  void run_finish () override {}
 
 private:
   void run_horiz_omp();
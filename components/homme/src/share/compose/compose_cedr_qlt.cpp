@@ -194,6 +194,21 @@ void QLT<ES>::run () {
     runimpl();
 }
 
+// runimpl has no split phase, so on host all the work is done in run_start.
+template <typename ES>
+void QLT<ES>::run_start () {
+  if (ko::OnGpu<ES>::value)
+    Super::run_start();
+  else
+    runimpl();
+}
+
+template <typename ES>
+void QLT<ES>::run_finish () {
+  if (ko::OnGpu<ES>::value)
+    Super::run_finish();
+}
+
 template <typename ES>
 void QLT<ES>::runimpl () {
   static const int mpitag = 42;
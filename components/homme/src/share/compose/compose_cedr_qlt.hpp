@@ -25,6 +25,8 @@ public:
       const cedr::Int& vertical_levels);
 
   void run() override;
+  void run_start() override;
+  void run_finish() override;
 
   static Int unittest();
 };
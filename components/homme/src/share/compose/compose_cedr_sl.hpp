@@ -51,6 +51,14 @@ template <typename MT>
 void run_global(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
                 const Int nets, const Int nete);
 
+// Split-phase run_global: run_global_start sets up the CDR and starts its
+// global communication, and run_global_finish completes it.
+template <typename MT>
+void run_global_start(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
+                      const Int nets, const Int nete);
+template <typename MT>
+void run_global_finish(CDR<MT>& cdr);
+
 template <typename MT>
 void run_local(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
                const Int nets, const Int nete, const bool scalar_bounds,
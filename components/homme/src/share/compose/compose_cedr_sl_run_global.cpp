@@ -41,11 +41,16 @@ COMPOSE_FUNCTION ko::EnableIfOnGpu<MT> warn_on_Qm_prev_negative (
 {}
 
 template <typename MT>
-static void run_cdr (CDR<MT>& q) {
+static void run_cdr_start (CDR<MT>& q) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
-  q.cdr->run();
+  q.cdr->run_start();
+}
+
+template <typename MT>
+static void run_cdr_finish (CDR<MT>& q) {
+  q.cdr->run_finish();
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
@@ -174,8 +179,8 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 }
 
 template <typename MT>
-void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
-                 const Int nets, const Int nete) {
+void run_global_start (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
+                       const Int nets, const Int nete) {
   if (dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()))
     run_global<4, MT, typename CDR<MT>::QLTT>(
       cdr, dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()),
@@ -187,13 +192,31 @@ void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r
   else
     cedr_throw_if(true, "run_global: could not cast cdr.");
   ko::fence();
-  { Timer t("02_run_cdr");
-    run_cdr(cdr); }
+  { Timer t("02_run_cdr_start");
+    run_cdr_start(cdr); }
+}
+
+template <typename MT>
+void run_global_finish (CDR<MT>& cdr) {
+  Timer t("03_run_cdr_finish");
+  run_cdr_finish(cdr);
+}
+
+template <typename MT>
+void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
+                 const Int nets, const Int nete) {
+  run_global_start(cdr, d, q_min_r, q_max_r, nets, nete);
+  run_global_finish(cdr);
 }
 
 template void
 run_global(CDR<ko::MachineTraits>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
            const Int nets, const Int nete);
+template void
+run_global_start(CDR<ko::MachineTraits>& cdr, const Data& d, Real* q_min_r,
+                 const Real* q_max_r, const Int nets, const Int nete);
+template void
+run_global_finish(CDR<ko::MachineTraits>& cdr);
 
 } // namespace sl
 } // namespace homme
@@ -8,6 +8,8 @@ islmpi::IslMpi<>::Ptr get_isl_mpi_singleton();
 
 bool cedr_should_run();
 void cedr_sl_run_global();
+void cedr_sl_run_global_start();
+void cedr_sl_run_global_finish();
 void cedr_sl_run_local(const int limiter_option);
 void cedr_sl_check();
 
@@ -55,12 +57,36 @@ void set_dp3d_np1 (const int np1) {
   cm.tracer_arrays->np1 = np1;
 }
 
+void set_persistent_comm (const bool use) {
+  const auto cm = get_isl_mpi_singleton();
+  slmm_throw_if( ! cm, "set_persistent_comm was called before the SL transport"
+                 " was initialized.\n");
+  islmpi::set_persistent_comm(*cm, use);
+}
+
+void set_batch_tracer_interp (const bool use) {
+  const auto cm = get_isl_mpi_singleton();
+  slmm_throw_if( ! cm, "set_batch_tracer_interp was called before the SL"
+                 " transport was initialized.\n");
+  cm->batch_tracer_interp = use;
+}
+
 bool property_preserve_global () {
   if ( ! cedr_should_run()) return false;
   homme::cedr_sl_run_global();
   return true;
 }
 
+bool property_preserve_global_start () {
+  if ( ! cedr_should_run()) return false;
+  homme::cedr_sl_run_global_start();
+  return true;
+}
+
+void property_preserve_global_finish () {
+  homme::cedr_sl_run_global_finish();
+}
+
 bool property_preserve_local (const int limiter_option) {
   if ( ! cedr_should_run()) return false;
   homme::cedr_sl_run_local(limiter_option);
@@ -17,7 +17,17 @@ void set_views(const SetView<double***>& spheremp,
 void advect(const int np1, const int n0_qdp, const int np1_qdp);
 
 void set_dp3d_np1(const int np1);
+// Use persistent MPI requests in the SL step's communication. Call after the
+// SL transport is initialized.
+void set_persistent_comm(const bool use);
+// Interpolate all tracers at a departure point with one set of weights.
+void set_batch_tracer_interp(const bool use);
 bool property_preserve_global();
+// Split-phase property_preserve_global. Call property_preserve_global_finish
+// only if property_preserve_global_start returned true. Between the two calls,
+// the caller may run work that does not touch the tracer arrays.
+bool property_preserve_global_start();
+void property_preserve_global_finish();
 bool property_preserve_local(const int limiter_option);
 void property_preserve_check();
 
@@ -346,6 +346,16 @@ void slmm_set_bufs (homme::Real* sendbuf, homme::Real* recvbuf,
 
 void slmm_set_null_bufs () { slmm_set_bufs(nullptr, nullptr, 0, 0); }
 
+void slmm_set_persistent_comm (const bool use) {
+  slmm_assert(homme::g_csl_mpi);
+  homme::islmpi::set_persistent_comm(*homme::g_csl_mpi, use);
+}
+
+void slmm_set_batch_tracer_interp (const bool use) {
+  slmm_assert(homme::g_csl_mpi);
+  homme::g_csl_mpi->batch_tracer_interp = use;
+}
+
 void slmm_get_mpi_pattern (homme::Int* sl_mpi) {
   *sl_mpi = homme::g_csl_mpi ? 1 : 0;
 }
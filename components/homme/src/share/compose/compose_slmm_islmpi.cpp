@@ -26,6 +26,21 @@ Request::~Request () {
 }
 #endif
 
+int start (Request* req) {
+#ifdef COMPOSE_DEBUG_MPI
+  req->unfreed++;
+#endif
+  return MPI_Start(&req->request);
+}
+
+int request_free (Request* req) {
+  return MPI_Request_free(&req->request);
+}
+
+int cancel (Request* req) {
+  return MPI_Cancel(&req->request);
+}
+
 int waitany (int count, Request* reqs, int* index, MPI_Status* stats) {
 #ifdef COMPOSE_DEBUG_MPI
   std::vector<MPI_Request> vreqs(count);
@@ -738,6 +753,7 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf, Real* recvbuf) {
   cm.bla_h = cm.bla.mirror();
   cm.sendbuf.init(nrmtrank, cm.sendsz.data(), sendbuf);
   cm.recvbuf.init(nrmtrank, cm.recvsz.data(), recvbuf);
+  cm.own_recvbuf = recvbuf == nullptr;
 #ifdef COMPOSE_MPI_ON_HOST
   cm.sendbuf_h = cm.sendbuf.mirror();
   cm.recvbuf_h = cm.recvbuf.mirror();
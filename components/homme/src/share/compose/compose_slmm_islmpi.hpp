@@ -82,6 +82,23 @@ int irecv (const Parallel& p, T* buf, int count, int src, int tag, Request* ireq
   return ret;
 }
 
+template <typename T>
+int send_init (const Parallel& p, const T* buf, int count, int dest, int tag,
+               Request* ireq) {
+  return MPI_Send_init(const_cast<T*>(buf), count, get_type<T>(), dest, tag,
+                       p.comm(), &ireq->request);
+}
+
+template <typename T>
+int recv_init (const Parallel& p, T* buf, int count, int src, int tag,
+               Request* ireq) {
+  return MPI_Recv_init(buf, count, get_type<T>(), src, tag, p.comm(),
+                       &ireq->request);
+}
+
+int start(Request* req);
+int request_free(Request* req);
+int cancel(Request* req);
 int waitany(int count, Request* reqs, int* index, MPI_Status* stats = nullptr);
 int waitall(int count, Request* reqs, MPI_Status* stats = nullptr);
 int wait(Request* req, MPI_Status* stat = nullptr);
@@ -537,6 +554,34 @@ struct IslMpi {
   FixedCapList<Int, DDT> rmt_xs, rmt_qs_extrema;
   Int nrmt_xs, nrmt_qs_extrema;
 
+  // Persistent-request mode. If persistent_comm is true, the two exchanges in
+  // step (departure points, then q) start requests created once with
+  // MPI_Send_init and MPI_Recv_init instead of posting new ones. Peers and
+  // buffers are fixed after init, and messages are self-describing, so a send
+  // request built with a count at least as large as the current message is
+  // reused; it is rebuilt, with some headroom, only when a message outgrows
+  // it. One recv request per rank, with the whole buffer as count, serves both
+  // exchanges. Index [0] is the departure-point exchange, [1] the q exchange.
+  bool persistent_comm;
+  mpi::Parallel::Ptr persistent_p; // on a duplicate of p's communicator
+  FixedCapList<mpi::Request, HDT> persistent_sendreq[2], persistent_recvreq;
+  std::vector<Int> persistent_sendcnt[2]; // count of the send request; 0 if none
+  std::vector<char> persistent_active[2]; // ranks sent to in the previous step
+  Int persistent_nrecv_started;
+  // The departure-point recvs of the next step were started at the end of
+  // the previous one. Done only if the recv buffers are not shared.
+  bool persistent_recv_started, own_recvbuf;
+  // Number of steps in persistent mode; of those, the number in which the set
+  // of ranks sent to or a send request changed; and the number of send
+  // requests rebuilt.
+  Int persistent_nstep, persistent_npattern_change, persistent_nrebuild;
+  bool persistent_pattern_changed; // in the current step
+
+  // If true, calc_own_q and calc_rmt_q form the interpolation weights for a
+  // departure point once and apply them to all tracers in a loop over tracers.
+  // Not BFB with the default, which interpolates tracer by tracer.
+  bool batch_tracer_interp;
+
   // Mirror views.
   typename FixedCapList<Int, DDT>::Mirror nx_in_rank_h, sendcount_h,
     x_bulkdata_offset_h, rmt_xs_h, rmt_qs_extrema_h, mylid_with_comm_h;
@@ -563,13 +608,34 @@ struct IslMpi {
           Int inp, Int inlev, Int iqsize, Int iqsized, Int inelemd, Int ihalo)
     : p(ip), advecter(advecter),
       np(inp), np2(np*np), nlev(inlev), qsize(iqsize), qsized(iqsized), nelemd(inelemd),
-      halo(ihalo), tracer_arrays(tracer_arrays_)
+      halo(ihalo), tracer_arrays(tracer_arrays_), persistent_comm(false),
+      persistent_nrecv_started(0), persistent_recv_started(false),
+      own_recvbuf(false), persistent_nstep(0),
+      persistent_npattern_change(0), persistent_nrebuild(0),
+      persistent_pattern_changed(false), batch_tracer_interp(false)
   {}
 
   IslMpi(const IslMpi&) = delete;
   IslMpi& operator=(const IslMpi&) = delete;
 
   ~IslMpi () {
+    int fin = 1;
+    MPI_Finalized(&fin);
+    if ( ! fin && persistent_recvreq.capacity() > 0) {
+      for (Int ri = 0; ri < persistent_recvreq.n(); ++ri) {
+        if (persistent_recv_started) {
+          mpi::cancel(&persistent_recvreq(ri));
+          mpi::wait(&persistent_recvreq(ri));
+        }
+        mpi::request_free(&persistent_recvreq(ri));
+      }
+      for (Int xi = 0; xi < 2; ++xi)
+        for (Int ri = 0; ri < persistent_sendreq[xi].n(); ++ri)
+          if (persistent_sendcnt[xi][ri] > 0)
+            mpi::request_free(&persistent_sendreq[xi](ri));
+      MPI_Comm comm = persistent_p->comm();
+      MPI_Comm_free(&comm);
+    }
 #ifdef COMPOSE_HORIZ_OPENMP
     const Int nrmtrank = static_cast<Int>(ranks.n()) - 1;
     for (Int ri = 0; ri < nrmtrank; ++ri) {
@@ -634,6 +700,10 @@ template <typename MT>
 void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty = false);
 template <typename MT>
 void recv(IslMpi<MT>& cm, const bool skip_if_empty = false);
+template <typename MT>
+void finish_persistent_step(IslMpi<MT>& cm);
+template <typename MT>
+void set_persistent_comm(IslMpi<MT>& cm, const bool use);
 
 const int nreal_per_2int = (2*sizeof(Int) + sizeof(Real) - 1) / sizeof(Real);
 
@@ -66,6 +66,22 @@ SLMM_KF ko::EnableIfOnGpu<MT> throw_on_sci_error (
   ko::abort("throw_on_sci_error");
 }
 
+// In persistent-comm mode, the departure points usually stay in the same
+// source cells from one step to the next, so try the previous step's cell
+// before searching the local mesh.
+template <typename ES, typename ElemData> SLMM_KIF
+Int find_src_cell (const slmm::LocalMesh<ES>& mesh, const ElemData& ed,
+                   const bool reuse_src, const Real* v, const Int lev,
+                   const Int k, const Int tgt_idx) {
+  if (reuse_src) {
+    const Int sci = ed.src(lev,k);
+    if (sci != tgt_idx && ! slmm::is_inside(mesh, v, 0, tgt_idx) &&
+        slmm::is_inside(mesh, v, 0, sci))
+      return sci;
+  }
+  return slmm::get_src_cell(mesh, v, tgt_idx);
+}
+
 // Find where each departure point is.
 template <typename MT>
 void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
@@ -84,6 +100,7 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       cm.advecter->nearest_point_permitted_lev_bdy();
     const auto& local_meshes = cm.advecter->local_meshes();
     const auto& ed_d = cm.ed_d;
+    const bool reuse_src = cm.persistent_comm && cm.persistent_nstep > 0;
     const auto& nx_in_lid = cm.nx_in_lid;
     const auto& bla = cm.bla;
     const auto& nx_in_rank = cm.nx_in_rank;
@@ -94,7 +111,8 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       const auto& mesh = local_meshes(tci);
       const auto tgt_idx = mesh.tgt_elem;
       auto& ed = ed_d(tci);
-      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+      Int sci = find_src_cell(mesh, ed, reuse_src, &dep_points(tci,lev,k,0),
+                              lev, k, tgt_idx);
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
@@ -147,6 +165,7 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       cm.advecter->nearest_point_permitted_lev_bdy();
     const auto& local_meshes = cm.advecter->local_meshes();
     const auto& ed_d = cm.ed_d;
+    const bool reuse_src = cm.persistent_comm && cm.persistent_nstep > 0;
     const auto& bla = cm.bla;
     const auto& nx_in_lid = cm.nx_in_lid;
 #ifdef COMPOSE_HORIZ_OPENMP
@@ -167,7 +186,8 @@ void analyze_dep_points (IslMpi<MT>& cm, const Int& nets, const Int& nete,
       const auto& mesh = local_meshes(tci);
       const auto tgt_idx = mesh.tgt_elem;
       auto& ed = ed_d(tci);
-      Int sci = slmm::get_src_cell(mesh, &dep_points(tci,lev,k,0), tgt_idx);
+      Int sci = find_src_cell(mesh, ed, reuse_src, &dep_points(tci,lev,k,0),
+                              lev, k, tgt_idx);
       if (sci == -1) {
         const bool npp = slmm::Advecter<MT>::nearest_point_permitted(
           nearest_point_permitted_lev_bdy, lev);
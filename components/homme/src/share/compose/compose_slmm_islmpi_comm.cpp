@@ -37,12 +37,78 @@ void init_mylid_with_comm_threaded (IslMpi<MT>& cm, const Int& nets, const Int&
 #endif
 }
 
+// In step, the departure-point exchange calls setup_irecv and isend with
+// skip_if_empty = false and the q exchange with skip_if_empty = true, so
+// skip_if_empty gives the index of the exchange's persistent requests.
+//   The requests live on a duplicate of the SL communicator. Then the
+// departure-point recvs started at the end of a step can't match messages that
+// other code, such as CEDR, sends with the same tag between steps.
+template <typename MT>
+void init_persistent_requests (IslMpi<MT>& cm) {
+  MPI_Comm comm;
+  MPI_Comm_dup(cm.p->comm(), &comm);
+  cm.persistent_p = mpi::make_parallel(comm);
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  cm.persistent_recvreq.reset_capacity(nrmtrank, true);
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+#ifdef COMPOSE_MPI_ON_HOST
+    auto&& recvbuf = cm.recvbuf_h(ri);
+#else
+    auto&& recvbuf = cm.recvbuf.get_h(ri);
+#endif
+    mpi::recv_init(*cm.persistent_p, recvbuf.data(), recvbuf.n(),
+                   cm.ranks(ri), 42, &cm.persistent_recvreq(ri));
+  }
+  for (Int xi = 0; xi < 2; ++xi) {
+    cm.persistent_sendreq[xi].reset_capacity(nrmtrank, true);
+    cm.persistent_sendcnt[xi].assign(nrmtrank, 0);
+    cm.persistent_active[xi].assign(nrmtrank, 0);
+  }
+}
+
+template <typename MT>
+void setup_irecv_persistent (IslMpi<MT>& cm, const bool skip_if_empty) {
+  if (cm.persistent_recvreq.capacity() == 0) init_persistent_requests(cm);
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  Int n = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+    if (skip_if_empty && cm.nx_in_rank_h(ri) == 0) continue;
+    mpi::start(&cm.persistent_recvreq(ri));
+    ++n;
+  }
+  cm.persistent_nrecv_started = n;
+}
+
+template <typename MT>
+void cancel_persistent_recv (IslMpi<MT>& cm) {
+  if ( ! cm.persistent_recv_started) return;
+  for (Int ri = 0; ri < cm.persistent_recvreq.n(); ++ri) {
+    mpi::cancel(&cm.persistent_recvreq(ri));
+    mpi::wait(&cm.persistent_recvreq(ri));
+  }
+  cm.persistent_recv_started = false;
+}
+
+// Call outside of a threaded region.
+template <typename MT>
+void set_persistent_comm (IslMpi<MT>& cm, const bool use) {
+  // The departure-point recvs of the next step may already be started; they
+  // must not compete with the irecvs of the non-persistent path.
+  if ( ! use) cancel_persistent_recv(cm);
+  cm.persistent_comm = use;
+}
+
 template <typename MT>
 void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp master
 #endif
-  {
+  if (cm.persistent_comm) {
+    // finish_persistent_step already started the departure-point recvs.
+    if (skip_if_empty || ! cm.persistent_recv_started)
+      setup_irecv_persistent(cm, skip_if_empty);
+    cm.persistent_recv_started = false;
+  } else {
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
     cm.recvreq.clear();
     for (Int ri = 0, nri = 0; ri < nrmtrank; ++ri) {
@@ -62,13 +128,60 @@ void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty) {
   }
 }
 
+template <typename MT>
+void isend_persistent (IslMpi<MT>& cm, const bool skip_if_empty) {
+  const Int xi = skip_if_empty ? 1 : 0;
+  auto& sendreq = cm.persistent_sendreq[xi];
+  auto& sendcnt = cm.persistent_sendcnt[xi];
+  auto& active = cm.persistent_active[xi];
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  Int nrebuild = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+    const Int cnt = cm.sendcount_h(ri);
+    const bool on = ! skip_if_empty || cnt > 0;
+    if (on != static_cast<bool>(active[ri])) {
+      active[ri] = on;
+      cm.persistent_pattern_changed = true;
+    }
+    if ( ! on) continue;
+#ifdef COMPOSE_MPI_ON_HOST
+    auto&& sendbuf = cm.sendbuf_h(ri);
+    typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+    typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+    Kokkos::deep_copy(ArrayH(sendbuf.data(), cnt),
+                      ArrayD(cm.sendbuf.get_h(ri).data(), cnt));
+#else
+    auto&& sendbuf = cm.sendbuf.get_h(ri);
+#endif
+    if (cnt > sendcnt[ri]) {
+      // The request is inactive here, as the previous step waited on it.
+      if (sendcnt[ri] > 0) mpi::request_free(&sendreq(ri));
+      // Headroom so that small fluctuations in the message size don't trigger a
+      // rebuild every step. The remote recv buffer has the same size as
+      // sendbuf, and the trailing entries are ignored by the receiver.
+      sendcnt[ri] = std::min<Int>(cnt + cnt/8, sendbuf.n());
+      mpi::send_init(*cm.persistent_p, sendbuf.data(), sendcnt[ri],
+                     cm.ranks(ri), 42, &sendreq(ri));
+      ++nrebuild;
+    }
+    mpi::start(&sendreq(ri));
+  }
+  if (nrebuild > 0) {
+    cm.persistent_nrebuild += nrebuild;
+    cm.persistent_pattern_changed = true;
+    slmm::timer_count("request_rebuild", nrebuild);
+  }
+}
+
 template <typename MT>
 void isend (IslMpi<MT>& cm, const bool want_req, const bool skip_if_empty) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 # pragma omp master
 #endif
-  {
+  if (cm.persistent_comm && want_req) {
+    isend_persistent(cm, skip_if_empty);
+  } else {
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
     for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.sendcount_h(ri) == 0) continue;
@@ -93,9 +206,12 @@ void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty) {
 # pragma omp master
 #endif
   {
-    for (Int ri = 0; ri < cm.sendreq.n(); ++ri) {
+    auto& sendreq = (cm.persistent_comm ?
+                     cm.persistent_sendreq[skip_if_empty ? 1 : 0] :
+                     cm.sendreq);
+    for (Int ri = 0; ri < sendreq.n(); ++ri) {
       if (skip_if_empty && cm.sendcount_h(ri) == 0) continue;
-      mpi::wait(&cm.sendreq(ri));
+      mpi::wait(&sendreq(ri));
     }
   }
 #ifdef COMPOSE_HORIZ_OPENMP
@@ -105,23 +221,31 @@ void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty) {
 
 template <typename MT>
 void wait_on_recv (IslMpi<MT>& cm) {
-#ifdef COMPOSE_MPI_ON_HOST
-  typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
-  typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
-  const int nreq = cm.recvreq.n();
-  for (Int i = 0; i < nreq; ++i) {
+#ifndef COMPOSE_MPI_ON_HOST
+  if ( ! cm.persistent_comm) {
+    mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
+    return;
+  }
+#endif
+  // persistent_recvreq has a request for every remote rank, indexed by rank,
+  // of which persistent_nrecv_started are active. waitany skips inactive ones.
+  auto& recvreq = cm.persistent_comm ? cm.persistent_recvreq : cm.recvreq;
+  const int nreq = recvreq.n();
+  const int nwait = cm.persistent_comm ? cm.persistent_nrecv_started : nreq;
+  for (Int i = 0; i < nwait; ++i) {
     Int reqi;
     MPI_Status stat;
-    mpi::waitany(nreq, cm.recvreq.data(), &reqi, &stat);
-    const Int ri = cm.recvreq_ri(reqi);
+    mpi::waitany(nreq, recvreq.data(), &reqi, &stat);
+#ifdef COMPOSE_MPI_ON_HOST
+    typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+    typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+    const Int ri = cm.persistent_comm ? reqi : cm.recvreq_ri(reqi);
     int count;
     MPI_Get_count(&stat, mpi::get_type<Real>(), &count);
     Kokkos::deep_copy(ArrayD(cm.recvbuf.get_h(ri).data(), count),
                       ArrayH(cm.recvbuf_h(ri).data(), count));
-  }
-#else
-  mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
 #endif
+  }
 }
 
 template <typename MT>
@@ -130,7 +254,8 @@ void recv_and_wait_on_send (IslMpi<MT>& cm) {
 # pragma omp master
 #endif
   {
-    mpi::waitall(cm.sendreq.n(), cm.sendreq.data());
+    auto& sendreq = cm.persistent_comm ? cm.persistent_sendreq[0] : cm.sendreq;
+    mpi::waitall(sendreq.n(), sendreq.data());
     wait_on_recv(cm);
   }
 #ifdef COMPOSE_HORIZ_OPENMP
@@ -151,6 +276,29 @@ void recv (IslMpi<MT>& cm, const bool skip_if_empty) {
 #endif
 }
 
+template <typename MT>
+void finish_persistent_step (IslMpi<MT>& cm) {
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp master
+#endif
+  {
+    ++cm.persistent_nstep;
+    if (cm.persistent_pattern_changed) {
+      ++cm.persistent_npattern_change;
+      slmm::timer_count("pattern_change", 1);
+    }
+    cm.persistent_pattern_changed = false;
+    // Every recv request is inactive now, so start the next step's
+    // departure-point recvs here rather than at the start of the next step.
+    // This is possible only if no one else, such as CEDR, uses the recv
+    // buffers between steps.
+    if (cm.own_recvbuf) {
+      setup_irecv_persistent(cm, false);
+      cm.persistent_recv_started = true;
+    }
+  }
+}
+
 template void init_mylid_with_comm_threaded(
   IslMpi<ko::MachineTraits>& cm, const Int& nets, const Int& nete);
 template void setup_irecv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
@@ -159,6 +307,8 @@ template void isend(IslMpi<ko::MachineTraits>& cm, const bool want_req,
 template void recv_and_wait_on_send(IslMpi<ko::MachineTraits>& cm);
 template void wait_on_send(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
 template void recv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
+template void finish_persistent_step(IslMpi<ko::MachineTraits>& cm);
+template void set_persistent_comm(IslMpi<ko::MachineTraits>& cm, const bool use);
 
 } // namespace islmpi
 } // namespace homme
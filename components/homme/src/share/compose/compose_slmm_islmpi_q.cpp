@@ -185,6 +185,17 @@ SLMM_KIF Real calc_q_tgt (const Real rx[4], const Real ry[4], const Real qdp[16]
                  rx[2]*(qdp[14]/dp[14]) + rx[3]*(qdp[15]/dp[15])));
 }
 
+// Tensor-product interpolation weights w[4*j + i] = ry[j] rx[i] at the 16 GLL
+// nodes. Used in the batch_tracer_interp mode, in which the weights for a
+// departure point are formed once and then applied to all tracers in a loop
+// over tracers that vectorizes. If there is a dp array, the weights are also
+// divided by dp, so that each tracer needs just a dot product with qdp.
+SLMM_KIF void calc_weights (const Real rx[4], const Real ry[4], Real w[16]) {
+  for (Int j = 0; j < 4; ++j)
+    for (Int i = 0; i < 4; ++i)
+      w[4*j + i] = ry[j]*rx[i];
+}
+
 template <typename Buffer> SLMM_KIF
 Int getbuf (Buffer& buf, const Int& os, Int& i1, Int& i2) {
   const Int* const b = reinterpret_cast<const Int*>(&buf(os));
@@ -196,6 +207,24 @@ Int getbuf (Buffer& buf, const Int& os, Int& i1, Int& i2) {
 #ifndef COMPOSE_PORT
 // Homme computational pattern.
 
+// q_tgt[iq] = w . q0[iq*stride : iq*stride + 16], blocked over iq.
+template <Int blocksize>
+void calc_q_tgt_batched (const Real w[16], const Real* const q0, const Int stride,
+                         const Int qsize, Real* const q_tgt) {
+  for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
+    const Int n = std::min(blocksize, qsize - iqo);
+    Real tmp[blocksize] = {0};
+    for (Int k = 0; k < 16; ++k) {
+      const Real wk = w[k];
+      const Real* const qk = q0 + iqo*stride + k;
+      for (Int iqi = 0; iqi < n; ++iqi)
+        tmp[iqi] += wk*qk[iqi*stride];
+    }
+    for (Int iqi = 0; iqi < n; ++iqi)
+      q_tgt[iqo + iqi] = tmp[iqi];
+  }
+}
+
 template <Int np, typename MT>
 void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
              const Real* const dep_point, Real* const q_tgt, const bool use_q) {
@@ -215,6 +244,18 @@ void calc_q (const IslMpi<MT>& cm, const Int& src_lid, const Int& lev,
   const Int np2nlev = np*np*cm.nlev;
   const Int qsize = cm.qsize;
   static const Int blocksize = 8;
+  if (cm.batch_tracer_interp) {
+    Real w[16];
+    calc_weights(rx, ry, w);
+    if (use_q) {
+      calc_q_tgt_batched<blocksize>(w, ed.q + levos, np2nlev, qsize, q_tgt);
+    } else {
+      const Real* const dp = ed.dp + levos;
+      for (Int k = 0; k < 16; ++k) w[k] /= dp[k];
+      calc_q_tgt_batched<blocksize>(w, ed.qdp + levos, np2nlev, qsize, q_tgt);
+    }
+    return;
+  }
   if (use_q) {
     // We can use q from calc_q_extrema.
     const Real* const qs0 = ed.q + levos;
@@ -373,6 +414,7 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
   const auto alg = cm.advecter->alg();
   const auto& own_dep_list = cm.own_dep_list;
   const Int qsize = cm.qsize;
+  const bool batch = cm.batch_tracer_interp;
   static const Int blocksize = 8;
   const auto f = COMPOSE_LAMBDA (const Int& it) {
     const Int tci = own_dep_list(it,0);
@@ -389,6 +431,21 @@ void calc_own_q (IslMpi<MT>& cm, const Int& nets, const Int& nete,
     calc_coefs<np,MT>(s2r, local_meshes(slid), alg, slid, tgt_lev,
                       &dep_points(tci, tgt_lev, tgt_k, 0), rx, ry);
     // q from calc_q_extrema is being overwritten, so have to use qdp/dp.
+    if (batch) {
+      Real w[16];
+      calc_weights(rx, ry, w);
+      for (Int k = 0; k < 16; ++k) w[k] /= dp_src(slid, k, tgt_lev);
+      for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
+        const Int n = iqo + blocksize <= qsize ? blocksize : qsize - iqo;
+        Real tmp[blocksize] = {0};
+        for (Int k = 0; k < 16; ++k)
+          for (Int iqi = 0; iqi < n; ++iqi)
+            tmp[iqi] += w[k]*qdp_src(slid, qtl, iqo + iqi, k, tgt_lev);
+        for (Int iqi = 0; iqi < n; ++iqi)
+          q_tgt(tci, iqo + iqi, tgt_k, tgt_lev) = tmp[iqi];
+      }
+      return;
+    }
     Real dp[16];
     for (Int k = 0; k < 16; ++k) dp[k] = dp_src(slid, k, tgt_lev);
     // Block for auto-vectorization.
@@ -555,6 +612,7 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
   const auto& s2r = cm.advecter->s2r();
   const auto& local_meshes = cm.advecter->local_meshes();
   const auto alg = cm.advecter->alg();
+  const bool batch = cm.batch_tracer_interp;
   static const Int blocksize = 8;
 
   const auto fx = COMPOSE_LAMBDA (const Int& it) {
@@ -566,6 +624,20 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
     Real rx[4], ry[4];
     calc_coefs<np,MT>(s2r, local_meshes(lid), alg, lid, lev, &xs(xos), rx, ry);
     Real* const q_tgt = &qs(qos);
+    if (batch) {
+      Real w[16];
+      calc_weights(rx, ry, w);
+      for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
+        const Int n = iqo + blocksize <= qsize ? blocksize : qsize - iqo;
+        Real tmp[blocksize] = {0};
+        for (Int k = 0; k < 16; ++k)
+          for (Int iqi = 0; iqi < n; ++iqi)
+            tmp[iqi] += w[k]*q_src(lid, iqo + iqi, k, lev);
+        for (Int iqi = 0; iqi < n; ++iqi)
+          q_tgt[iqo + iqi] = tmp[iqi];
+      }
+      return;
+    }
     // Block for auto-vectorization.
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
@@ -78,6 +78,7 @@ void step (
   // Wait on send buffer so it's free to be used by others.
   { Timer t("15_wait_on_send");
     wait_on_send(cm, true /* skip_if_empty */); }
+  if (cm.persistent_comm) finish_persistent_step(cm);
 }
 
 template void step(IslMpi<ko::MachineTraits>&, const Int, const Int, Real*, Real*, Real*);
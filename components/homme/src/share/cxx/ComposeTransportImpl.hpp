@@ -59,6 +59,8 @@ struct ComposeTransportImpl {
     int geometry_type; // 0: sphere, 1: plane
     Real nu_q, hv_scaling, dp_tol;
     bool independent_time_steps;
+    // Overlap the CEDR global reduction with the omega DSS.
+    bool cedr_split_phase;
 
     Buf1 buf1[3];
     Buf2 buf2[2];
@@ -68,7 +70,7 @@ struct ComposeTransportImpl {
     Data ()
       : nelemd(-1), qsize(-1), limiter_option(9), cdr_check(0), hv_q(0),
         hv_subcycle_q(0), geometry_type(0), nu_q(0), hv_scaling(0), dp_tol(-1),
-        independent_time_steps(false)
+        independent_time_steps(false), cedr_split_phase(true)
     {}
   };
 
@@ -87,6 +89,10 @@ struct ComposeTransportImpl {
 
   std::shared_ptr<BoundaryExchange>
     m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2];
+  // With cedr_split_phase, omega is DSSed on its own while the CEDR global
+  // reduction is in flight, and qdp on its own afterward.
+  std::shared_ptr<BoundaryExchange>
+    m_qdp_only_dss_be[Q_NUM_TIME_LEVELS], m_omega_dss_be;
 
   ComposeTransportImpl();
   ComposeTransportImpl(const int num_elems);
@@ -79,6 +79,9 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
       m_data.dep_pts);
   }
   m_data.independent_time_steps = independent_time_steps;
+  homme::compose::set_persistent_comm(params.sl_persistent_comm);
+  homme::compose::set_batch_tracer_interp(params.sl_batch_tracer_interp);
+  m_data.cedr_split_phase = params.sl_cedr_split_phase;
   if (m_data.nelemd == num_elems && m_data.qsize == params.qsize) return;
 
   m_data.qsize = params.qsize;
@@ -143,11 +146,34 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     be->set_diagnostics_level(sp.internal_diagnostics_level);
     be->set_buffers_manager(bm_exchange);
     be->set_num_fields(0, 0, m_data.qsize + 1);
+    // This DSS runs after the CEDR property preservation, so it is always done
+    // in double precision (tracer_exchange_single_precision does not apply).
     be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
     be->register_field(m_derived.m_omega_p);
     be->registration_completed();
   }
 
+  for (int i = 0; i < Q_NUM_TIME_LEVELS; ++i) {
+    m_qdp_only_dss_be[i] = std::make_shared<BoundaryExchange>();
+    auto be = m_qdp_only_dss_be[i];
+    be->set_label(std::string("ComposeTransport-qdp-only-DSS-" + std::to_string(i)));
+    be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_buffers_manager(bm_exchange);
+    be->set_num_fields(0, 0, m_data.qsize);
+    be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
+    be->registration_completed();
+  }
+  {
+    m_omega_dss_be = std::make_shared<BoundaryExchange>();
+    auto be = m_omega_dss_be;
+    be->set_label("ComposeTransport-omega-DSS");
+    be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_buffers_manager(bm_exchange);
+    be->set_num_fields(0, 0, 1);
+    be->register_field(m_derived.m_omega_p);
+    be->registration_completed();
+  }
+
   for (int i = 0; i < 2; ++i) {
     m_v_dss_be[i] = std::make_shared<BoundaryExchange>();
     auto be = m_v_dss_be[i];
@@ -198,8 +224,35 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   homme::compose::set_dp3d_np1(m_data.independent_time_steps ?
                                0 : // dp3d is actually divdp
                                tl.np1);
-  const auto run_cedr = homme::compose::property_preserve_global();
-  if (run_cedr) Kokkos::fence();
+  const auto spheremp = m_geometry.m_spheremp;
+  const auto scale_omega = [&] () {
+    const auto omega = m_derived.m_omega_p;
+    const auto f = KOKKOS_LAMBDA (const int idx) {
+      int ie, i, j, lev;
+      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+      omega(ie,i,j,lev) *= spheremp(ie,i,j);
+    };
+    launch_ie_ij_nlev<num_lev_pack>(f);
+  };
+  const auto split = m_data.cedr_split_phase;
+  bool run_cedr;
+  if (split) {
+    run_cedr = homme::compose::property_preserve_global_start();
+    // omega does not depend on the tracers, so DSS it while the CEDR global
+    // reduction is in flight.
+    GPTLstart("compose_dss_omega");
+    scale_omega();
+    m_omega_dss_be->exchange(m_geometry.m_rspheremp);
+    Kokkos::fence();
+    GPTLstop("compose_dss_omega");
+    if (run_cedr) {
+      homme::compose::property_preserve_global_finish();
+      Kokkos::fence();
+    }
+  } else {
+    run_cedr = homme::compose::property_preserve_global();
+    if (run_cedr) Kokkos::fence();
+  }
   GPTLstop("compose_cedr_global");
   GPTLstart("compose_cedr_local");
   if (run_cedr) {
@@ -218,7 +271,6 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
     const auto qdp = m_tracers.qdp;
     const auto Q = m_tracers.Q;
     const auto dp3d = m_state.m_dp3d;
-    const auto spheremp = m_geometry.m_spheremp;
     const auto f = KOKKOS_LAMBDA (const int idx) {
       int ie, q, i, j, lev;
       idx_ie_q_ij_nlev<num_lev_pack>(qsize, idx, ie, q, i, j, lev);
@@ -227,24 +279,21 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f);
   }
   
-  { // DSS qdp and omega
+  { // DSS qdp, and omega if it was not already done above.
     GPTLstart("compose_dss_q");
     const auto qdp = m_tracers.qdp;
-    const auto spheremp = m_geometry.m_spheremp;
     const auto f1 = KOKKOS_LAMBDA (const int idx) {
       int ie, q, i, j, lev;
       idx_ie_q_ij_nlev<num_lev_pack>(qsize, idx, ie, q, i, j, lev);
       qdp(ie,np1_qdp,q,i,j,lev) *= spheremp(ie,i,j);
     };
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f1);
-    const auto omega = m_derived.m_omega_p;
-    const auto f2 = KOKKOS_LAMBDA (const int idx) {
-      int ie, i, j, lev;
-      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
-      omega(ie,i,j,lev) *= spheremp(ie,i,j);
-    };
-    launch_ie_ij_nlev<num_lev_pack>(f2);
-    m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    if (split) {
+      m_qdp_only_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    } else {
+      scale_omega();
+      m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
+    }
     Kokkos::fence();
     GPTLstop("compose_dss_q");
   }
@@ -108,6 +108,13 @@ class EulerStepFunctorImpl {
 
   bool                m_kernel_will_run_limiters;
 
+  // If true, overlap advect_and_limit with the exchange of qdp
+  bool                m_overlap_exchange = false;
+  // If true, the qdp DSS exchanges pack qdp in single precision
+  bool                m_qdp_exchange_single_precision = false;
+  // The elements processed by advect_and_limit (all of them, unless overlapping)
+  ElementsSubset      m_elems;
+
   ThreadPreferences m_tpref;
 
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
@@ -165,6 +172,8 @@ public:
     m_data.nu_p = params.nu_p;
     m_data.nu_q = params.nu_q;
     m_data.consthv = (params.hypervis_scaling == 0);
+    m_overlap_exchange = params.overlap_exchange;
+    m_qdp_exchange_single_precision = params.tracer_exchange_single_precision;
 
     if (m_data.limiter_option == 4) {
       std::string msg = "[EulerStepFunctorImpl::reset]:";
@@ -237,7 +246,11 @@ public:
         int num_mid = dssi==DSSOption::ETA ? 0 : 1;
         int num_int = 1 - num_mid;
         be.set_num_fields(0, 0, m_data.qsize+num_mid,num_int);
-        be.register_field(m_tracers.qdp, np1_qdp, m_data.qsize, 0);
+        if (m_qdp_exchange_single_precision) {
+          be.register_field_reduced_precision(m_tracers.qdp, np1_qdp, m_data.qsize, 0);
+        } else {
+          be.register_field(m_tracers.qdp, np1_qdp, m_data.qsize, 0);
+        }
         switch(dssi) {
           case DSSOption::ETA:
             be.register_field(m_derived_state.m_eta_dot_dpdn);
@@ -434,15 +447,38 @@ public:
     profiling_pause();
   }
 
+  // Same as above, but only on the given elements
+  void advect_and_limit(const ElementsSubset& elems) {
+    const int ne = m_geometry.num_elems();
+    profiling_resume();
+    m_elems = elems;
+    Kokkos::parallel_for(
+      Homme::get_subset_team_policy<ExecSpace, AALSetupPhase>(
+        elems.num_elems, ne, m_tpref),
+      *this);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = true;
+    Kokkos::parallel_for(
+      Homme::get_subset_team_policy<ExecSpace, AALTracerPhase >(
+        elems.num_elems * m_data.qsize, ne * m_data.qsize, m_tpref),
+      *this);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = false;
+    m_elems = ElementsSubset();
+    profiling_pause();
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALSetupPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu_ne);
+    kv.ie = m_elems(team.league_rank());
     run_setup_phase(kv);
   }
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALTracerPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    kv.ie = m_elems(team.league_rank() / m_data.qsize);
     run_tracer_phase(kv);
   }
 
@@ -652,8 +688,20 @@ public:
         minmax_and_biharmonic();
       }
     }
-    advect_and_limit();
-    exchange_qdp_dss_var();
+    if (m_overlap_exchange) {
+      // Advect boundary elements and send their data, then advect
+      // interior elements while the messages are in flight
+      const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
+      overlap_with_exchange(*m_bes[idx], [&](const ElementsSubset& elems) {
+        advect_and_limit(elems);
+      });
+      GPTLstart("eus_bexch");
+      m_bes[idx]->recv_and_unpack(m_geometry.m_rspheremp);
+      GPTLstop("eus_bexch");
+    } else {
+      advect_and_limit();
+      exchange_qdp_dss_var();
+    }
   }
 
 private:
@@ -178,6 +178,24 @@ get_default_team_policy(const int num_parallel_iterations,
   return policy;
 }
 
+// Same as get_default_team_policy, but the league size is num_teams, while the
+// team/vector sizes are the ones chosen for num_parallel_iterations. Use this to
+// run a kernel on a subset of the elements (see ElementsSubset), without changing
+// the team layout that TeamUtils workspaces were sized for.
+template <typename ExecSpace, typename... Tags>
+Kokkos::TeamPolicy<ExecSpace, Tags...>
+get_subset_team_policy(const int num_teams, const int num_parallel_iterations,
+                       const ThreadPreferences tp = ThreadPreferences()) {
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(
+      num_parallel_iterations, tp);
+  auto policy = Kokkos::TeamPolicy<ExecSpace, Tags...>(num_teams,
+                                                   threads_vectors.first,
+                                                   threads_vectors.second);
+  policy.set_chunk_size(1);
+  return policy;
+}
+
 template<typename ExecSpaceType, typename... Tags>
 static
 typename std::enable_if<!OnGpu<ExecSpaceType>::value,int>::type
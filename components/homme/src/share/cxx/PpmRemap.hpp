@@ -208,51 +208,78 @@ struct PpmVertRemap : public VertRemapAlg {
                          [&](const int &loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      compute_remap_column(kv, igp, jgp, Homme::subview(remap_var, igp, jgp));
+    }); // End team thread range
+    kv.team_barrier();
+  }
 
-      Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
-                           [&](const int k) {
-        const int ilevel = k / VECTOR_SIZE;
-        const int ivector = k % VECTOR_SIZE;
-        m_ao(kv.team_idx, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
-            remap_var(igp, jgp, ilevel)[ivector] /
-            m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
-      });
+  // Remap num_vars fields of element kv.ie in one team. Each thread takes a GLL
+  // column and remaps all the fields in it, so the column's grid data from
+  // compute_grids_phase (dpo, ppmdx, kid, z2) are loaded once and then reused
+  // from cache for every field. get_var(ivar) must return field ivar as an
+  // ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>. This trades the (element,
+  // field) team parallelism for reuse, so it is meant for CPU only.
+  template <typename GetVar>
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_phase_batched(KernelVariables &kv, const int num_vars,
+                                   const GetVar &get_var) const {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
+                         [&](const int &loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      for (int ivar = 0; ivar < num_vars; ++ivar) {
+        compute_remap_column(kv, igp, jgp,
+                             Homme::subview(get_var(ivar), igp, jgp));
+      }
+    }); // End team thread range
+    kv.team_barrier();
+  }
 
-      boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
-                                     Homme::subview(m_ao, kv.team_idx, igp, jgp));
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_column(KernelVariables &kv, const int igp, const int jgp,
+                            ExecViewUnmanaged<Scalar[NUM_LEV]> remap_var) const {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                         [&](const int k) {
+      const int ilevel = k / VECTOR_SIZE;
+      const int ivector = k % VECTOR_SIZE;
+      m_ao(kv.team_idx, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
+          remap_var(ilevel)[ivector] /
+          m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
+    });
 
-      Dispatch<ExecSpace>::parallel_scan(
-          kv.team, NUM_PHYSICAL_LEV,
-          [=](const int &k, Real &accumulator, const bool last) {
-            // Accumulate the old mass up to old grid cell interface locations
-            // to simplify integration during remapping. Also, divide out the
-            // grid spacing so we're working with actual tracer values and can
-            // conserve mass.
-            const int ilevel = k / VECTOR_SIZE;
-            const int ivector = k % VECTOR_SIZE;
-            accumulator += remap_var(igp, jgp, ilevel)[ivector];
-            if (last) {
-              m_mass_o(kv.team_idx, igp, jgp, k + 1) = accumulator;
-            }
-      });
+    boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
+                                   Homme::subview(m_ao, kv.team_idx, igp, jgp));
+
+    Dispatch<ExecSpace>::parallel_scan(
+        kv.team, NUM_PHYSICAL_LEV,
+        [=](const int &k, Real &accumulator, const bool last) {
+          // Accumulate the old mass up to old grid cell interface locations
+          // to simplify integration during remapping. Also, divide out the
+          // grid spacing so we're working with actual tracer values and can
+          // conserve mass.
+          const int ilevel = k / VECTOR_SIZE;
+          const int ivector = k % VECTOR_SIZE;
+          accumulator += remap_var(ilevel)[ivector];
+          if (last) {
+            m_mass_o(kv.team_idx, igp, jgp, k + 1) = accumulator;
+          }
+    });
 
-      // Computes a monotonic and conservative PPM reconstruction
-      compute_ppm(kv,
-                  Homme::subview(m_ao, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ppmdx, kv.ie, igp, jgp),
-                  Homme::subview(m_dma, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ai, kv.team_idx, igp, jgp),
-                  Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
-
-      compute_remap(kv,
-                    Homme::subview(m_kid, kv.ie, igp, jgp),
-                    Homme::subview(m_z2, kv.ie, igp, jgp),
-                    Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
-                    Homme::subview(m_mass_o, kv.team_idx, igp, jgp),
-                    Homme::subview(m_dpo, kv.ie, igp, jgp),
-                    Homme::subview(remap_var, igp, jgp));
-    }); // End team thread range
-    kv.team_barrier();
+    // Computes a monotonic and conservative PPM reconstruction
+    compute_ppm(kv,
+                Homme::subview(m_ao, kv.team_idx, igp, jgp),
+                Homme::subview(m_ppmdx, kv.ie, igp, jgp),
+                Homme::subview(m_dma, kv.team_idx, igp, jgp),
+                Homme::subview(m_ai, kv.team_idx, igp, jgp),
+                Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
+
+    compute_remap(kv,
+                  Homme::subview(m_kid, kv.ie, igp, jgp),
+                  Homme::subview(m_z2, kv.ie, igp, jgp),
+                  Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
+                  Homme::subview(m_mass_o, kv.team_idx, igp, jgp),
+                  Homme::subview(m_dpo, kv.ie, igp, jgp),
+                  remap_var);
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
@@ -269,10 +269,14 @@ struct RemapFunctor : public Remapper {
                 "RemapFunctor not given a remap algorithm to use");
 
   struct RemapData {
-    RemapData(const int qsize_in, const int capacity_in)
-      : qsize(qsize_in), capacity(capacity_in)
+    RemapData(const int qsize_in, const int capacity_in, const bool batch_tracers_in)
+      : qsize(qsize_in), capacity(capacity_in), batch_tracers(batch_tracers_in)
     {}
     const int qsize, capacity;
+    // If true, remap all fields of an element in one team rather than launching
+    // a team per (element, field). Only done on CPU: on GPU, the (element,
+    // field) teams are needed to fill the device.
+    const bool batch_tracers;
     int np1;
     int np1_qdp;
     Real dt;
@@ -301,9 +305,11 @@ struct RemapFunctor : public Remapper {
                 // maximum capacity needed if it differs from
                 //    num_states_remap + qsize.
                 // If capacity < num_states_remap, num_states_remap is used.
-                const int capacity=-1)
+                const int capacity=-1,
+                const bool batch_tracers=false)
    : m_fields_provider(elements)
-   , m_data(qsize, std::max(capacity, m_fields_provider.num_states_remap() + qsize))
+   , m_data(qsize, std::max(capacity, m_fields_provider.num_states_remap() + qsize),
+            batch_tracers && !OnGpu<ExecSpace>::value)
    , m_state(elements.m_state)
    , m_hvcoord(hvcoord)
    , m_qdp(tracers.qdp)
@@ -360,6 +366,7 @@ struct RemapFunctor : public Remapper {
   struct ComputeThicknessTag {};
   struct ComputeGridsTag {};
   struct ComputeRemapTag {};
+  struct ComputeRemapBatchedTag {};
   // Computes the extrinsic values of the states in the initial map
   // i.e. velocity -> momentum
   struct ComputeExtrinsicsTag {};
@@ -421,6 +428,16 @@ struct RemapFunctor : public Remapper {
     this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
   }
 
+  // This asserts if num_to_remap() == 0
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ComputeRemapBatchedTag, const TeamMember &team) const {
+    KernelVariables kv(team, m_tu_ne);
+    assert(num_to_remap() != 0);
+    this->m_remap.compute_remap_phase_batched(
+        kv, num_to_remap(),
+        [&](const int var) { return get_remap_val(kv, var); });
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(ComputeIntrinsicsTag, const TeamMember &team) const {
     KernelVariables kv(team, m_tu_ne_nsr);
@@ -473,8 +490,13 @@ struct RemapFunctor : public Remapper {
       }
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
-      run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+      if (m_data.batch_tracers) {
+        run_functor<ComputeRemapBatchedTag>("Remap Compute Remap Batched Functor",
+                                            m_state.num_elems());
+      } else {
+        run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
+                                     m_state.num_elems() * num_to_remap());
+      }
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
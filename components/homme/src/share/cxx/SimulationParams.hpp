@@ -69,6 +69,40 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // If true, functors that compute a field right before exchanging it first
+  // compute boundary elements (those with remote neighbors), start the
+  // exchange, and then compute the interior elements while messages are in flight.
+  bool      overlap_exchange = false;
+
+  // If true, the DIRK Newton solver reuses the Jacobian factorization across
+  // iterations (modified Newton), refactoring only if convergence slows down.
+  bool      dirk_modified_newton = false;
+
+  // If true, the DIRK Newton solver counts its iterations and Jacobian
+  // factorizations, and reports them at every call (see DirkFunctor::run).
+  bool      dirk_newton_stats = false;
+
+  // If true, the SL transport step reuses persistent MPI requests across steps
+  // rather than posting new sends and receives each step.
+  bool      sl_persistent_comm = false;
+
+  // If true, SL transport interpolates all tracers at a departure point with
+  // one set of precomputed weights. Not BFB with the default.
+  bool      sl_batch_tracer_interp = false;
+
+  // If true, SL transport DSSes omega while the CEDR global reduction is in
+  // flight. BFB with false.
+  bool      sl_cedr_split_phase = true;
+
+  // If true, vertical remap processes all tracers of an element in one team,
+  // reusing the column's remap grid across tracers. Ignored on GPU.
+  bool      remap_batch_tracers = false;
+
+  // If true, the Eulerian tracer DSS exchanges send qdp in single precision,
+  // halving their message volume. Mass is conserved, but this is not BFB with
+  // the default. The SL transport DSS (after CEDR) is always in double.
+  bool      tracer_exchange_single_precision = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +147,14 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   overlap_exchange: " << (overlap_exchange ? "yes" : "no") << "\n";
+  out << "   dirk_modified_newton: " << (dirk_modified_newton ? "yes" : "no") << "\n";
+  out << "   dirk_newton_stats: " << (dirk_newton_stats ? "yes" : "no") << "\n";
+  out << "   sl_persistent_comm: " << (sl_persistent_comm ? "yes" : "no") << "\n";
+  out << "   sl_batch_tracer_interp: " << (sl_batch_tracer_interp ? "yes" : "no") << "\n";
+  out << "   sl_cedr_split_phase: " << (sl_cedr_split_phase ? "yes" : "no") << "\n";
+  out << "   remap_batch_tracers: " << (remap_batch_tracers ? "yes" : "no") << "\n";
+  out << "   tracer_exchange_single_precision: " << (tracer_exchange_single_precision ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
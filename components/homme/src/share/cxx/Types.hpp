@@ -173,6 +173,9 @@ namespace Remap {
 // previously computed in compute_grids_phase.
 // It is also expected to have a large amount of parallelism, specifically
 // qsize * num_elems
+//
+// compute_remap_phase_batched remaps all the tracers of an element in one team,
+// reusing the grid quantities across tracers.
 struct VertRemapAlg {};
 } // namespace Remap
 
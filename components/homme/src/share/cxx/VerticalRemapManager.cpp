@@ -45,21 +45,25 @@ struct VerticalRemapManager::Impl {
       if (m_params.rsplit != 0) {
         remapper = std::make_shared<RemapFunctor<
             true, PpmVertRemap<PpmMirrored>> >(
-            qsize, m_elements, m_tracers, m_hvcoord, capacity);
+            qsize, m_elements, m_tracers, m_hvcoord, capacity,
+            m_params.remap_batch_tracers);
       } else {
         remapper = std::make_shared<RemapFunctor<
             false, PpmVertRemap<PpmMirrored>> >(
-            qsize, m_elements, m_tracers, m_hvcoord, capacity);
+            qsize, m_elements, m_tracers, m_hvcoord, capacity,
+            m_params.remap_batch_tracers);
       }
     } else if (m_params.remap_alg == RemapAlg::PPM_LIMITED_EXTRAP) {
       if (m_params.rsplit != 0) {
         remapper = std::make_shared<RemapFunctor<
             true, PpmVertRemap<PpmLimitedExtrap>> >(
-            qsize, m_elements, m_tracers, m_hvcoord, capacity);
+            qsize, m_elements, m_tracers, m_hvcoord, capacity,
+            m_params.remap_batch_tracers);
       } else {
         remapper = std::make_shared<RemapFunctor<
             false, PpmVertRemap<PpmLimitedExtrap>> >(
-            qsize, m_elements, m_tracers, m_hvcoord, capacity);
+            qsize, m_elements, m_tracers, m_hvcoord, capacity,
+            m_params.remap_batch_tracers);
       }
     } else {
       Errors::runtime_abort(
@@ -12,6 +12,8 @@
 
 #include "utilities/VectorUtils.hpp"
 
+#include <cfloat>
+
 #ifndef HOMME_BE_NO_HASHER
 // It's convenient and clean to use boundary exchanges as the place to hash
 // state. However, this interferes with the BoundaryExchange unit test's
@@ -42,6 +44,7 @@ BoundaryExchange::BoundaryExchange()
   m_num_2d_fields = 0;
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
+  m_num_3d_rp_fields = 0;
 
   m_connectivity    = std::shared_ptr<Connectivity>();
   m_buffers_manager = std::shared_ptr<MpiBuffersManager>();
@@ -167,6 +170,8 @@ void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d
   } else {
     alloc3d(m_3d_fields, m_3d_int_fields, m_num_elems, num_3d_fields, num_3d_int_fields);
   }
+  // Any of the 3d fields may be registered as a single precision field
+  m_3d_rp_fields = decltype(m_3d_rp_fields)("3d reduced precision fields", m_num_elems, num_3d_fields);
 
   // Now we can start register fields
   m_registration_started   = true;
@@ -190,11 +195,13 @@ void BoundaryExchange::clean_up()
   m_1d_fields = decltype(m_1d_fields)("m_1d_fields", 0, 0);
   m_2d_fields = decltype(m_2d_fields)("m_2d_fields", 0, 0);
   alloc3d(m_3d_fields, m_3d_int_fields, 0, 0, 0);
+  m_3d_rp_fields = decltype(m_3d_rp_fields)("m_3d_rp_fields", 0, 0);
 
   m_num_1d_fields = 0;
   m_num_2d_fields = 0;
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
+  m_num_3d_rp_fields = 0;
 
   // If we clean up, we need to reset the number of fields
   m_registration_started   = false;
@@ -230,8 +237,10 @@ void BoundaryExchange::registration_completed()
   int single_ptr_buf_size = m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
   for (int i = 0; i < m_num_3d_fields; ++i)
     single_ptr_buf_size += m_3d_nlev_pack[i]*VECTOR_SIZE;
-  m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
-  m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
+  m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1
+                                                 + m_num_3d_rp_fields*reduced_precision_buf_size(1);
+  m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP
+                                                 + m_num_3d_rp_fields*reduced_precision_buf_size(NP);
 
   // Determine what kind of BE is this (exchange or exchange_min_max)
   m_exchange_type = m_num_1d_fields>0 ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
@@ -285,7 +294,7 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
   assert (m_exchange_type==MPI_EXCHANGE);
 
   // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_rp_fields==0) {
     return;
   }
 
@@ -360,12 +369,20 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+// Whether a connection with the given sharing is packed in the given scope
+KOKKOS_INLINE_FUNCTION
+static bool in_pack_scope (const int scope, const int sharing) {
+  const bool shared = sharing == etoi(ConnectionSharing::SHARED);
+  return (scope == BoundaryExchange::PACK_ALL ||
+          (scope == BoundaryExchange::PACK_SHARED) == shared);
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields, const int scope) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +391,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if ( ! in_pack_scope(scope, info.sharing))
+        return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -391,7 +410,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int num_elems, const int num_3d_fields, const int scope,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +430,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if ( ! in_pack_scope(scope, info.sharing))
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +463,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if ( ! in_pack_scope(scope, info.sharing))
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -461,7 +484,144 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
   }
 }
 
+// Round to single precision toward zero. Then f-round_rp(f) has the sign of f,
+// so the rounding residual of a non-negative field is non-negative.
+KOKKOS_INLINE_FUNCTION
+float round_rp (const Real f) {
+  float fr = static_cast<float>(f);
+  if ((f >= 0 && fr > f) || (f < 0 && fr < f)) {
+    // Rounding to nearest moved away from zero: step back by one ulp
+    // (fr*eps/2 is between half and one ulp, so the difference rounds to
+    // the previous float). This fails only if fr is subnormal.
+    const float half_eps = 0.5f*FLT_EPSILON;
+    fr = fr - fr*half_eps;
+    if ((f >= 0 && fr > f) || (f < 0 && fr < f))
+      fr = 0;
+  }
+  return fr;
+}
+
+// Pack single precision 3d fields: each point stores NUM_LEV*VECTOR_SIZE floats
+static void
+pack_rp (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+         const ExecViewUnmanaged<const int*> ucon_ptr,
+         const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**> fields_3d,
+         const ExecViewUnmanaged<ExecViewUnmanaged<float**>**> send_3d_buffers,
+         const int num_elems, const int num_3d_fields, const int scope) {
+  const auto num_parallel_iterations = num_elems*num_3d_fields;
+  ThreadPreferences tp;
+  tp.max_threads_usable = NP;
+  tp.max_vectors_usable = NUM_LEV;
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(
+      num_parallel_iterations, tp);
+  const auto policy = Kokkos::TeamPolicy<ExecSpace>(
+    num_parallel_iterations, threads_vectors.first, threads_vectors.second);
+  HOMMEXX_STATIC const ConnectionHelpers helpers;
+  Kokkos::parallel_for(policy,
+    KOKKOS_LAMBDA(const TeamMember& team) {
+      Homme::KernelVariables kv(team, num_3d_fields);
+      const int ie = kv.ie;
+      const int ifield = kv.iq;
+      const auto& f3 = fields_3d(ie, ifield);
+      const int iconn_end = ucon_ptr(ie+1);
+      for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
+        const auto& info = ucon(iconn);
+        if ( ! in_pack_scope(scope, info.sharing))
+          continue;
+        const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
+                                  info.sharing_local_remote_iconn :
+                                  iconn);
+        const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
+        const auto& sb = send_3d_buffers(ifield, buffer_iconn);
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(kv.team, helpers.CONNECTION_SIZE[info.kind]),
+          [&] (const int& k) {
+            auto* const sbp = &sb(k, 0);
+            const auto* const f3p = &f3(pts[k].ip, pts[k].jp, 0);
+            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+                                 [&] (const int& ilev) {
+              for (int v = 0; v < VECTOR_SIZE; ++v)
+                sbp[ilev*VECTOR_SIZE + v] = round_rp(f3p[ilev][v]);
+            });
+          });
+      }
+    });
+}
+
+void BoundaryExchange::pack_connections (const int scope)
+{
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, pack 2d fields (if any)...
+  if (m_num_2d_fields > 0)
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+         m_num_2d_fields, scope);
+  // ...then pack 3d fields (if any)...
+  if (m_num_3d_fields > 0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                          m_num_elems, m_num_3d_fields, scope, &m_3d_nlev_pack_d);
+    else
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                    m_num_elems, m_num_3d_fields, scope);
+  }
+  // ...then pack 3d interface fields (if any)...
+  if (m_num_3d_int_fields > 0)
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                    m_num_elems, m_num_3d_int_fields, scope);
+  // ...then pack single precision 3d fields (if any)
+  if (m_num_3d_rp_fields > 0)
+    pack_rp(ucon, ucon_ptr, m_3d_rp_fields, m_send_3d_rp_buffers,
+            m_num_elems, m_num_3d_rp_fields, scope);
+}
+
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(PACK_ALL);
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  assert (m_registration_completed);
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_rp_fields==0) {
+    return;
+  }
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  // As in 'exchange', start receiving before packing
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  pack_and_send(PACK_SHARED);
+}
+
+void BoundaryExchange::pack_local ()
+{
+  assert (m_registration_completed);
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_rp_fields==0) {
+    return;
+  }
+
+  // The shared connections must have been packed (and sent) already
+  assert (m_send_pending);
+
+  tstart("be pack_local");
+  pack_connections(PACK_NON_SHARED);
+  Kokkos::fence();
+  tstop("be pack_local");
+}
+
+void BoundaryExchange::pack_and_send (const int scope)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -472,7 +632,7 @@ void BoundaryExchange::pack_and_send ()
   assert (m_exchange_type==MPI_EXCHANGE);
 
   // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_rp_fields==0) {
     return;
   }
 
@@ -490,25 +650,7 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
-  if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
-  // ...then pack 3d fields (if any)...
-  if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
-  }
-  // ...then pack 3d interface fields (if any)
-  if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+  pack_connections(scope);
   Kokkos::fence();
 
   // ---- Send ---- //
@@ -529,6 +671,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -676,6 +822,102 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   }
 }
 
+// Unpack single precision 3d fields. Before accumulating, round the local
+// values at the element boundary points to float (as in pack_rp), so that
+// each element sharing a point sums the same (single precision)
+// contributions. The rounding residual is given to the element's interior
+// points, so that the sum of the element's contributions, and hence the
+// (spheremp weighted) mass of the assembled field, is unchanged.
+// Since round_rp rounds toward zero, the residual of a non-negative field
+// (e.g., qdp after the limiter) is non-negative, and adding it to the
+// interior cannot make qdp negative. The residual is split in proportion to
+// the interior (absolute) mass, so each value changes by at most a fraction
+// rp_max_rel_change of itself. If the interior is too small for that (e.g.,
+// it is zero), the residual, which is at most a few float ulps of the
+// boundary values, is split evenly.
+// assume:conn-edges-snwe
+static void
+unpack_rp (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+           const ExecViewUnmanaged<const int*> ucon_ptr,
+           const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**> fields_3d,
+           const ExecViewUnmanaged<ExecViewUnmanaged<float**>**> recv_3d_buffers,
+           const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
+           const int num_elems, const int num_3d_fields) {
+  static_assert(NP > 2, "The single precision exchange needs element interior points.");
+  // A few float ulps: the interior absorbs the residual only if this does not
+  // change its values by more than the single precision rounding itself.
+  const Real rp_max_rel_change = 1.0/(1 << 20);
+  // Corner points belong to two edges, so parallelize over levels only
+  const auto num_parallel_iterations = num_elems*num_3d_fields;
+  ThreadPreferences tp;
+  tp.max_threads_usable = NUM_LEV;
+  tp.max_vectors_usable = VECTOR_SIZE;
+  const auto threads_vectors =
+    DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(
+      num_parallel_iterations, tp);
+  const auto policy = Kokkos::TeamPolicy<ExecSpace>(
+    num_parallel_iterations, threads_vectors.first, threads_vectors.second);
+  HOMMEXX_STATIC const ConnectionHelpers helpers;
+  const bool scale = rspheremp != nullptr;
+  const auto rsmp = scale ? *rspheremp : ExecViewUnmanaged<const Real * [NP][NP]>();
+  Kokkos::parallel_for(policy,
+    KOKKOS_LAMBDA(const TeamMember& team) {
+      Homme::KernelVariables kv(team, num_3d_fields);
+      const int ie = kv.ie;
+      const int ifield = kv.iq;
+      const auto& f3 = fields_3d(ie, ifield);
+      const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NUM_LEV),
+                           [&] (const int& ilev) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, VECTOR_SIZE),
+                             [&] (const int& v) {
+          const int ir = ilev*VECTOR_SIZE + v;
+          Real residual = 0, interior_mass = 0;
+          for (int i = 0; i < NP; ++i) {
+            for (int j = 0; j < NP; ++j) {
+              const Real f = f3(i, j, ilev)[v];
+              if (i > 0 && i < NP-1 && j > 0 && j < NP-1)
+                interior_mass += std::abs(f);
+              else
+                residual += f - round_rp(f);
+            }
+          }
+          const bool by_mass = std::abs(residual) <= rp_max_rel_change*interior_mass;
+          const Real even_share = residual/((NP-2)*(NP-2));
+          for (int i = 0; i < NP; ++i) {
+            for (int j = 0; j < NP; ++j) {
+              auto& f = f3(i, j, ilev)[v];
+              if (i > 0 && i < NP-1 && j > 0 && j < NP-1) {
+                if (by_mass && interior_mass > 0)
+                  f += residual*(std::abs(f)/interior_mass);
+                else if ( ! by_mass)
+                  f += even_share;
+              } else {
+                f = round_rp(f);
+              }
+            }
+          }
+          for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
+            const auto& r3 = recv_3d_buffers(ifield, iconn_beg + iedge);
+            for (int k = 0; k < NP; ++k) {
+              const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
+              f3(pts.ip, pts.jp, ilev)[v] += r3(k, ir);
+            }
+          }
+          for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
+            const auto& pts = helpers.CONNECTION_PTS_FWD[ucon(iconn).local_dir][0];
+            f3(pts.ip, pts.jp, ilev)[v] += recv_3d_buffers(ifield, iconn)(0, ir);
+          }
+          if (scale) {
+            for (int i = 0; i < NP; ++i)
+              for (int j = 0; j < NP; ++j)
+                f3(i, j, ilev)[v] *= rsmp(ie, i, j);
+          }
+        });
+      });
+    });
+}
+
 void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
 {
   tstart("be recv_and_unpack");
@@ -689,7 +931,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
 
   // I am not sure why and if we could have this scenario, but just in case. I
   // think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_rp_fields==0) {
     return;
   }
 
@@ -737,10 +979,14 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
       unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
                       m_num_elems, m_num_3d_fields);
   }
-  // ...then unpack 3d interface fields (if any).
+  // ...then unpack 3d interface fields (if any)...
   if (m_num_3d_int_fields > 0)
     unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
                       m_num_elems, m_num_3d_int_fields);
+  // ...then unpack single precision 3d fields (if any).
+  if (m_num_3d_rp_fields > 0)
+    unpack_rp(ucon, ucon_ptr, m_3d_rp_fields, m_recv_3d_rp_buffers, rspheremp,
+              m_num_elems, m_num_3d_rp_fields);
   Kokkos::fence();
 
   // If another BE structure starts an exchange, it has no way to check that
@@ -1032,6 +1278,11 @@ void BoundaryExchange::build_buffer_views_and_requests()
   h_increment_2d[etoi(ConnectionKind::CORNER)]  =  1;
   h_increment_2d[etoi(ConnectionKind::MISSING)] =  0;
   HostViewManaged<int[3]> h_increment_3d = h_increment_2d;
+  // Single precision 3d fields use whole Real's per connection
+  HostViewManaged<int[3]> h_increment_3d_rp("increment_3d_rp");
+  h_increment_3d_rp[etoi(ConnectionKind::EDGE)]    = reduced_precision_buf_size(NP);
+  h_increment_3d_rp[etoi(ConnectionKind::CORNER)]  = reduced_precision_buf_size(1);
+  h_increment_3d_rp[etoi(ConnectionKind::MISSING)] = 0;
 
   auto buffers_manager = m_buffers_manager;
 
@@ -1061,6 +1312,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("3d recv buffer", m_num_3d_fields, nconn);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("3d interface send buffer", m_num_3d_int_fields, nconn);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("3d interface recv buffer", m_num_3d_int_fields, nconn);
+  m_send_3d_rp_buffers = decltype(m_send_3d_rp_buffers)("3d reduced precision send buffer", m_num_3d_rp_fields, nconn);
+  m_recv_3d_rp_buffers = decltype(m_recv_3d_rp_buffers)("3d reduced precision recv buffer", m_num_3d_rp_fields, nconn);
   const auto h_send_1d_buffers = Kokkos::create_mirror_view(m_send_1d_buffers);
   const auto h_recv_1d_buffers = Kokkos::create_mirror_view(m_recv_1d_buffers);
   const auto h_send_2d_buffers = Kokkos::create_mirror_view(m_send_2d_buffers);
@@ -1069,6 +1322,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   const auto h_recv_3d_buffers = Kokkos::create_mirror_view(m_recv_3d_buffers);
   const auto h_send_3d_int_buffers = Kokkos::create_mirror_view(m_send_3d_int_buffers);
   const auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
+  const auto h_send_3d_rp_buffers = Kokkos::create_mirror_view(m_send_3d_rp_buffers);
+  const auto h_recv_3d_rp_buffers = Kokkos::create_mirror_view(m_recv_3d_rp_buffers);
 
   ConnectionHelpers helpers;
   for (size_t k = 0; k < nconn; ++k) {
@@ -1112,6 +1367,15 @@ void BoundaryExchange::build_buffer_views_and_requests()
         helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
       h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV_P*VECTOR_SIZE;
     }
+    for (int f = 0; f < m_num_3d_rp_fields; ++f) {
+      h_send_3d_rp_buffers(f, i) = ExecViewUnmanaged<float**>(
+        reinterpret_cast<float*>(send_buffer.get() + h_buf_offset[info.sharing]),
+        helpers.CONNECTION_SIZE[info.kind], NUM_LEV*VECTOR_SIZE);
+      h_recv_3d_rp_buffers(f, i) = ExecViewUnmanaged<float**>(
+        reinterpret_cast<float*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+        helpers.CONNECTION_SIZE[info.kind], NUM_LEV*VECTOR_SIZE);
+      h_buf_offset[info.sharing] += h_increment_3d_rp[info.kind];
+    }
   }
   Kokkos::deep_copy(m_send_1d_buffers, h_send_1d_buffers);
   Kokkos::deep_copy(m_recv_1d_buffers, h_recv_1d_buffers);
@@ -1121,6 +1385,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   Kokkos::deep_copy(m_recv_3d_buffers, h_recv_3d_buffers);
   Kokkos::deep_copy(m_send_3d_int_buffers, h_send_3d_int_buffers);
   Kokkos::deep_copy(m_recv_3d_int_buffers, h_recv_3d_int_buffers);
+  Kokkos::deep_copy(m_send_3d_rp_buffers, h_send_3d_rp_buffers);
+  Kokkos::deep_copy(m_recv_3d_rp_buffers, h_recv_3d_rp_buffers);
 
 #ifndef NDEBUG
   // Sanity check: compute the buffers sizes for this boundary exchange, and
@@ -1275,6 +1541,8 @@ void BoundaryExchange::clear_buffer_views_and_requests ()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("m_recv_3d_buffers", 0, 0);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("m_send_3d_int_buffers", 0, 0);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("m_recv_3d_int_buffers", 0, 0);
+  m_send_3d_rp_buffers = decltype(m_send_3d_rp_buffers)("m_send_3d_rp_buffers", 0, 0);
+  m_recv_3d_rp_buffers = decltype(m_recv_3d_rp_buffers)("m_recv_3d_rp_buffers", 0, 0);
 
   // Done
   m_buffer_views_and_requests_built = false;
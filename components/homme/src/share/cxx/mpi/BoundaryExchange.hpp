@@ -139,6 +139,18 @@ public:
   template<typename... Properties>
   void register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Properties...> field, int idim_out, int num_dims, int start_dim, int nlev=NUM_LEV);
 
+  // 3d fields exchanged in single precision. Values are rounded to float (toward
+  // zero) when packed, and accumulated in Real when unpacked. The local values at
+  // element boundary points are rounded to float as well before accumulation, so
+  // that all the elements sharing a GLL point sum the same contributions; the
+  // rounding residual goes to the element's interior points, so the field's
+  // mass is conserved, and a non-negative field stays non-negative. This halves the buffers footprint and the message volume
+  // for these fields, at the price of a ~1e-7 relative error. Meant for tracer
+  // fields; not for DSS's that must preserve bounds set by a fixer (e.g. CEDR),
+  // since the interior adjustment can cross them at the rounding level.
+  template<int OUTER_DIM, int DIM, typename... Properties>
+  void register_field_reduced_precision (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][NUM_LEV], Properties...> field, int idim_out, int num_dims, int start_dim);
+
   // Handle both NUM_LEV and NUM_LEV_P. register_field does not support nlev !=
   // NUM_LEV_P.
   template<int NUM_LEV_IN, typename... Properties>
@@ -200,6 +212,12 @@ public:
   int get_num_2d_fields () const { return m_num_2d_fields; }
   int get_num_3d_fields () const { return m_num_3d_fields; }
   int get_num_3d_int_fields () const { return m_num_3d_int_fields; }
+  int get_num_3d_rp_fields () const { return m_num_3d_rp_fields; }
+
+  // The number of Real's needed to store num_pts points of a single precision 3d field
+  static int reduced_precision_buf_size (const int num_pts) {
+    return (num_pts*NUM_LEV*VECTOR_SIZE*sizeof(float) + sizeof(Real) - 1) / sizeof(Real);
+  }
 
   template<typename ptr_type, typename raw_type>
   struct Pointer {
@@ -218,6 +236,23 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Split-phase version of pack_and_send, to overlap the exchange with computation:
+  //  - pack_and_send_shared starts the recvs, packs only the shared connections,
+  //    and starts the sends. Fields on boundary elements (see Connectivity)
+  //    must be up to date;
+  //  - pack_local packs the remaining connections. Fields on all elements
+  //    must be up to date.
+  // After pack_local, complete the exchange with recv_and_unpack.
+  // See also overlap_with_exchange below.
+  void pack_and_send_shared ();
+  void pack_local ();
+
+  // Which connections are packed by pack_connections
+  enum : int { PACK_ALL, PACK_SHARED, PACK_NON_SHARED };
+
+  std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -255,6 +290,7 @@ private:
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_P]>**>     m_3d_int_fields;
+  ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_rp_fields;
 
   // This class contains all the buffers to be stuffed in the buffers views, and used in pack/unpack,
   // as well as the mpi buffers used in MPI calls (which are the same as the former if MPIMemSpace=ExecMemSpace),
@@ -284,6 +320,10 @@ private:
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>  m_send_3d_int_buffers;
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>  m_recv_3d_int_buffers;  
 
+  // Single precision 3d fields store NUM_LEV*VECTOR_SIZE floats per point
+  ExecViewManaged<ExecViewUnmanaged<float**>**>   m_send_3d_rp_buffers;
+  ExecViewManaged<ExecViewUnmanaged<float**>**>   m_recv_3d_rp_buffers;
+
   std::vector<int> m_3d_nlev_pack;        // during registration
   ExecViewManaged<int*> m_3d_nlev_pack_d; //  after registration
 
@@ -292,6 +332,7 @@ private:
   int         m_num_2d_fields;
   int         m_num_3d_fields;
   int         m_num_3d_int_fields;
+  int         m_num_3d_rp_fields;
 
   // The following flags are used to ensure that a bad user does not call setup/cleanup/registration
   // methods of this class in an order that generate errors. And if he/she does, we try to avoid errors.
@@ -311,12 +352,38 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+
+  void pack_connections (const int scope);
+  void pack_and_send (const int scope);
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
 
+// Run a per-element computation overlapped with the exchange performed by be:
+//  1) compute(boundary elements), then pack and send the shared connections;
+//  2) compute(interior elements) while messages are in flight, then pack the
+//     local connections.
+// compute is called as compute(const ElementsSubset&), and must fence before
+// returning. The caller must then complete the exchange with be.recv_and_unpack.
+template<typename ComputeFunctor>
+void overlap_with_exchange (BoundaryExchange& be, const ComputeFunctor& compute)
+{
+  const auto connectivity = be.get_connectivity();
+  const auto boundary = connectivity->get_boundary_elements();
+  const auto interior = connectivity->get_interior_elements();
+
+  if (boundary.num_elems>0) {
+    compute(boundary);
+  }
+  be.pack_and_send_shared();
+  if (interior.num_elems>0) {
+    compute(interior);
+  }
+  be.pack_local();
+}
+
 // ============================ REGISTER METHODS ========================= //
 
 // --- 2d fields --- //
@@ -468,6 +535,30 @@ void BoundaryExchange::register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Prop
   m_num_3d_fields += num_dims;
 }
 
+template<int OUTER_DIM, int DIM, typename... Properties>
+void BoundaryExchange::register_field_reduced_precision (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][NUM_LEV], Properties...> field, int outer_dim, int num_dims, int start_dim)
+{
+  using Kokkos::ALL;
+
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (num_dims>0 && start_dim>=0 && outer_dim>=0 && DIM>0 && OUTER_DIM>0);
+  assert (start_dim+num_dims<=DIM);
+  assert (m_num_3d_fields+m_num_3d_rp_fields+num_dims<=m_3d_rp_fields.extent_int(1));
+  assert (m_num_1d_fields==0);
+
+  {
+    auto l_num_3d_rp_fields = m_num_3d_rp_fields;
+    auto l_3d_rp_fields = m_3d_rp_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int idim){
+        l_3d_rp_fields(ie, l_num_3d_rp_fields+idim) = Kokkos::subview(field, ie, outer_dim, start_dim+idim, ALL, ALL, ALL);
+    });
+  }
+
+  m_num_3d_rp_fields += num_dims;
+}
+
 template<int NUM_LEV_IN, typename... Properties>
 void BoundaryExchange::register_field_impl (
     typename std::enable_if<NUM_LEV_IN==NUM_LEV,
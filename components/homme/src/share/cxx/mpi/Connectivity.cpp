@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -18,6 +19,7 @@ Connectivity::Connectivity ()
  , m_initialized  (false)
  , m_num_local_elements (-1)
  , m_max_corner_elements(-1)
+ , m_num_boundary_elements(0)
 {
   // Nothing to be done here
 }
@@ -136,6 +138,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_elements_partition();
 
   m_finalized = true;
 }
@@ -313,6 +316,31 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_elements_partition ()
+{
+  std::vector<int> boundary, interior;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool shared = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+        shared = true;
+        break;
+      }
+    }
+    (shared ? boundary : interior).push_back(ie);
+  }
+  m_num_boundary_elements = boundary.size();
+
+  d_boundary_elems = decltype(d_boundary_elems)("Boundary elements", boundary.size());
+  d_interior_elems = decltype(d_interior_elems)("Interior elements", interior.size());
+  const auto h_boundary_elems = Kokkos::create_mirror_view(d_boundary_elems);
+  const auto h_interior_elems = Kokkos::create_mirror_view(d_interior_elems);
+  std::copy(boundary.begin(), boundary.end(), h_boundary_elems.data());
+  std::copy(interior.begin(), interior.end(), h_interior_elems.data());
+  Kokkos::deep_copy(d_boundary_elems, h_boundary_elems);
+  Kokkos::deep_copy(d_interior_elems, h_interior_elems);
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,6 +350,9 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_boundary_elems = decltype(d_boundary_elems)("", 0);
+  d_interior_elems = decltype(d_interior_elems)("", 0);
+  m_num_boundary_elements = 0;
 
   m_initialized = false;
   m_finalized   = false;
@@ -56,6 +56,18 @@ struct HaloExchangeUnstructuredConnectionInfo
   int sharing_local_remote_iconn;
 };
 
+// A list of local elements to be processed by a team kernel, with one team
+// per element. Kernels map the league rank to an element id via operator().
+// If elems is empty, the list is the identity on [0,num_elems).
+struct ElementsSubset
+{
+  ExecViewUnmanaged<const int*> elems;
+  int num_elems = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator() (const int i) const { return elems.size()==0 ? i : elems(i); }
+};
+
 // The connectivity class. It stores two lists of ConnectionInfo objects, one for
 // local connections (both elements on process) and one for shared connections
 // (one element is on a remote process). The latter require MPI work, while the
@@ -122,6 +134,13 @@ public:
   KOKKOS_INLINE_FUNCTION
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
+  // Local elements that have at least one shared connection ("boundary"), and
+  // elements whose neighbors are all on this process ("interior"). The two
+  // lists partition the local elements, and are sorted by local id.
+  ElementsSubset get_boundary_elements () const { return {d_boundary_elems, m_num_boundary_elements}; }
+  ElementsSubset get_interior_elements () const { return {d_interior_elems, m_num_local_elements-m_num_boundary_elements}; }
+  int get_num_boundary_elements  () const { return m_num_boundary_elements; }
+
   int get_num_local_elements     () const { return m_num_local_elements;  }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
@@ -143,6 +162,7 @@ private:
   bool    m_initialized;
 
   int     m_num_local_elements, m_max_corner_elements;
+  int     m_num_boundary_elements;
 
   ConnectionHelpers m_helpers;
 
@@ -156,6 +176,8 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  ExecViewManaged<int*>             d_boundary_elems;
+  ExecViewManaged<int*>             d_interior_elems;
   // Helper used to accumulate connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +189,8 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, after setup_ucon, split elements in boundary/interior.
+  void setup_elements_partition();
 };
 
 } // namespace Homme
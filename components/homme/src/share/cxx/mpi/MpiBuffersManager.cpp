@@ -162,9 +162,10 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
   const int num_2d_fields = customer.first->get_num_2d_fields();
   const int num_3d_fields = customer.first->get_num_3d_fields();
   const int num_3d_int_fields = customer.first->get_num_3d_int_fields();
+  const int num_3d_rp_fields = customer.first->get_num_3d_rp_fields();
 
   // Compute the requested buffers sizes and compare with stored ones
-  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, customer.second.mpi_buffer_size, customer.second.local_buffer_size);
+  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, customer.second.mpi_buffer_size, customer.second.local_buffer_size, num_3d_rp_fields);
   if (customer.second.mpi_buffer_size>m_mpi_buffer_size) {
     // Update the total
     m_mpi_buffer_size = customer.second.mpi_buffer_size;
@@ -184,7 +185,8 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
 
 void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                                                const int num_3d_fields, const int num_3d_interface_fields,
-                                               size_t& mpi_buffer_size, size_t& local_buffer_size) const
+                                               size_t& mpi_buffer_size, size_t& local_buffer_size,
+                                               const int num_3d_rp_fields) const
 {
   mpi_buffer_size = local_buffer_size = 0;
 
@@ -193,8 +195,11 @@ void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const in
   //       we have 2 Real per level (max and min over element).
   int elem_buf_size[2];
   const int pt_buf_size = num_2d_fields + num_3d_fields*NUM_LEV*VECTOR_SIZE + num_3d_interface_fields*NUM_LEV_P*VECTOR_SIZE;
-  elem_buf_size[etoi(ConnectionKind::CORNER)] = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * 1;
-  elem_buf_size[etoi(ConnectionKind::EDGE)]   = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * NP;
+  //       Single precision 3d fields pack two values per Real.
+  elem_buf_size[etoi(ConnectionKind::CORNER)] = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * 1
+                                              + num_3d_rp_fields*BoundaryExchange::reduced_precision_buf_size(1);
+  elem_buf_size[etoi(ConnectionKind::EDGE)]   = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * NP
+                                              + num_3d_rp_fields*BoundaryExchange::reduced_precision_buf_size(NP);
 
   // Compute the requested buffers sizes and compare with stored ones
   mpi_buffer_size += elem_buf_size[etoi(ConnectionKind::CORNER)] * m_connectivity->get_num_connections<HostMemSpace>(ConnectionSharing::SHARED,ConnectionKind::CORNER);
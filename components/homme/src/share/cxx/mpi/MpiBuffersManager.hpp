@@ -148,7 +148,8 @@ private:
   // Computes the required storages
   void required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                               const int num_3d_fields, const int num_3d_interface_fields,
-                              size_t& mpi_buffer_size, size_t& local_buffer_size) const;
+                              size_t& mpi_buffer_size, size_t& local_buffer_size,
+                              const int num_3d_rp_fields = 0) const;
 
   // The number of customers
   size_t m_num_customers;
@@ -92,6 +92,10 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_overlap_exchange;
+
+  // The elements processed by the pre-exchange loop (all of them, unless overlapping with the exchange)
+  ElementsSubset        m_elems;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -131,6 +135,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.overlap_exchange)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +159,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_exchange(params.overlap_exchange)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -345,18 +351,43 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_overlap_exchange) {
+      // Compute boundary elements and send their data, then compute
+      // interior elements while the messages are in flight
+      GPTLstart("caar compute+bexchV");
+      int nerr = 0;
+      overlap_with_exchange(*m_bes[data.np1], [&](const ElementsSubset& elems) {
+        int nerr_elems;
+        const TeamPolicyType<TagPreExchange> policy(
+            Homme::get_subset_team_policy<ExecSpace,TagPreExchange>(elems.num_elems,m_num_elems));
+        m_elems = elems;
+        Kokkos::parallel_reduce("caar loop pre-boundary exchange", policy, *this, nerr_elems);
+        Kokkos::fence();
+        nerr += nerr_elems;
+      });
+      m_elems = ElementsSubset();
+      GPTLstop("caar compute+bexchV");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->recv_and_unpack(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    } else {
+      GPTLstart("caar compute");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -376,6 +407,7 @@ struct CaarFunctorImpl {
     // Note: make sure the same temp is not used within each epoch!
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(team.league_rank());
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
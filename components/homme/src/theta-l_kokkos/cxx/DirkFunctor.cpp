@@ -7,6 +7,7 @@
 #include "DirkFunctor.hpp"
 #include "DirkFunctorImpl.hpp"
 #include "Context.hpp"
+#include "SimulationParams.hpp"
 
 #include "profiling.hpp"
 
@@ -17,6 +18,12 @@ namespace Homme {
 
 DirkFunctor::DirkFunctor (int nelem) {
   m_dirk_impl.reset(new DirkFunctorImpl(nelem));
+
+  const auto& c = Context::singleton();
+  if (c.has<SimulationParams>()) {
+    m_dirk_impl->m_modified_newton = c.get<SimulationParams>().dirk_modified_newton;
+    m_dirk_impl->m_collect_newton_stats = c.get<SimulationParams>().dirk_newton_stats;
+  }
 }
 
 // Note: you cannot declare the default destructor in the header,
@@ -39,6 +46,21 @@ void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int n
   GPTLstart("compute_stage_value_dirk");
   m_dirk_impl->run(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, elements, hvcoord);
   GPTLstop("compute_stage_value_dirk");
+
+  if (m_dirk_impl->m_collect_newton_stats) {
+    // Report the Newton statistics of this call as zero-time timers next to
+    // compute_stage_value_dirk, so that they follow the GPTL output intervals:
+    //  - the call counts of newton_iters and jacobian_factorizations are the
+    //    totals over elements and calls in the interval;
+    //  - newton_max_iters is called once per call, with the max iteration
+    //    count over elements as its value, so the timer max is the max in
+    //    the interval.
+    const auto stats = m_dirk_impl->get_newton_stats();
+    m_dirk_impl->reset_newton_stats();
+    GPTLstartstop_vals("compute_stage_value_dirk:newton_iters", 0, static_cast<int>(stats.iters));
+    GPTLstartstop_vals("compute_stage_value_dirk:newton_max_iters", stats.max_iters, 1);
+    GPTLstartstop_vals("compute_stage_value_dirk:jacobian_factorizations", 0, static_cast<int>(stats.factorizations));
+  }
 }
 
 } // Namespace Homme
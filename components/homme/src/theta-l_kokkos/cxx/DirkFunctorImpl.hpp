@@ -83,12 +83,35 @@ struct DirkFunctorImpl {
     return subview(w, wi, si, a, a);
   }
 
+  // Newton iteration statistics, summed over elements and over all calls to
+  // run since the last call to reset_newton_stats.
+  // Counters are 64 bit, since the sums over elements and calls can overflow
+  // an int in long runs on many elements.
+  struct NewtonStats {
+    long long iters = 0;          // Newton iterations, summed over elements
+    long long max_iters = 0;      // max Newton iterations in any element and call
+    long long factorizations = 0; // Jacobian factorizations, summed over elements
+  };
+  using NewtonStatsView = Kokkos::View<long long[3], ExecSpace>;
+
   Work m_work;
   LinearSystem m_ls;
   TeamPolicy m_policy, m_ig_policy;
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
 
+  // If true, use modified Newton: factor the Jacobian in the first iteration
+  // and reuse the factorization in later ones, refactoring only if the Newton
+  // increment shrinks by less than m_refactor_rate in one iteration.
+  bool m_modified_newton = false;
+  Real m_refactor_rate = 0.5;
+
+  // If true, run accumulates Newton statistics on device. They are brought to
+  // host only when requested, with get_newton_stats.
+  bool m_collect_newton_stats = false;
+  NewtonStatsView m_newton_stats;
+  NewtonStatsView::HostMirror m_newton_stats_h;
+
   DirkFunctorImpl (const int nelem)
     : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
   {
@@ -122,6 +145,8 @@ struct DirkFunctorImpl {
     nslot = std::min(nelem, m_tu.get_num_ws_slots());
     m_ig_policy = Homme::get_default_team_policy<ExecSpace>(nelem);
     m_tu_ig = TeamUtils<ExecSpace>(m_ig_policy);
+    m_newton_stats = NewtonStatsView("DIRK Newton stats");
+    m_newton_stats_h = Kokkos::create_mirror_view(m_newton_stats);
   }
 
   int requested_buffer_size () const {
@@ -148,6 +173,18 @@ struct DirkFunctorImpl {
     Kokkos::fence();
   }
 
+  // Note: this copies the stats to host, so don't call it at every step.
+  NewtonStats get_newton_stats () const {
+    Kokkos::deep_copy(m_newton_stats_h, m_newton_stats);
+    NewtonStats stats;
+    stats.iters = m_newton_stats_h(0);
+    stats.max_iters = m_newton_stats_h(1);
+    stats.factorizations = m_newton_stats_h(2);
+    return stats;
+  }
+
+  void reset_newton_stats () { Kokkos::deep_copy(m_newton_stats, 0); }
+
   // Optimal impl of phi_from_eos for the initial guess. See comments for the
   // function phi_from_eos, below, for discussion. This kernel uses standard
   // Hommexx layout and parallelization approaches to compute the scans
@@ -226,6 +263,10 @@ struct DirkFunctorImpl {
     const auto e_initial_guess = e.m_derived.m_divdp_proj;
     const auto hybi = hvcoord.hybrid_bi;
     const auto tu   = m_tu;
+    const auto stats = m_newton_stats;
+    const bool modified_newton = m_modified_newton;
+    const bool collect_stats = m_collect_newton_stats;
+    const Real refactor_rate = m_refactor_rate;
 
     const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
       KernelVariables kv(team, tu);
@@ -339,8 +380,9 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
-      int it = 0;
-      Real deltaerr;
+      int it = 0, nfactor = 0;
+      Real deltaerr, deltaerr_prev = -1;
+      bool refactor = true;
       for (; it < maxiter; ++it) { // Newton iteration
         const bool ok = pnh_and_exner_from_eos(kv, hvcoord, vtheta_dp, dp3d,
                                                dphi, pnh, wrk, dpnh_dp_i);
@@ -350,9 +392,24 @@ struct DirkFunctorImpl {
           x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
         });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
-        kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        if (modified_newton) {
+          // The BFB solver does not separate factorization and solve, so
+          // modified Newton always uses the non-BFB factorization.
+          if (refactor) {
+            calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+            kv.team_barrier();
+            factor(kv, dl, d, du);
+            ++nfactor;
+            refactor = false;
+          }
+          kv.team_barrier();
+          solve_factored(kv, dl, d, du, x);
+        } else {
+          calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+          kv.team_barrier();
+          if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+          ++nfactor;
+        }
         kv.team_barrier();
 
         loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
@@ -378,9 +435,23 @@ struct DirkFunctorImpl {
         loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
 
         if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+
+        // Refactor if the stale Jacobian is no longer giving fast convergence.
+        if (deltaerr_prev >= 0 && deltaerr > refactor_rate*deltaerr_prev)
+          refactor = true;
+        deltaerr_prev = deltaerr;
       } // Newton iteration
       kv.team_barrier();
 
+      if (collect_stats) {
+        Kokkos::single(Kokkos::PerTeam(kv.team), [&] () {
+          const long long niter = it < maxiter ? it+1 : maxiter;
+          Kokkos::atomic_add(&stats(0), niter);
+          Kokkos::atomic_max(&stats(1), niter);
+          Kokkos::atomic_add(&stats(2), static_cast<long long>(nfactor));
+        });
+      }
+
       if (it >= maxiter) {
         printf("[DIRK] WARNING! Newton reached max iteration count,"
                " with deltaerr = %3.17f\n", deltaerr);
@@ -397,6 +468,7 @@ struct DirkFunctorImpl {
 
     int nerr;
     Kokkos::parallel_reduce(m_policy, toplevel, nerr);
+
     if (nerr > 0) {
       const int nt[] = {nm1, n0, np1};
       const char* ntname[] = {"nm1", "n0", "np1"};
@@ -787,6 +859,39 @@ struct DirkFunctorImpl {
     scream::tridiag::bfb(kv.team, dl, d, du, x);
   }
 
+  // In-place LU factorization of the tridiagonal Jacobian, for reuse across
+  // Newton iterations. On output, dl holds the multipliers and d the pivots;
+  // du is unchanged. No pivoting is needed since the Jacobian is strictly
+  // diagonally dominant (see calc_jacobian).
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void factor (const KernelVariables& kv,
+                      const W& dl, const W& d, const W& du) {
+    assert(d.extent_int(0) == num_phys_lev);
+    loop_ki(kv, 1, npack, [&] (int, int i) {
+      for (int k = 1; k < num_phys_lev; ++k) {
+        dl(k,i) /= d(k-1,i);
+        d(k,i) -= dl(k,i)*du(k-1,i);
+      }
+    });
+  }
+
+  // Solve using the output of factor. dl, d, du are not modified.
+  template <typename W>
+  KOKKOS_INLINE_FUNCTION
+  static void solve_factored (const KernelVariables& kv,
+                              const W& dl, const W& d, const W& du, const W& x) {
+    assert(d.extent_int(0) == num_phys_lev);
+    const int nlev = num_phys_lev;
+    loop_ki(kv, 1, npack, [&] (int, int i) {
+      for (int k = 1; k < nlev; ++k)
+        x(k,i) -= dl(k,i)*x(k-1,i);
+      x(nlev-1,i) /= d(nlev-1,i);
+      for (int k = nlev-2; k >= 0; --k)
+        x(k,i) = (x(k,i) - du(k,i)*x(k+1,i))/d(k,i);
+    });
+  }
+
   // Determine a step length 0 < alpha <= 1.
   KOKKOS_INLINE_FUNCTION static void
   calc_step_size (const KernelVariables& kv, const int nlev, const int nvec,
@@ -66,6 +66,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
   // Sanity check
   assert(params.params_set);
 
+  m_overlap_exchange = params.overlap_exchange;
+
   if (m_data.nu_top>0) {
 
     m_nu_scale_top = ExecViewManaged<Scalar[NUM_LEV]>("nu_scale_top");
@@ -271,14 +273,26 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
-
     // Exchange
     assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    if (m_overlap_exchange) {
+      overlap_with_exchange(*m_be, [&](const ElementsSubset& elems) {
+        m_elems = elems;
+        Kokkos::parallel_for(Homme::get_subset_team_policy<ExecSpace,TagHyperPreExchange>(elems.num_elems,m_num_elems), *this);
+        Kokkos::fence();
+      });
+      m_elems = ElementsSubset();
+      GPTLstart("hvf-bexch");
+      m_be->recv_and_unpack();
+      GPTLstop("hvf-bexch");
+    } else {
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
+
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -350,19 +364,31 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   } // for sponge layer
 } // run()
 
-void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
+void HyperviscosityFunctorImpl::biharmonic_wk_theta()
 {
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
   assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  if (m_overlap_exchange) {
+    overlap_with_exchange(*m_be, [&](const ElementsSubset& elems) {
+      m_elems = elems;
+      Kokkos::parallel_for(Homme::get_subset_team_policy<ExecSpace,TagFirstLaplaceHV>(elems.num_elems,m_num_elems), *this);
+      Kokkos::fence();
+    });
+    m_elems = ElementsSubset();
+    GPTLstart("hvf-bexch");
+    m_be->recv_and_unpack(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  } else {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
+
+    // Exchange
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  }
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -17,6 +17,7 @@
 #include "KernelVariables.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "mpi/Connectivity.hpp"
 
 #include "utilities/VectorUtils.hpp"
 
@@ -105,7 +106,7 @@ public:
 
   void run (const int np1, const Real dt, const Real eta_ave_w);
 
-  void biharmonic_wk_theta () const;
+  void biharmonic_wk_theta ();
 
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
@@ -113,6 +114,7 @@ public:
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(team.league_rank());
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -316,6 +318,7 @@ public:
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(team.league_rank());
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -399,6 +402,11 @@ protected:
 
   bool m_process_nh_vars;
 
+  // If true, overlap the loops right before an exchange with the exchange itself
+  bool m_overlap_exchange;
+  // The elements processed by those loops (all of them, unless overlapping)
+  ElementsSubset m_elems;
+
   // Policies
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
   Kokkos::TeamPolicy<ExecSpace,TagFirstLaplaceHV>   m_policy_first_laplace;
@@ -47,7 +47,13 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const bool& tracer_exchange_single_precision, const bool& sl_persistent_comm,
+                               const bool& sl_batch_tracer_interp, const bool& sl_cedr_split_phase,
+                               const bool& overlap_exchange,
+                               const bool& dirk_modified_newton,
+                               const bool& dirk_newton_stats,
+                               const bool& remap_batch_tracers)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -124,6 +130,14 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.tracer_exchange_single_precision = tracer_exchange_single_precision;
+  params.sl_persistent_comm = sl_persistent_comm;
+  params.sl_batch_tracer_interp = sl_batch_tracer_interp;
+  params.sl_cedr_split_phase = sl_cedr_split_phase;
+  params.overlap_exchange = overlap_exchange;
+  params.dirk_modified_newton = dirk_modified_newton;
+  params.dirk_newton_stats = dirk_newton_stats;
+  params.remap_batch_tracers = remap_batch_tracers;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
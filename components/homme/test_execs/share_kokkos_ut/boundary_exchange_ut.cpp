@@ -50,9 +50,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::uniform_int_distribution<int>   dint(0,1);
 
   constexpr int ne        = 2;
-  constexpr int num_tests = 1;
+  constexpr int num_tests = 2;
   constexpr int DIM       = 2;
   constexpr double test_tolerance = 1e-13;
+  // Absolute tolerance for single precision exchanges: each of the (at most 5)
+  // contributions summed at a point is rounded to float, and |values|<=1
+  constexpr double rp_test_tolerance = 1e-6;
   constexpr int num_min_max_fields_1d = 1; // Count min and max of a field as 1, does not count the x2 due to min and max
   constexpr int num_scalar_fields_2d  = 1;
   constexpr int num_scalar_fields_3d  = 1;
@@ -100,6 +103,8 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][DIM][NP][NP][NUM_LEV]> field_4d_cxx ("", num_elements);
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][DIM][NP][NP][NUM_LEV]>::HostMirror field_4d_cxx_host;
   field_4d_cxx_host = Kokkos::create_mirror_view(field_4d_cxx);
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][DIM][NP][NP][NUM_LEV]> field_4d_rp_cxx ("", num_elements);
+  auto field_4d_rp_cxx_host = Kokkos::create_mirror_view(field_4d_rp_cxx);
 
   HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]> field_3d_int_f90("", num_elements);
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV_P]> field_3d_int_cxx ("", num_elements);
@@ -115,6 +120,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::shared_ptr<BoundaryExchange> be1 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be2 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be3 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager_min_max);
+  std::shared_ptr<BoundaryExchange> be4 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
 
   // Setup the be objects
   be1->set_num_fields(0,num_scalar_fields_2d,DIM*num_vector_fields_3d);
@@ -131,6 +137,36 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  // Same fields as the 3d part of be1, exchanged in single precision
+  be4->set_num_fields(0,0,DIM*num_vector_fields_3d);
+  be4->register_field_reduced_precision(field_4d_rp_cxx,field_4d_outer_idim,DIM,0);
+  be4->registration_completed();
+
+  // Number of elements sharing each GLL point, to check that the single
+  // precision exchange conserves the sum over unique points. Exchanging a field
+  // of ones involves no rounding.
+  Kokkos::deep_copy(field_4d_rp_cxx, Scalar(1.0));
+  be4->exchange();
+  decltype(field_4d_rp_cxx_host) mult_4d_host("", num_elements);
+  Kokkos::deep_copy(mult_4d_host, field_4d_rp_cxx);
+  const auto sum_over_unique_pts = [&] (const decltype(field_4d_rp_cxx_host)& f, const bool weigh) {
+    Real sum = 0;
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int idim=0; idim<DIM; ++idim) {
+          for (int igp=0; igp<NP; ++igp) {
+            for (int jgp=0; jgp<NP; ++jgp) {
+              for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
+                const int ilev = level / VECTOR_SIZE;
+                const int ivec = level % VECTOR_SIZE;
+                const Real w = weigh ? 1.0/mult_4d_host(ie,itl,idim,igp,jgp,ilev)[ivec] : 1.0;
+                sum += w*f(ie,itl,idim,igp,jgp,ilev)[ivec];
+    }}}}}}
+    Real gsum;
+    MPI_Allreduce(&sum, &gsum, 1, MPI_DOUBLE, MPI_SUM, connectivity->get_comm().mpi_comm());
+    return gsum;
+  };
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -197,6 +233,8 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
                 field_4d_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec] = field_4d_f90(ie,itl,idim,level,igp,jgp);
     }}}}}}
     Kokkos::deep_copy(field_4d_cxx, field_4d_cxx_host);
+    Kokkos::deep_copy(field_4d_rp_cxx, field_4d_cxx_host);
+    const Real rp_sum_before = sum_over_unique_pts(field_4d_cxx_host, false);
 
     // Perform boundary exchange
     boundary_exchange_test_f90(field_min_1d_f90.data(), field_max_1d_f90.data(),
@@ -208,19 +246,34 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be1->exchange();
       be2->exchange();
       be3->exchange_min_max();
-    } else {
+    } else if (itest%2==0) {
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
       be2->pack_and_send();
       be2->recv_and_unpack();
       be3->recv_and_unpack_min_max();
+    } else {
+      // Split-phase pack, as used when overlapping the exchange with computation
+      be3->pack_and_send_min_max();
+      be1->pack_and_send_shared();
+      be1->pack_local();
+      be1->recv_and_unpack();
+      be2->pack_and_send_shared();
+      be2->pack_local();
+      be2->recv_and_unpack();
+      be3->recv_and_unpack_min_max();
     }
+    be4->exchange();
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
     Kokkos::deep_copy(field_2d_cxx_host,     field_2d_cxx);
     Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
     Kokkos::deep_copy(field_3d_int_cxx_host, field_3d_int_cxx);
     Kokkos::deep_copy(field_4d_cxx_host,     field_4d_cxx);
+    Kokkos::deep_copy(field_4d_rp_cxx_host,  field_4d_rp_cxx);
+
+    // The single precision exchange conserves the sum of the contributions
+    REQUIRE(std::abs(sum_over_unique_pts(field_4d_rp_cxx_host, true) - rp_sum_before) < 1e-10);
 
     // Compare answers
     for (int ie=0; ie<num_elements; ++ie) {
@@ -298,12 +351,48 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
                   std::cout << std::setprecision(17) << "cxx: " << field_4d_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec] << "\n";
                 }
                 REQUIRE(compare_answers(field_4d_f90(ie,itl,idim,level,igp,jgp),field_4d_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec]) < test_tolerance);
+                REQUIRE(compare_answers(field_4d_f90(ie,itl,idim,level,igp,jgp),field_4d_rp_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec],0.0) < rp_test_tolerance);
     }}}}}}
   }
 
+  // The single precision exchange must preserve the sign of a non-negative field (e.g., qdp
+  // after the limiter), and its mass. Use values that are not representable in single precision
+  // on the boundary, and an interior that is zero on odd levels, and positive on even levels.
+  for (int ie=0; ie<num_elements; ++ie) {
+    for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+      for (int idim=0; idim<DIM; ++idim) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
+              const int ilev = level / VECTOR_SIZE;
+              const int ivec = level % VECTOR_SIZE;
+              const bool interior = igp>0 && igp<NP-1 && jgp>0 && jgp<NP-1;
+              const Real val = (1 + ie + itl + idim + igp*NP + jgp + level) / 3.0;
+              field_4d_rp_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec] = interior && level%2==1 ? 0.0 : val;
+  }}}}}}
+  Kokkos::deep_copy(field_4d_rp_cxx, field_4d_rp_cxx_host);
+  const Real nonneg_sum_before = sum_over_unique_pts(field_4d_rp_cxx_host, false);
+  be4->exchange();
+  Kokkos::deep_copy(field_4d_rp_cxx_host, field_4d_rp_cxx);
+  Real min_val = 0;
+  for (int ie=0; ie<num_elements; ++ie) {
+    for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+      for (int idim=0; idim<DIM; ++idim) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
+              const int ilev = level / VECTOR_SIZE;
+              const int ivec = level % VECTOR_SIZE;
+              min_val = std::min(min_val, field_4d_rp_cxx_host(ie,itl,idim,igp,jgp,ilev)[ivec]);
+  }}}}}}
+  REQUIRE(min_val >= 0);
+  const Real nonneg_sum_after = sum_over_unique_pts(field_4d_rp_cxx_host, true);
+  REQUIRE(std::abs(nonneg_sum_after - nonneg_sum_before) <= 1e-14*nonneg_sum_before);
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
   be2->clean_up();
   be3->clean_up();
+  be4->clean_up();
 }
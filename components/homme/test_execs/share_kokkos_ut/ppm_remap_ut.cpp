@@ -7,6 +7,7 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/TestUtils.hpp"
 
+#include <chrono>
 #include <random>
 
 using namespace Homme;
@@ -50,6 +51,9 @@ public:
   struct TagGridTest {};
   struct TagPPMTest {};
   struct TagRemapTest {};
+  struct TagGridsPhase {};
+  struct TagRemapField {};
+  struct TagRemapBatched {};
 
   static bool nan_boundaries(
       HostViewUnmanaged<Real * [NP][NP][_ppm_consts::DPO_PHYSICAL_LEV]> host) {
@@ -375,6 +379,99 @@ public:
     }
   }
 
+  // As RemapFunctor does it: compute_grids_phase once per element, then
+  // remap either with a team per (element, field) or a team per element.
+  void run_grids_phase() {
+    Kokkos::parallel_for(
+        Homme::get_default_team_policy<ExecSpace, TagGridsPhase>(ne), *this);
+  }
+
+  void run_remap_phase(const bool batched) {
+    if (batched)
+      Kokkos::parallel_for(
+          Homme::get_default_team_policy<ExecSpace, TagRemapBatched>(ne), *this);
+    else
+      Kokkos::parallel_for(
+          Homme::get_default_team_policy<ExecSpace, TagRemapField>(ne*num_remap), *this);
+  }
+
+  // Remap the same random fields one field per team and batched, and check
+  // that the results are identical.
+  void test_remap_batched() {
+    std::random_device rd;
+    const unsigned int catchRngSeed = Catch::rngSeed();
+    const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+    std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+    rngAlg engine(seed);
+    genRandArray(remap_vals, engine, std::uniform_real_distribution<Real>(0.125, 1000.0));
+    initialize_layers(engine);
+
+    ExecViewManaged<Scalar * * [NP][NP][NUM_LEV]> vals0("vals0", ne, num_remap);
+    Kokkos::deep_copy(vals0, remap_vals);
+    run_grids_phase();
+    run_remap_phase(false);
+    Kokkos::fence();
+    auto ref = Kokkos::create_mirror_view(remap_vals);
+    Kokkos::deep_copy(ref, remap_vals);
+
+    Kokkos::deep_copy(remap_vals, vals0);
+    run_remap_phase(true);
+    Kokkos::fence();
+    auto batched = Kokkos::create_mirror_view(remap_vals);
+    Kokkos::deep_copy(batched, remap_vals);
+
+    for (int ie = 0; ie < ne; ++ie)
+      for (int var = 0; var < num_remap; ++var)
+        for (int igp = 0; igp < NP; ++igp)
+          for (int jgp = 0; jgp < NP; ++jgp)
+            for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+              const int ilev = k / VECTOR_SIZE, vlev = k % VECTOR_SIZE;
+              REQUIRE(batched(ie, var, igp, jgp, ilev)[vlev] ==
+                      ref(ie, var, igp, jgp, ilev)[vlev]);
+            }
+  }
+
+  // Time the remap phase for num_remap fields, one field per team and batched.
+  void time_remap(const int nrep, double& t_field, double& t_batched) {
+    using Clock = std::chrono::steady_clock;
+    rngAlg engine(num_remap);
+    genRandArray(remap_vals, engine, std::uniform_real_distribution<Real>(0.125, 1000.0));
+    initialize_layers(engine);
+    run_grids_phase();
+    const auto run = [&] (const bool batched) {
+      Kokkos::fence();
+      const auto t0 = Clock::now();
+      for (int rep = 0; rep < nrep; ++rep) run_remap_phase(batched);
+      Kokkos::fence();
+      return std::chrono::duration<double>(Clock::now() - t0).count()/nrep;
+    };
+    run(false); // warm up
+    t_field = run(false);
+    t_batched = run(true);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagGridsPhase &, const TeamMember& team) const {
+    KernelVariables kv(team);
+    remap.compute_grids_phase(
+        kv, Homme::subview(src_layer_thickness_kokkos, kv.ie),
+        Homme::subview(tgt_layer_thickness_kokkos, kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagRemapField &, const TeamMember& team) const {
+    KernelVariables kv(team, num_remap);
+    remap.compute_remap_phase(kv, Homme::subview(remap_vals, kv.ie, kv.iq));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagRemapBatched &, const TeamMember& team) const {
+    KernelVariables kv(team);
+    remap.compute_remap_phase_batched(
+        kv, num_remap,
+        [&](const int var) { return Homme::subview(remap_vals, kv.ie, var); });
+  }
+
   const int ne, num_remap;
   PpmVertRemap<boundary_cond> remap;
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> src_layer_thickness_kokkos;
@@ -389,6 +486,23 @@ TEST_CASE("ppm_mirrored", "vertical remap") {
   SECTION("grid") { remap_test_mirrored.test_grid(); }
   SECTION("ppm") { remap_test_mirrored.test_ppm(); }
   SECTION("remap") { remap_test_mirrored.test_remap(); }
+  SECTION("remap_batched") { remap_test_mirrored.test_remap_batched(); }
+}
+
+// Timing only; run it explicitly with the [perf] tag.
+TEST_CASE("ppm_remap_batched_perf", "[.][perf]") {
+  constexpr int num_elems = 64;
+  constexpr int nrep = 10;
+  printf("ppm remap: %d elems, %d levels; time per remap (s)\n",
+         num_elems, NUM_PHYSICAL_LEV);
+  printf("%6s %12s %12s %8s\n", "qsize", "per-field", "batched", "speedup");
+  for (const int qsize : {1, 4, 10, 20, 40}) {
+    ppm_remap_functor_test<PpmMirrored> t(num_elems, qsize);
+    double t_field, t_batched;
+    t.time_remap(nrep, t_field, t_batched);
+    printf("%6d %12.4e %12.4e %8.2f\n", qsize, t_field, t_batched, t_field/t_batched);
+    REQUIRE(t_batched > 0);
+  }
 }
 
 
@@ -407,6 +407,59 @@ TEST_CASE ("compose_transport_testing") {
         //todo add an l2 ceiling for some select tracers as a function of ne
       }
     }
+
+    // Persistent MPI requests change how the SL step communicates, not what it
+    // computes. The search for a departure point's cell can start from the
+    // previous step's cell, so points on a cell edge may interpolate from the
+    // neighboring cell; allow for roundoff.
+    auto& p = Context::singleton().get<SimulationParams>();
+    std::vector<Real> eval_p(eval_c.size());
+    ct.test_2d(false, nmax, eval_c);
+    p.sl_persistent_comm = true;
+    ct.reset(p);
+    ct.test_2d(false, nmax, eval_p);
+    p.sl_persistent_comm = false;
+    ct.reset(p);
+    if (s.get_comm().root()) {
+      const int n = s.nlev*s.qsize;
+      for (int i = 0; i < n; ++i) REQUIRE(almost_equal(eval_c[i], eval_p[i], 1e3*tol));
+      for (int i = n; i < n + s.qsize; ++i) REQUIRE(std::abs(eval_p[i]) <= 20*tol);
+    }
+
+    // Batched tracer interpolation forms the weights once per departure point
+    // and so differs from the default by roundoff.
+    p.sl_batch_tracer_interp = true;
+    ct.reset(p);
+    ct.test_2d(false, nmax, eval_p);
+    p.sl_batch_tracer_interp = false;
+    ct.reset(p);
+    if (s.get_comm().root()) {
+      const int n = s.nlev*s.qsize;
+      for (int i = 0; i < n; ++i) REQUIRE(almost_equal(eval_c[i], eval_p[i], 1e-10));
+      for (int i = n; i < n + s.qsize; ++i) REQUIRE(std::abs(eval_p[i]) <= 20*tol);
+    }
+
+    // The split-phase CEDR run overlaps the global reduction with the omega
+    // DSS and must be BFB with the blocking run.
+    const auto run_2d = [&] (const bool split, std::vector<Real>& eval) {
+      p.sl_cedr_split_phase = split;
+      ct.reset(p);
+      ct.test_2d(false, nmax, eval);
+      const RNlev omega(pack2real(s.e->m_derived.m_omega_p), s.nelemd);
+      const auto omega_h = Kokkos::create_mirror(omega);
+      Kokkos::deep_copy(omega_h, omega);
+      return omega_h;
+    };
+    std::vector<Real> eval_s(eval_c.size());
+    const auto omega_b = run_2d(false, eval_c);
+    const auto omega_s = run_2d(true, eval_s);
+    if (s.get_comm().root())
+      for (size_t i = 0; i < eval_c.size(); ++i) REQUIRE(eval_s[i] == eval_c[i]);
+    for (int ie = 0; ie < s.nelemd; ++ie)
+      for (int i = 0; i < s.np; ++i)
+        for (int j = 0; j < s.np; ++j)
+          for (int k = 0; k < s.nlev; ++k)
+            REQUIRE(omega_s(ie,i,j,k) == omega_b(ie,i,j,k));
   }
 
   } catch (...) {}
@@ -367,13 +367,17 @@ TEST_CASE ("dirk_pieces_testing") {
       }
 
     // Test solvers.
-    dfi::LinearSystem ls1("w1", 1);
+    dfi::LinearSystem ls1("w1", 1), ls2("w2", 1);
     const auto
       x1  = dfi::get_ls_slot(ls , 0, 3),
       x2  = dfi::get_ls_slot(ls1, 0, 0),
       dl2 = dfi::get_ls_slot(ls1, 0, 1),
       d2  = dfi::get_ls_slot(ls1, 0, 2),
-      du2 = dfi::get_ls_slot(ls1, 0, 3);
+      du2 = dfi::get_ls_slot(ls1, 0, 3),
+      x4  = dfi::get_ls_slot(ls2, 0, 0),
+      dl4 = dfi::get_ls_slot(ls2, 0, 1),
+      d4  = dfi::get_ls_slot(ls2, 0, 2),
+      du4 = dfi::get_ls_slot(ls2, 0, 3);
     FA3d x3("x3", np, np, nlev);
     const auto x1m = create_mirror_view(x1);
     // Fill RHS with random numbers.
@@ -390,16 +394,23 @@ TEST_CASE ("dirk_pieces_testing") {
         }
     deep_copy(x1, x1m);
     deep_copy(x2, x1);
+    deep_copy(x4, x1);
     deep_copy(dl2, dl); deep_copy(d2, d); deep_copy(du2, du);
+    deep_copy(dl4, dl); deep_copy(d4, d); deep_copy(du4, du);
     const auto f2 = KOKKOS_LAMBDA(const dfi::MT& t) {
       KernelVariables kv(t);
+      dfi::factor(kv, dl4, d4, du4);
       dfi::solve   (kv, dl , d , du , x1);
       dfi::solvebfb(kv, dl2, d2, du2, x2);
+      kv.team_barrier();
+      dfi::solve_factored(kv, dl4, d4, du4, x4);
     };
     parallel_for(d1.m_policy, f2); fence();
     // Test that BFB and non-BFB solvers give nearly the same answers.
+    // Also test the factorization used by modified Newton.
     deep_copy(x1m, x1);
     const auto x2m = cmvdc(x2);
+    const auto x4m = cmvdc(x4);
     for (int i = 0; i < np; ++i)
       for (int j = 0; j < np; ++j) {
         const auto
@@ -408,6 +419,7 @@ TEST_CASE ("dirk_pieces_testing") {
           si = idx % dfi::packn;
         for (int k = 0; k < nlev; ++k) {
           REQUIRE(almost_equal(x1m(k,pi)[si], x2m(k,pi)[si], 1e4*eps));
+          REQUIRE(almost_equal(x1m(k,pi)[si], x4m(k,pi)[si], 1e4*eps));
         }
       }
     // Test BFB F90 and C++.
@@ -762,9 +774,10 @@ TEST_CASE ("dirk_toplevel_testing") {
     const int nm1 = alphadtwt_nm1 == 0.0 ? -1 : 0;
     for (Real alphadtwt_n0 : {0.0, 0.7}) {
       decltype(ElementsState::m_w_i) w_i("w_i", nelemd),
-        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
+        w_i1("w_i1", nelemd), w_i2("w_i2", nelemd), w_i3("w_i3", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
-        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+        phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd),
+        phinh_i3("phinh_i3", nelemd);
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -818,6 +831,8 @@ TEST_CASE ("dirk_toplevel_testing") {
         good = true;
 
         // Run C++ with non-BFB solver.
+        d.m_collect_newton_stats = true;
+        d.reset_newton_stats();
         d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
               e, hvcoord, false /* non-BFB solver */);
         fence();
@@ -826,6 +841,28 @@ TEST_CASE ("dirk_toplevel_testing") {
         // Restore state.
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
+        const auto full_newton_stats = d.get_newton_stats();
+
+        // Run C++ with modified Newton.
+        d.reset_newton_stats();
+        d.m_modified_newton = true;
+        d.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+              e, hvcoord, false /* non-BFB solver */);
+        fence();
+        d.m_modified_newton = false;
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
+        // Full Newton factors once per iteration; modified Newton at most that often.
+        const auto modified_newton_stats = d.get_newton_stats();
+        d.m_collect_newton_stats = false;
+        REQUIRE(full_newton_stats.factorizations == full_newton_stats.iters);
+        REQUIRE(modified_newton_stats.factorizations >= nelemd);
+        REQUIRE(modified_newton_stats.factorizations <= modified_newton_stats.iters);
+        REQUIRE(modified_newton_stats.max_iters <= 20);
 
         break;
       }
@@ -834,8 +871,10 @@ TEST_CASE ("dirk_toplevel_testing") {
 
       const auto w1m = cmvdc(w_i1);
       const auto w2m = cmvdc(w_i2);
+      const auto w3m = cmvdc(w_i3);
       const auto phinh1m = cmvdc(phinh_i1);
       const auto phinh2m = cmvdc(phinh_i2);
+      const auto phinh3m = cmvdc(phinh_i3);
 
       // Test that running with BFB and non-BFB solvers produces similar answers.
       for (int ie = 0; ie < nelemd; ++ie)
@@ -848,6 +887,24 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that modified and full Newton converge to nearly the same
+      // answer. Both stop once the increment is below the Newton tolerance, so
+      // the difference is of the order of that tolerance, not of roundoff.
+#ifdef HOMMEXX_BFB_TESTING
+      const Real newton_tol = 1e-5;
+#else
+      const Real newton_tol = 1e-9;
+#endif
+      for (int ie = 0; ie < nelemd; ++ie)
+        for (int i = 0; i < np; ++i)
+          for (int j = 0; j < np; ++j)
+            for (int f = 0; f < 2; ++f) {
+              Real* p1 = f == 0 ? &w1m(ie,np1,i,j,0)[0] : &phinh1m(ie,np1,i,j,0)[0];
+              Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+              for (int k = 0; k < nlev+1; ++k)
+                REQUIRE(almost_equal(p1[k], p3[k], newton_tol));
+            }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);